@@ -78,7 +78,29 @@ uint32_t KISS2func(void)
   return KISS2;
 }
 
-/* This is a test main program. It should compile and print 11 0's. */
+/* CMWC4096, from Marsaglia's 2003 post. Q[] should be filled with 4096
+ * random 32-bit values, e.g. from KISS, before use. */
+static uint32_t Q[4096], cmwc_c = 362436;
+
+uint32_t CMWC4096(void)
+{
+  uint64_t t, a = UINT64_C(18782);
+  static uint32_t i = 4095;
+  uint32_t x, r = 0xfffffffe;
+
+  i = (i + 1) & 4095;
+  t = a * Q[i] + cmwc_c;
+  cmwc_c = (t >> 32);
+  x = t + cmwc_c;
+  if (x < cmwc_c)
+  {
+    x++;
+    cmwc_c++;
+  }
+  return (Q[i] = r - x);
+}
+
+/* This is a test main program. It should compile and print 13 0's. */
 int main (void)
 {
     unsigned int    i;
@@ -156,6 +178,21 @@ int main (void)
     }
     printf ("%"PRIu32"\n", k - 1010846401U);
 
+    /* CMWC4096 with Q[] filled from KISS, from the same seeds as the table. */
+    settable(12345, 65435, 34221, 12345, 9983651, 95746118);
+    for (i = 0; i < 4096; i++)
+    {
+        Q[i] = KISS;
+    }
+    printf ("%"PRIu32"\n", CMWC4096() - 736549275U);
+    printf ("%"PRIu32"\n", CMWC4096() - 678086136U);
+    printf ("%"PRIu32"\n", CMWC4096() - 842810117U);
+    for (i = 3; i < 1000000; i++)
+    {
+        k = CMWC4096();
+    }
+    printf ("%"PRIu32"\n", k - 2065907955U);
+
     return 0;
 }
 
@@ -64,6 +64,9 @@
  *     Do ops n times       where matrix f represents ops--
  *                          f * f * f * ... n times
  *                          i.e. pow(f, n)                  bitcolumnmatrix32_pow(result, f, n);
+ *
+ * The bitcolumnmatrix64_...() functions are the same for a 64-by-64 matrix,
+ * represented by 64 uint64_t integers.
  */
 
 /*****************************************************************************
@@ -196,6 +199,10 @@ void bitcolumnmatrix32_iadd(BitColumnMatrix32_t * p_left, const BitColumnMatrix3
 /* Multiply a matrix with a vector, resulting in a vector result.
  * The input and result vectors are represented by a uint32_t value.
  * That is to say, result_vector = left_matrix * right_vector.
+ *
+ * Each column is masked in or out according to the corresponding vector bit,
+ * rather than tested with a branch. The vector bits are effectively random, so
+ * a branch would be mispredicted often.
  */
 uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right)
 {
@@ -207,8 +214,7 @@ uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32
     {
         for (i = 0; i < 32u; i++)
         {
-            if (right & 1u)
-                result ^= p_left->matrix[i];
+            result ^= p_left->matrix[i] & (0u - (right & 1u));
             right >>= 1u;
         }
     }
@@ -264,3 +270,153 @@ void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_result, const BitColumnMatrix
     }
 }
 
+
+#ifdef UINT64_C
+
+/*********
+ * 64-by-64
+ *
+ * These are the same as the 32-by-32 functions above, for BitColumnMatrix64_t.
+ ********/
+
+void bitcolumnmatrix64_unity(BitColumnMatrix64_t * p_matrix)
+{
+    size_t      i;
+    uint64_t    value;
+
+    if (p_matrix != NULL)
+    {
+        value = 1u;
+        for (i = 0; i < 64u; i++)
+        {
+            p_matrix->matrix[i] = value;
+            value <<= 1u;
+        }
+    }
+}
+
+void bitcolumnmatrix64_shift(BitColumnMatrix64_t * p_matrix, int_fast8_t shift_value)
+{
+    size_t      i;
+    uint64_t    value;
+
+    if (p_matrix != NULL)
+    {
+        if (shift_value >= 0)
+            value = UINT64_C(1) << shift_value;
+        else
+            value = 0;
+
+        for (i = 0; i < 64u; i++)
+        {
+            p_matrix->matrix[i] = value;
+            if (shift_value < 0)
+            {
+                ++shift_value;
+                if (shift_value == 0)
+                    value = 1u;
+            }
+            else
+            {
+                value <<= 1u;
+            }
+        }
+    }
+}
+
+/* 'start' and 'end' are bit numbers in the range 0..64. See
+ * bitcolumnmatrix32_mask().
+ */
+void bitcolumnmatrix64_mask(BitColumnMatrix64_t * p_matrix, uint_fast8_t start, uint_fast8_t end)
+{
+    size_t      i;
+    uint64_t    value;
+
+    if (p_matrix != NULL)
+    {
+        value = 1u;
+        for (i = 0; i < 64u; i++)
+        {
+            if (start <= end)
+                p_matrix->matrix[i] = (start <= i && i < end) ? value : 0;
+            else
+                p_matrix->matrix[i] = (start <= i || i < end) ? value : 0;
+            value <<= 1u;
+        }
+    }
+}
+
+void bitcolumnmatrix64_iadd(BitColumnMatrix64_t * p_left, const BitColumnMatrix64_t * p_right)
+{
+    size_t      i;
+
+    if (p_left != NULL && p_right != NULL)
+    {
+        for (i = 0; i < 64u; i++)
+        {
+            p_left->matrix[i] ^= p_right->matrix[i];
+        }
+    }
+}
+
+uint64_t bitcolumnmatrix64_mul_uint64(const BitColumnMatrix64_t * p_left, uint64_t right)
+{
+    size_t      i;
+    uint64_t    result;
+
+    result = 0;
+    if (p_left != NULL)
+    {
+        for (i = 0; i < 64u; i++)
+        {
+            result ^= p_left->matrix[i] & (0u - (right & 1u));
+            right >>= 1u;
+        }
+    }
+    return result;
+}
+
+void bitcolumnmatrix64_imul(BitColumnMatrix64_t * p_left, const BitColumnMatrix64_t * p_right)
+{
+    BitColumnMatrix64_t matrix_result;
+    size_t              i;
+
+    if (p_left != NULL && p_right != NULL)
+    {
+        for (i = 0; i < 64u; i++)
+        {
+            matrix_result.matrix[i] = bitcolumnmatrix64_mul_uint64(p_left, p_right->matrix[i]);
+        }
+
+        /* Copy result to left matrix */
+        memcpy(p_left, &matrix_result, sizeof(*p_left));
+    }
+}
+
+void bitcolumnmatrix64_pow(BitColumnMatrix64_t * p_result, const BitColumnMatrix64_t * p_matrix, uintmax_t n)
+{
+    BitColumnMatrix64_t matrix_result;
+    BitColumnMatrix64_t matrix_exp;
+
+    if (p_result != NULL && p_matrix != NULL)
+    {
+        bitcolumnmatrix64_unity(&matrix_result);
+        memcpy(&matrix_exp, p_matrix, sizeof(matrix_exp));
+
+        for (;;)
+        {
+            if (n & 1u)
+            {
+                bitcolumnmatrix64_imul(&matrix_result, &matrix_exp);
+            }
+            n >>= 1;
+            if (n == 0)
+                break;
+            bitcolumnmatrix64_imul(&matrix_exp, &matrix_exp);
+        }
+        /* Copy result to result matrix */
+        memcpy(p_result, &matrix_result, sizeof(*p_result));
+    }
+}
+
+#endif /* defined(UINT64_C) */
@@ -64,6 +64,10 @@
  *     Do ops n times       where matrix f represents ops--
  *                          f * f * f * ... n times
  *                          i.e. pow(f, n)                  bitcolumnmatrix32_pow(result, f, n);
+ *
+ * BitColumnMatrix64_t is the same for a 64-by-64 matrix, represented by 64
+ * uint64_t integers, with the same set of bitcolumnmatrix64_...() functions.
+ * It is used for the 64-bit generators.
  */
 
 #ifndef _BITCOLUMNMATRIX_H
@@ -88,6 +92,15 @@ typedef struct
     uint32_t    matrix[32u];
 } BitColumnMatrix32_t;
 
+#ifdef UINT64_C
+
+typedef struct
+{
+    uint64_t    matrix[64u];
+} BitColumnMatrix64_t;
+
+#endif /* defined(UINT64_C) */
+
 
 /*****************************************************************************
  * Function prototypes
@@ -106,6 +119,19 @@ void bitcolumnmatrix32_imul(BitColumnMatrix32_t * p_left, const BitColumnMatrix3
 uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right);
 void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_matrix, uintmax_t n);
 
+#ifdef UINT64_C
+
+void bitcolumnmatrix64_unity(BitColumnMatrix64_t * p_matrix);
+void bitcolumnmatrix64_shift(BitColumnMatrix64_t * p_matrix, int_fast8_t shift_value);
+void bitcolumnmatrix64_mask(BitColumnMatrix64_t * p_matrix, uint_fast8_t start, uint_fast8_t end);
+
+void bitcolumnmatrix64_iadd(BitColumnMatrix64_t * p_left, const BitColumnMatrix64_t * p_right);
+void bitcolumnmatrix64_imul(BitColumnMatrix64_t * p_left, const BitColumnMatrix64_t * p_right);
+uint64_t bitcolumnmatrix64_mul_uint64(const BitColumnMatrix64_t * p_left, uint64_t right);
+void bitcolumnmatrix64_pow(BitColumnMatrix64_t * p_left, const BitColumnMatrix64_t * p_matrix, uintmax_t n);
+
+#endif /* defined(UINT64_C) */
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -16,6 +16,8 @@
 
 #include "maths.h"
 
+#include <stdbool.h>
+
 
 /*****************************************************************************
  * Local function prototypes
@@ -228,6 +230,37 @@ uint64_t pow_uint64(uint64_t base, uintmax_t n)
     return result;
 }
 
+/* Calculate geometric series:
+ *     1 + r + r^2 + r^3 + ... r^(n-1)
+ * summed to n terms, modulo 2^64.
+ *
+ * See geom_series_uint32() for the algorithm.
+ */
+uint64_t geom_series_uint64(uint64_t r, uintmax_t n)
+{
+    uint64_t    temp_r;
+    uint64_t    mult;
+    uint64_t    result;
+
+    if (n == 0)
+        return 0;
+
+    temp_r = r;
+    mult = 1;
+    result = 0;
+
+    while (n > 1)
+    {
+        if (n & 1)
+            result += mult * pow_uint64(temp_r, n - 1);
+        mult *= (1 + temp_r);
+        temp_r *= temp_r;
+        n >>= 1;
+    }
+    result += mult;
+    return result;
+}
+
 /* 64-bit calculation of 'base' to the power of an unsigned integer 'n',
  * modulo a uint64_t value 'mod'. */
 uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
@@ -251,4 +284,75 @@ uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
     return (uint64_t)result;
 }
 
+static inline bool uint128_less(Uint128_t a, Uint128_t b)
+{
+    return (a.high < b.high) || (a.high == b.high && a.low < b.low);
+}
+
+/* Addition of Uint128_t values 'a' and 'b', which must be less than 'mod',
+ * modulo 'mod'. 'mod' must be less than 2^127, so that a + b doesn't
+ * overflow.
+ */
+static Uint128_t add_mod_uint128(Uint128_t a, Uint128_t b, Uint128_t mod)
+{
+    Uint128_t   result;
+
+    result.low = a.low + b.low;
+    result.high = a.high + b.high + (result.low < a.low);
+    if (!uint128_less(result, mod))
+    {
+        result.high = result.high - mod.high - (result.low < mod.low);
+        result.low = result.low - mod.low;
+    }
+    return result;
+}
+
+/* Multiplication of Uint128_t values, modulo some Uint128_t value, which
+ * must be less than 2^127. 'a' and 'b' must be less than 'mod'.
+ *
+ * This uses the same essential algorithm as mul_mod_uint64(), on two 64-bit
+ * halves.
+ */
+Uint128_t mul_mod_uint128(Uint128_t a, Uint128_t b, Uint128_t mod)
+{
+    Uint128_t   result = { 0, 0 };
+
+    while (a.high != 0 || a.low != 0)
+    {
+        if (a.low & 1u)
+        {
+            result = add_mod_uint128(result, b, mod);
+        }
+        a.low = (a.low >> 1u) | (a.high << 63u);
+        a.high >>= 1u;
+
+        b = add_mod_uint128(b, b, mod);
+    }
+    return result;
+}
+
+/* 128-bit calculation of 'base' to the power of an unsigned integer 'n',
+ * modulo a Uint128_t value 'mod', which must be less than 2^127. 'base' must
+ * be less than 'mod'.
+ */
+Uint128_t pow_mod_uint128(Uint128_t base, uintmax_t n, Uint128_t mod)
+{
+    Uint128_t   result = { 0, 1u };
+    Uint128_t   temp_exp;
+
+    temp_exp = base;
+    for (;;)
+    {
+        if (n & 1u)
+        {
+            result = mul_mod_uint128(result, temp_exp, mod);
+        }
+        n >>= 1u;
+        if (n == 0)
+            break;
+        temp_exp = mul_mod_uint128(temp_exp, temp_exp, mod);
+    }
+    return result;
+}
+
 #endif /* defined(UINT64_C) */
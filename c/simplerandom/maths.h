@@ -15,6 +15,22 @@
 #include <stdint.h>
 
 
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+/* 128-bit unsigned value, since a uint128_t is most likely not available. */
+typedef struct
+{
+    uint64_t    high;
+    uint64_t    low;
+} Uint128_t;
+
+#endif /* defined(UINT64_C) */
+
+
 /*****************************************************************************
  * Function prototypes
  ****************************************************************************/
@@ -32,8 +48,12 @@ uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod);
 
 uint64_t mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod);
 uint64_t pow_uint64(uint64_t base, uintmax_t n);
+uint64_t geom_series_uint64(uint64_t r, uintmax_t n);
 uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod);
 
+Uint128_t mul_mod_uint128(Uint128_t a, Uint128_t b, Uint128_t mod);
+Uint128_t pow_mod_uint128(Uint128_t base, uintmax_t n, Uint128_t mod);
+
 #endif /* defined(UINT64_C) */
 
 #ifdef __cplusplus
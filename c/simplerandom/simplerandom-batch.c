@@ -0,0 +1,610 @@
+/*
+ * simplerandom-batch.c
+ *
+ * Simple Pseudo-random Number Generators -- batches of generators.
+ *
+ * A batch holds the states of many independent generators of the same type,
+ * in a "structure of arrays" layout. That is, each state word of the
+ * generator (e.g. z1, z2, z3, z4 for LFSR113) is stored in its own array,
+ * rather than storing an array of state structures.
+ *
+ * Stepping all generators in the batch is then a simple loop over contiguous
+ * arrays, doing the same operations for each element, which the compiler can
+ * vectorize with SIMD instructions. Rather than using platform-specific
+ * intrinsics, the loops are written so that the compiler auto-vectorizes them.
+ * The loops are in static functions taking 'restrict' array parameters, so
+ * the compiler knows the arrays don't overlap. The generators are processed
+ * in blocks of a fixed number of elements (BATCH_BLOCK), followed by any
+ * remainder one at a time. The fixed-length inner loop is vectorized even at
+ * -O2 by recent GCC versions, whose default cost model at -O2 won't vectorize
+ * a loop that needs a scalar epilogue.
+ *
+ * The batch doesn't allocate any memory. The caller provides a buffer of size
+ * given by simplerandom_zzz_batch_buf_size(). For best performance it should
+ * be aligned to SIMPLERANDOM_BATCH_ALIGN bytes. Each state word array starts
+ * at a multiple of SIMPLERANDOM_BATCH_ALIGN bytes from the start of the
+ * buffer.
+ *
+ * Initialising a batch doesn't change the contents of the buffer, so a buffer
+ * of previously saved batch states can be used directly. Otherwise, the
+ * generator states should be set with simplerandom_zzz_batch_scatter().
+ *
+ * The values generated by each generator in the batch are identical to the
+ * values generated by the same generator in the normal (scalar) API.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define BATCH_ALIGN_WORDS       (SIMPLERANDOM_BATCH_ALIGN / sizeof(uint32_t))
+
+/* Number of generators stepped in each vectorized block. */
+#define BATCH_BLOCK             16u
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Number of uint32_t words to allocate for each state word array, rounded up
+ * so that the next array is also aligned. Returns 0 on overflow.
+ */
+static size_t batch_stride(size_t num)
+{
+    if (num > SIZE_MAX - BATCH_ALIGN_WORDS)
+        return 0;
+    return (num + BATCH_ALIGN_WORDS - 1u) / BATCH_ALIGN_WORDS * BATCH_ALIGN_WORDS;
+}
+
+static size_t batch_buf_size(size_t num, size_t num_words)
+{
+    size_t      stride;
+
+    stride = batch_stride(num);
+    if (num != 0 && (stride == 0 || stride > SIZE_MAX / sizeof(uint32_t) / num_words))
+        return 0;
+    return stride * num_words * sizeof(uint32_t);
+}
+
+/* Set up the word array pointers into the buffer. Returns false if the
+ * buffer is too small.
+ */
+static bool batch_init(uint32_t ** pp_words, size_t num_words, void * p_buf, size_t buf_size, size_t num)
+{
+    uint32_t  * p_word_buf = (uint32_t *)p_buf;
+    size_t      stride;
+    size_t      required_size;
+    size_t      i;
+
+    required_size = batch_buf_size(num, num_words);
+    if (p_buf == NULL || (required_size == 0 && num != 0) || buf_size < required_size)
+        return false;
+
+    stride = batch_stride(num);
+    for (i = 0; i < num_words; i++)
+    {
+        pp_words[i] = p_word_buf + i * stride;
+    }
+    return true;
+}
+
+static inline uint32_t shr3_step(uint32_t shr3)
+{
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 5);
+    return shr3;
+}
+
+static inline uint32_t mwc_upper_step(uint32_t mwc_upper)
+{
+    return 36969u * (mwc_upper & 0xFFFFu) + (mwc_upper >> 16u);
+}
+
+static inline uint32_t mwc_lower_step(uint32_t mwc_lower)
+{
+    return 18000u * (mwc_lower & 0xFFFFu) + (mwc_lower >> 16u);
+}
+
+static inline uint32_t mwc2_value(uint32_t mwc_upper, uint32_t mwc_lower)
+{
+    return (mwc_upper << 16u) + (mwc_upper >> 16u) + mwc_lower;
+}
+
+static inline uint32_t cong_step(uint32_t cong)
+{
+    return UINT32_C(69069) * cong + 12345u;
+}
+
+static inline uint32_t lfsr113_z1_step(uint32_t z1)
+{
+    return ((z1 & UINT32_C(0xFFFFFFFE)) << 18) ^ (((z1 << 6) ^ z1) >> 13);
+}
+
+static inline uint32_t lfsr113_z2_step(uint32_t z2)
+{
+    return ((z2 & UINT32_C(0xFFFFFFF8)) << 2) ^ (((z2 << 2) ^ z2) >> 27);
+}
+
+static inline uint32_t lfsr113_z3_step(uint32_t z3)
+{
+    return ((z3 & UINT32_C(0xFFFFFFF0)) << 7) ^ (((z3 << 13) ^ z3) >> 21);
+}
+
+static inline uint32_t lfsr113_z4_step(uint32_t z4)
+{
+    return ((z4 & UINT32_C(0xFFFFFF80)) << 13) ^ (((z4 << 3) ^ z4) >> 12);
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*********
+ * SHR3
+ ********/
+
+size_t simplerandom_shr3_batch_buf_size(size_t num)
+{
+    return batch_buf_size(num, 1u);
+}
+
+bool simplerandom_shr3_batch_init(SimpleRandomSHR3Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num)
+{
+    uint32_t  * p_words[1];
+
+    if (!batch_init(p_words, 1u, p_buf, buf_size, num))
+        return false;
+    p_batch->num = num;
+    p_batch->p_shr3 = p_words[0];
+    return true;
+}
+
+static void shr3_batch_step(uint32_t * restrict p_shr3, size_t num)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            p_shr3[i + j] = shr3_step(p_shr3[i + j]);
+        }
+    }
+    for (; i < num; i++)
+    {
+        p_shr3[i] = shr3_step(p_shr3[i]);
+    }
+}
+
+static void shr3_batch_next(uint32_t * restrict p_shr3, uint32_t * restrict p_out, size_t num)
+{
+    uint32_t    shr3;
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            shr3 = shr3_step(p_shr3[i + j]);
+            p_shr3[i + j] = shr3;
+            p_out[i + j] = shr3;
+        }
+    }
+    for (; i < num; i++)
+    {
+        shr3 = shr3_step(p_shr3[i]);
+        p_shr3[i] = shr3;
+        p_out[i] = shr3;
+    }
+}
+
+void simplerandom_shr3_batch_step_all(SimpleRandomSHR3Batch_t * p_batch)
+{
+    shr3_batch_step(p_batch->p_shr3, p_batch->num);
+}
+
+void simplerandom_shr3_batch_next_all(SimpleRandomSHR3Batch_t * p_batch, uint32_t * p_out)
+{
+    shr3_batch_next(p_batch->p_shr3, p_out, p_batch->num);
+}
+
+/* Copy the states of the generators at the given indices out of the batch.
+ * If 'p_indices' is NULL, the first 'num_indices' generators are copied.
+ */
+void simplerandom_shr3_batch_gather(const SimpleRandomSHR3Batch_t * p_batch, SimpleRandomSHR3_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_states[i].shr3 = p_batch->p_shr3[j];
+    }
+}
+
+/* Copy the given states into the batch, at the given indices.
+ * If 'p_indices' is NULL, the first 'num_indices' generators are set.
+ */
+void simplerandom_shr3_batch_scatter(SimpleRandomSHR3Batch_t * p_batch, const SimpleRandomSHR3_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_batch->p_shr3[j] = p_states[i].shr3;
+    }
+}
+
+
+/*********
+ * MWC2
+ ********/
+
+size_t simplerandom_mwc2_batch_buf_size(size_t num)
+{
+    return batch_buf_size(num, 2u);
+}
+
+bool simplerandom_mwc2_batch_init(SimpleRandomMWC2Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num)
+{
+    uint32_t  * p_words[2];
+
+    if (!batch_init(p_words, 2u, p_buf, buf_size, num))
+        return false;
+    p_batch->num = num;
+    p_batch->p_mwc_upper = p_words[0];
+    p_batch->p_mwc_lower = p_words[1];
+    return true;
+}
+
+static void mwc2_batch_step(uint32_t * restrict p_mwc_upper, uint32_t * restrict p_mwc_lower, size_t num)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            p_mwc_upper[i + j] = mwc_upper_step(p_mwc_upper[i + j]);
+            p_mwc_lower[i + j] = mwc_lower_step(p_mwc_lower[i + j]);
+        }
+    }
+    for (; i < num; i++)
+    {
+        p_mwc_upper[i] = mwc_upper_step(p_mwc_upper[i]);
+        p_mwc_lower[i] = mwc_lower_step(p_mwc_lower[i]);
+    }
+}
+
+static void mwc2_batch_next(uint32_t * restrict p_mwc_upper, uint32_t * restrict p_mwc_lower, uint32_t * restrict p_out, size_t num)
+{
+    uint32_t    mwc_upper;
+    uint32_t    mwc_lower;
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            mwc_upper = mwc_upper_step(p_mwc_upper[i + j]);
+            mwc_lower = mwc_lower_step(p_mwc_lower[i + j]);
+            p_mwc_upper[i + j] = mwc_upper;
+            p_mwc_lower[i + j] = mwc_lower;
+            p_out[i + j] = mwc2_value(mwc_upper, mwc_lower);
+        }
+    }
+    for (; i < num; i++)
+    {
+        mwc_upper = mwc_upper_step(p_mwc_upper[i]);
+        mwc_lower = mwc_lower_step(p_mwc_lower[i]);
+        p_mwc_upper[i] = mwc_upper;
+        p_mwc_lower[i] = mwc_lower;
+        p_out[i] = mwc2_value(mwc_upper, mwc_lower);
+    }
+}
+
+void simplerandom_mwc2_batch_step_all(SimpleRandomMWC2Batch_t * p_batch)
+{
+    mwc2_batch_step(p_batch->p_mwc_upper, p_batch->p_mwc_lower, p_batch->num);
+}
+
+void simplerandom_mwc2_batch_next_all(SimpleRandomMWC2Batch_t * p_batch, uint32_t * p_out)
+{
+    mwc2_batch_next(p_batch->p_mwc_upper, p_batch->p_mwc_lower, p_out, p_batch->num);
+}
+
+void simplerandom_mwc2_batch_gather(const SimpleRandomMWC2Batch_t * p_batch, SimpleRandomMWC2_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_states[i].mwc_upper = p_batch->p_mwc_upper[j];
+        p_states[i].mwc_lower = p_batch->p_mwc_lower[j];
+    }
+}
+
+void simplerandom_mwc2_batch_scatter(SimpleRandomMWC2Batch_t * p_batch, const SimpleRandomMWC2_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_batch->p_mwc_upper[j] = p_states[i].mwc_upper;
+        p_batch->p_mwc_lower[j] = p_states[i].mwc_lower;
+    }
+}
+
+
+/*********
+ * KISS
+ ********/
+
+size_t simplerandom_kiss_batch_buf_size(size_t num)
+{
+    return batch_buf_size(num, 4u);
+}
+
+bool simplerandom_kiss_batch_init(SimpleRandomKISSBatch_t * p_batch, void * p_buf, size_t buf_size, size_t num)
+{
+    uint32_t  * p_words[4];
+
+    if (!batch_init(p_words, 4u, p_buf, buf_size, num))
+        return false;
+    p_batch->num = num;
+    p_batch->p_mwc_upper = p_words[0];
+    p_batch->p_mwc_lower = p_words[1];
+    p_batch->p_cong = p_words[2];
+    p_batch->p_shr3 = p_words[3];
+    return true;
+}
+
+static void kiss_batch_step(uint32_t * restrict p_mwc_upper, uint32_t * restrict p_mwc_lower, uint32_t * restrict p_cong, uint32_t * restrict p_shr3, size_t num)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            p_mwc_upper[i + j] = mwc_upper_step(p_mwc_upper[i + j]);
+            p_mwc_lower[i + j] = mwc_lower_step(p_mwc_lower[i + j]);
+            p_cong[i + j] = cong_step(p_cong[i + j]);
+            p_shr3[i + j] = shr3_step(p_shr3[i + j]);
+        }
+    }
+    for (; i < num; i++)
+    {
+        p_mwc_upper[i] = mwc_upper_step(p_mwc_upper[i]);
+        p_mwc_lower[i] = mwc_lower_step(p_mwc_lower[i]);
+        p_cong[i] = cong_step(p_cong[i]);
+        p_shr3[i] = shr3_step(p_shr3[i]);
+    }
+}
+
+static void kiss_batch_next(uint32_t * restrict p_mwc_upper, uint32_t * restrict p_mwc_lower, uint32_t * restrict p_cong, uint32_t * restrict p_shr3, uint32_t * restrict p_out, size_t num)
+{
+    uint32_t    mwc_upper;
+    uint32_t    mwc_lower;
+    uint32_t    cong;
+    uint32_t    shr3;
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            mwc_upper = mwc_upper_step(p_mwc_upper[i + j]);
+            mwc_lower = mwc_lower_step(p_mwc_lower[i + j]);
+            cong = cong_step(p_cong[i + j]);
+            shr3 = shr3_step(p_shr3[i + j]);
+            p_mwc_upper[i + j] = mwc_upper;
+            p_mwc_lower[i + j] = mwc_lower;
+            p_cong[i + j] = cong;
+            p_shr3[i + j] = shr3;
+            p_out[i + j] = (mwc2_value(mwc_upper, mwc_lower) ^ cong) + shr3;
+        }
+    }
+    for (; i < num; i++)
+    {
+        mwc_upper = mwc_upper_step(p_mwc_upper[i]);
+        mwc_lower = mwc_lower_step(p_mwc_lower[i]);
+        cong = cong_step(p_cong[i]);
+        shr3 = shr3_step(p_shr3[i]);
+        p_mwc_upper[i] = mwc_upper;
+        p_mwc_lower[i] = mwc_lower;
+        p_cong[i] = cong;
+        p_shr3[i] = shr3;
+        p_out[i] = (mwc2_value(mwc_upper, mwc_lower) ^ cong) + shr3;
+    }
+}
+
+void simplerandom_kiss_batch_step_all(SimpleRandomKISSBatch_t * p_batch)
+{
+    kiss_batch_step(p_batch->p_mwc_upper, p_batch->p_mwc_lower, p_batch->p_cong, p_batch->p_shr3, p_batch->num);
+}
+
+void simplerandom_kiss_batch_next_all(SimpleRandomKISSBatch_t * p_batch, uint32_t * p_out)
+{
+    kiss_batch_next(p_batch->p_mwc_upper, p_batch->p_mwc_lower, p_batch->p_cong, p_batch->p_shr3, p_out, p_batch->num);
+}
+
+void simplerandom_kiss_batch_gather(const SimpleRandomKISSBatch_t * p_batch, SimpleRandomKISS_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_states[i].mwc_upper = p_batch->p_mwc_upper[j];
+        p_states[i].mwc_lower = p_batch->p_mwc_lower[j];
+        p_states[i].cong = p_batch->p_cong[j];
+        p_states[i].shr3 = p_batch->p_shr3[j];
+    }
+}
+
+void simplerandom_kiss_batch_scatter(SimpleRandomKISSBatch_t * p_batch, const SimpleRandomKISS_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_batch->p_mwc_upper[j] = p_states[i].mwc_upper;
+        p_batch->p_mwc_lower[j] = p_states[i].mwc_lower;
+        p_batch->p_cong[j] = p_states[i].cong;
+        p_batch->p_shr3[j] = p_states[i].shr3;
+    }
+}
+
+
+/*********
+ * LFSR113
+ ********/
+
+size_t simplerandom_lfsr113_batch_buf_size(size_t num)
+{
+    return batch_buf_size(num, 4u);
+}
+
+bool simplerandom_lfsr113_batch_init(SimpleRandomLFSR113Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num)
+{
+    uint32_t  * p_words[4];
+
+    if (!batch_init(p_words, 4u, p_buf, buf_size, num))
+        return false;
+    p_batch->num = num;
+    p_batch->p_z1 = p_words[0];
+    p_batch->p_z2 = p_words[1];
+    p_batch->p_z3 = p_words[2];
+    p_batch->p_z4 = p_words[3];
+    return true;
+}
+
+static void lfsr113_batch_step(uint32_t * restrict p_z1, uint32_t * restrict p_z2, uint32_t * restrict p_z3, uint32_t * restrict p_z4, size_t num)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            p_z1[i + j] = lfsr113_z1_step(p_z1[i + j]);
+            p_z2[i + j] = lfsr113_z2_step(p_z2[i + j]);
+            p_z3[i + j] = lfsr113_z3_step(p_z3[i + j]);
+            p_z4[i + j] = lfsr113_z4_step(p_z4[i + j]);
+        }
+    }
+    for (; i < num; i++)
+    {
+        p_z1[i] = lfsr113_z1_step(p_z1[i]);
+        p_z2[i] = lfsr113_z2_step(p_z2[i]);
+        p_z3[i] = lfsr113_z3_step(p_z3[i]);
+        p_z4[i] = lfsr113_z4_step(p_z4[i]);
+    }
+}
+
+static void lfsr113_batch_next(uint32_t * restrict p_z1, uint32_t * restrict p_z2, uint32_t * restrict p_z3, uint32_t * restrict p_z4, uint32_t * restrict p_out, size_t num)
+{
+    uint32_t    z1;
+    uint32_t    z2;
+    uint32_t    z3;
+    uint32_t    z4;
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i + BATCH_BLOCK <= num; i += BATCH_BLOCK)
+    {
+        for (j = 0; j < BATCH_BLOCK; j++)
+        {
+            z1 = lfsr113_z1_step(p_z1[i + j]);
+            z2 = lfsr113_z2_step(p_z2[i + j]);
+            z3 = lfsr113_z3_step(p_z3[i + j]);
+            z4 = lfsr113_z4_step(p_z4[i + j]);
+            p_z1[i + j] = z1;
+            p_z2[i + j] = z2;
+            p_z3[i + j] = z3;
+            p_z4[i + j] = z4;
+            p_out[i + j] = z1 ^ z2 ^ z3 ^ z4;
+        }
+    }
+    for (; i < num; i++)
+    {
+        z1 = lfsr113_z1_step(p_z1[i]);
+        z2 = lfsr113_z2_step(p_z2[i]);
+        z3 = lfsr113_z3_step(p_z3[i]);
+        z4 = lfsr113_z4_step(p_z4[i]);
+        p_z1[i] = z1;
+        p_z2[i] = z2;
+        p_z3[i] = z3;
+        p_z4[i] = z4;
+        p_out[i] = z1 ^ z2 ^ z3 ^ z4;
+    }
+}
+
+void simplerandom_lfsr113_batch_step_all(SimpleRandomLFSR113Batch_t * p_batch)
+{
+    lfsr113_batch_step(p_batch->p_z1, p_batch->p_z2, p_batch->p_z3, p_batch->p_z4, p_batch->num);
+}
+
+void simplerandom_lfsr113_batch_next_all(SimpleRandomLFSR113Batch_t * p_batch, uint32_t * p_out)
+{
+    lfsr113_batch_next(p_batch->p_z1, p_batch->p_z2, p_batch->p_z3, p_batch->p_z4, p_out, p_batch->num);
+}
+
+void simplerandom_lfsr113_batch_gather(const SimpleRandomLFSR113Batch_t * p_batch, SimpleRandomLFSR113_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_states[i].z1 = p_batch->p_z1[j];
+        p_states[i].z2 = p_batch->p_z2[j];
+        p_states[i].z3 = p_batch->p_z3[j];
+        p_states[i].z4 = p_batch->p_z4[j];
+    }
+}
+
+void simplerandom_lfsr113_batch_scatter(SimpleRandomLFSR113Batch_t * p_batch, const SimpleRandomLFSR113_t * p_states, const size_t * p_indices, size_t num_indices)
+{
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < num_indices; i++)
+    {
+        j = (p_indices != NULL) ? p_indices[i] : i;
+        p_batch->p_z1[j] = p_states[i].z1;
+        p_batch->p_z2[j] = p_states[i].z2;
+        p_batch->p_z3[j] = p_states[i].z3;
+        p_batch->p_z4[j] = p_states[i].z4;
+    }
+}
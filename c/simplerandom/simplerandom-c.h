@@ -16,6 +16,49 @@
  *         Seed the generator with a number of unsigned 32-bit seed values.
  *         The number of seed values depends on the generator, and is given
  *         by simplerandom_zzz_num_seeds().
+ *     simplerandom_zzz_seed_batch(states, seeds, count)
+ *         Seed an array of 'count' generators, from an array holding
+ *         simplerandom_zzz_num_seeds() seed values for each generator. The
+ *         states are the same as from simplerandom_zzz_seed().
+ *     simplerandom_zzz_next()
+ *         Generate the next unsigned 32-bit random value.
+ *     simplerandom_zzz_fill(p_out, num_out)
+ *         Generate a number of random values into an array. The values are
+ *         the same as given by repeated calls to simplerandom_zzz_next().
+ *     simplerandom_zzz_next64()
+ *         Generate an unsigned 64-bit random value, from the next two 32-bit
+ *         values. The first 32-bit value is the low word of the result.
+ *     simplerandom_zzz_fill64(p_out, num_out)
+ *         Generate a number of 64-bit random values into an array. The values
+ *         are the same as given by repeated calls to simplerandom_zzz_next64().
+ *     simplerandom_zzz_fill_multi(states, num_states, p_out, num_out)
+ *         Generate 'num_out' values from each of an array of 'num_states'
+ *         generators. Generator k's values are at p_out[k * num_out]
+ *         onwards. The values are the same as from simplerandom_zzz_fill()
+ *         for each generator, but several generators are stepped together,
+ *         which is faster on CPUs that can run independent instructions in
+ *         parallel.
+ *     simplerandom_zzz_mix(p_data, num_data)
+ *         Mix data words into the generator state, one word at a time.
+ *     simplerandom_zzz_mix_bulk(p_data, num_data)
+ *         Mix a large amount of data into the generator state, by hashing it
+ *         and mixing in the hash. See simplerandom-hash.c.
+ *     simplerandom_zzz_discard(n)
+ *         Advance the generator by 'n' values, as if by 'n' calls of
+ *         simplerandom_zzz_next(), but much faster for large 'n'.
+ *
+ * with these exceptions:
+ *
+ *     KISS64
+ *         simplerandom_kiss64_next() and simplerandom_kiss64_fill() give
+ *         64-bit values, and there is no 32-bit next() or fill(), and no
+ *         next64(), fill64() or fill_multi(). The seeds of
+ *         simplerandom_kiss64_seed() are 64-bit values. For seed_array() and
+ *         seed_batch(), each is given as two 32-bit values, low word first.
+ *     CMWC4096, LFIB4, SWB
+ *         These have only seed(), seed_array(), num_seeds(), sanitize(),
+ *         next(), fill(), mix(), mix_bulk() and mix_hash(). There is no
+ *         seed_batch(), next64(), fill64(), fill_multi() or discard().
  *
  * Most of these are from two newsgroup posts by George Marsaglia.
  *
@@ -48,10 +91,24 @@
  *     Cong
  *     SHR3
  *     KISS2
+ * A later post in 2003 gave the complementary multiply-with-carry generator
+ *     CMWC4096
+ * which has a table of 4096 state values and a very long period.
+ *
+ * The third Marsaglia post was in 2009 [5]. From that newsgroup post, the
+ * following RNG is defined:
+ *     KISS64
+ * It is made of 64-bit MWC, SHR3 and Cong components, and outputs 64-bit
+ * values.
  *
  * The LFSR113 generator by L'Ecuyer is also implemented
  * [4], along with his earlier LFSR88.
  *
+ * Also from the 1999 post are the lagged-Fibonacci generators LFIB4 and SWB,
+ * which have a table of 256 state values. They are fast for bulk generation,
+ * because many values can be calculated at once from the table, but they are
+ * not as good quality as the other generators.
+ *
  * Some generators naturally have "bad" seed values, which if used will
  * not output a good-quality sequence. The most obvious is zero values for the
  * SHR3, MWC and LFSR generators, yielding constant zero output. But there are
@@ -60,8 +117,8 @@
  * So it is essential to avoid seeding the generators with any bad seed values.
  * The seed functions for all these generators take care of any "bad" seed
  * values, replacing them with a good alternative seed. So all these
- * generators' seed functions can safely be given _any_ unsigned 32-bit seed
- * values.
+ * generators' seed functions can safely be given _any_ seed values: any
+ * unsigned 32-bit values, or for KISS64, any unsigned 64-bit values.
  *
  * References:
  *
@@ -84,6 +141,10 @@
  *     Pierre L'Ecuyer
  *     http://citeseerx.ist.psu.edu/viewdoc/summary?doi=10.1.1.43.3639
  *     http://www.iro.umontreal.ca/~simardr/rng/lfsr113.c
+ *
+ * [5] 64-bit KISS RNGs
+ *     George Marsaglia
+ *     Newsgroup post, sci.math, Feb 2009
  */
 
 #ifndef _SIMPLERANDOM_C_H
@@ -149,6 +210,26 @@ typedef struct
     uint32_t        shr3;
 } SimpleRandomKISS2_t;
 
+typedef struct
+{
+    uint64_t        mwc_upper;
+    uint64_t        mwc_lower;
+    uint64_t        cong;
+    uint64_t        shr3;
+} SimpleRandomKISS64_t;
+
+/* 'q' is a circular buffer of the last SIMPLERANDOM_CMWC4096_LAG values, and
+ * q[index] is the latest value.
+ */
+#define SIMPLERANDOM_CMWC4096_LAG           4096u
+
+typedef struct
+{
+    uint32_t        q[SIMPLERANDOM_CMWC4096_LAG];
+    uint32_t        c;
+    uint32_t        index;
+} SimpleRandomCMWC4096_t;
+
 #endif /* defined(UINT64_C) */
 
 typedef struct
@@ -166,6 +247,152 @@ typedef struct
     uint32_t        z3;
 } SimpleRandomLFSR88_t;
 
+/* Lagged-Fibonacci generators. 't' is a circular buffer of the last
+ * SIMPLERANDOM_LAG_TABLE_SIZE values, and t[index] is the latest value.
+ */
+#define SIMPLERANDOM_LAG_TABLE_SIZE         256u
+
+typedef struct
+{
+    uint32_t        t[SIMPLERANDOM_LAG_TABLE_SIZE];
+    uint32_t        index;
+} SimpleRandomLFIB4_t;
+
+typedef struct
+{
+    uint32_t        t[SIMPLERANDOM_LAG_TABLE_SIZE];
+    uint32_t        index;
+    uint32_t        borrow;
+} SimpleRandomSWB_t;
+
+/* Batches of generators, in "structure of arrays" layout.
+ * See simplerandom-batch.c.
+ */
+typedef struct
+{
+    size_t          num;
+    uint32_t      * p_shr3;
+} SimpleRandomSHR3Batch_t;
+
+typedef struct
+{
+    size_t          num;
+    uint32_t      * p_mwc_upper;
+    uint32_t      * p_mwc_lower;
+} SimpleRandomMWC2Batch_t;
+
+typedef struct
+{
+    size_t          num;
+    uint32_t      * p_mwc_upper;
+    uint32_t      * p_mwc_lower;
+    uint32_t      * p_cong;
+    uint32_t      * p_shr3;
+} SimpleRandomKISSBatch_t;
+
+typedef struct
+{
+    size_t          num;
+    uint32_t      * p_z1;
+    uint32_t      * p_z2;
+    uint32_t      * p_z3;
+    uint32_t      * p_z4;
+} SimpleRandomLFSR113Batch_t;
+
+/* Multi-lane generators, with lane-interleaved output.
+ * See simplerandom-lanes.c.
+ */
+#define SIMPLERANDOM_LANES                  16u
+
+typedef struct
+{
+    uint32_t        cong[SIMPLERANDOM_LANES];
+    size_t          next_lane;
+} SimpleRandomCongLanes_t;
+
+typedef struct
+{
+    uint32_t        mwc_upper[SIMPLERANDOM_LANES];
+    uint32_t        mwc_lower[SIMPLERANDOM_LANES];
+    size_t          next_lane;
+} SimpleRandomMWC2Lanes_t;
+
+typedef SimpleRandomMWC2Lanes_t SimpleRandomMWC1Lanes_t;
+
+#ifdef UINT64_C
+
+typedef struct
+{
+    uint32_t        mwc_upper[SIMPLERANDOM_LANES];
+    uint32_t        mwc_lower[SIMPLERANDOM_LANES];
+    size_t          next_lane;
+} SimpleRandomMWC64Lanes_t;
+
+#endif /* defined(UINT64_C) */
+
+/* Incremental hash of data to be mixed into a generator.
+ * See simplerandom-hash.c.
+ */
+#define SIMPLERANDOM_MIX_HASH_LANES         16u
+
+typedef struct
+{
+    uint32_t        lanes[SIMPLERANDOM_MIX_HASH_LANES];
+    uint32_t        buf[SIMPLERANDOM_MIX_HASH_LANES];
+    uintmax_t       num_words;
+} SimpleRandomMixHash_t;
+
+/* Generator type tags, used in the binary state encoding.
+ * These values are stored in saved state data, so they must never change.
+ */
+typedef enum
+{
+    SIMPLERANDOM_TYPE_NONE      = 0,
+    SIMPLERANDOM_TYPE_CONG      = 1,
+    SIMPLERANDOM_TYPE_SHR3      = 2,
+    SIMPLERANDOM_TYPE_MWC1      = 3,
+    SIMPLERANDOM_TYPE_MWC2      = 4,
+    SIMPLERANDOM_TYPE_KISS      = 5,
+    SIMPLERANDOM_TYPE_MWC64     = 6,
+    SIMPLERANDOM_TYPE_KISS2     = 7,
+    SIMPLERANDOM_TYPE_LFSR113   = 8,
+    SIMPLERANDOM_TYPE_LFSR88    = 9,
+    SIMPLERANDOM_TYPE_KISS64    = 10,
+    SIMPLERANDOM_TYPE_LFIB4     = 11,
+    SIMPLERANDOM_TYPE_SWB       = 12,
+    SIMPLERANDOM_TYPE_CMWC4096  = 13,
+} SimpleRandomType_t;
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Binary state encoding. See simplerandom-state.c for the layout. */
+#define SIMPLERANDOM_STATE_VERSION          2u
+#define SIMPLERANDOM_STATE_HEADER_SIZE      32u
+/* Error return of the state array functions that return a number of states. */
+#define SIMPLERANDOM_STATE_ERROR            SIZE_MAX
+
+/* Recommended alignment of generator batch buffers, in bytes. */
+#define SIMPLERANDOM_BATCH_ALIGN            64u
+
+/* Number of seed words of each generator, as returned by
+ * simplerandom_zzz_num_seeds(). */
+#define SIMPLERANDOM_CONG_NUM_SEEDS         1u
+#define SIMPLERANDOM_SHR3_NUM_SEEDS         1u
+#define SIMPLERANDOM_MWC1_NUM_SEEDS         2u
+#define SIMPLERANDOM_MWC2_NUM_SEEDS         2u
+#define SIMPLERANDOM_KISS_NUM_SEEDS         4u
+#define SIMPLERANDOM_MWC64_NUM_SEEDS        2u
+#define SIMPLERANDOM_KISS2_NUM_SEEDS        4u
+#define SIMPLERANDOM_KISS64_NUM_SEEDS       8u
+#define SIMPLERANDOM_CMWC4096_NUM_SEEDS     4u
+#define SIMPLERANDOM_LFSR113_NUM_SEEDS      4u
+#define SIMPLERANDOM_LFSR88_NUM_SEEDS       3u
+#define SIMPLERANDOM_LFIB4_NUM_SEEDS        4u
+#define SIMPLERANDOM_SWB_NUM_SEEDS          4u
+
 
 /*****************************************************************************
  * Function prototypes
@@ -194,9 +421,18 @@ extern "C" {
 size_t simplerandom_cong_num_seeds(const SimpleRandomCong_t * p_cong);
 size_t simplerandom_cong_seed_array(SimpleRandomCong_t * p_cong, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_cong_seed(SimpleRandomCong_t * p_cong, uint32_t seed);
+void simplerandom_cong_seed_batch(SimpleRandomCong_t * p_cong, const uint32_t * p_seeds, size_t count);
 void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong);
 void simplerandom_cong_mix(SimpleRandomCong_t * p_cong, const uint32_t * p_data, size_t num_data);
+void simplerandom_cong_mix_bulk(SimpleRandomCong_t * p_cong, const uint32_t * p_data, size_t num_data);
+void simplerandom_cong_mix_hash(SimpleRandomCong_t * p_cong, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong);
+void simplerandom_cong_fill(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out);
+void simplerandom_cong_fill_multi(SimpleRandomCong_t * p_cong, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_cong_next64(SimpleRandomCong_t * p_cong);
+void simplerandom_cong_fill64(SimpleRandomCong_t * p_cong, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_cong_discard(SimpleRandomCong_t * p_cong, uintmax_t n);
 
 /* SHR3 -- 3-shift-register random number generator
@@ -225,9 +461,18 @@ void simplerandom_cong_discard(SimpleRandomCong_t * p_cong, uintmax_t n);
 size_t simplerandom_shr3_num_seeds(const SimpleRandomSHR3_t * p_shr3);
 size_t simplerandom_shr3_seed_array(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_shr3_seed(SimpleRandomSHR3_t * p_shr3, uint32_t seed);
+void simplerandom_shr3_seed_batch(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_seeds, size_t count);
 void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3);
 void simplerandom_shr3_mix(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data, size_t num_data);
+void simplerandom_shr3_mix_bulk(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data, size_t num_data);
+void simplerandom_shr3_mix_hash(SimpleRandomSHR3_t * p_shr3, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3);
+void simplerandom_shr3_fill(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out);
+void simplerandom_shr3_fill_multi(SimpleRandomSHR3_t * p_shr3, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_shr3_next64(SimpleRandomSHR3_t * p_shr3);
+void simplerandom_shr3_fill64(SimpleRandomSHR3_t * p_shr3, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_shr3_discard(SimpleRandomSHR3_t * p_shr3, uintmax_t n);
 
 /* MWC1 -- "Multiply-with-carry" random number generator
@@ -256,9 +501,18 @@ void simplerandom_shr3_discard(SimpleRandomSHR3_t * p_shr3, uintmax_t n);
 size_t simplerandom_mwc1_num_seeds(const SimpleRandomMWC1_t * p_mwc);
 size_t simplerandom_mwc1_seed_array(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc1_seed(SimpleRandomMWC1_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
+void simplerandom_mwc1_seed_batch(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_seeds, size_t count);
 void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc);
 void simplerandom_mwc1_mix(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc1_mix_bulk(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc1_mix_hash(SimpleRandomMWC1_t * p_mwc, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_fill(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc1_fill_multi(SimpleRandomMWC1_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_mwc1_next64(SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_fill64(SimpleRandomMWC1_t * p_mwc, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_mwc1_discard(SimpleRandomMWC1_t * p_mwc, uintmax_t n);
 
 static inline uint32_t mwc1_current(SimpleRandomMWC1_t * p_mwc)
@@ -280,9 +534,18 @@ static inline uint32_t mwc1_current(SimpleRandomMWC1_t * p_mwc)
 size_t simplerandom_mwc2_num_seeds(const SimpleRandomMWC2_t * p_mwc);
 size_t simplerandom_mwc2_seed_array(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc2_seed(SimpleRandomMWC2_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
+void simplerandom_mwc2_seed_batch(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_seeds, size_t count);
 void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc);
 void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc2_mix_bulk(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc2_mix_hash(SimpleRandomMWC2_t * p_mwc, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_fill(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc2_fill_multi(SimpleRandomMWC2_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_mwc2_next64(SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_fill64(SimpleRandomMWC2_t * p_mwc, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_mwc2_discard(SimpleRandomMWC2_t * p_mwc, uintmax_t n);
 
 static inline uint32_t mwc2_current(SimpleRandomMWC2_t * p_mwc)
@@ -307,9 +570,18 @@ static inline uint32_t mwc2_current(SimpleRandomMWC2_t * p_mwc)
 size_t simplerandom_kiss_num_seeds(const SimpleRandomKISS_t * );
 size_t simplerandom_kiss_seed_array(SimpleRandomKISS_t * p_kiss, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_kiss_seed(SimpleRandomKISS_t * p_kiss, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
+void simplerandom_kiss_seed_batch(SimpleRandomKISS_t * p_kiss, const uint32_t * p_seeds, size_t count);
 void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss);
 void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss_mix_bulk(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss_mix_hash(SimpleRandomKISS_t * p_kiss, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss);
+void simplerandom_kiss_fill(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out);
+void simplerandom_kiss_fill_multi(SimpleRandomKISS_t * p_kiss, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_kiss_next64(SimpleRandomKISS_t * p_kiss);
+void simplerandom_kiss_fill64(SimpleRandomKISS_t * p_kiss, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_kiss_discard(SimpleRandomKISS_t * p_kiss, uintmax_t n);
 
 static inline uint32_t kiss_current(SimpleRandomKISS_t * p_kiss)
@@ -339,9 +611,16 @@ static inline uint32_t kiss_current(SimpleRandomKISS_t * p_kiss)
 size_t simplerandom_mwc64_num_seeds(const SimpleRandomMWC64_t * p_mwc);
 size_t simplerandom_mwc64_seed_array(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc64_seed(SimpleRandomMWC64_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
+void simplerandom_mwc64_seed_batch(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_seeds, size_t count);
 void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc);
 void simplerandom_mwc64_mix(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc64_mix_bulk(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_mwc64_mix_hash(SimpleRandomMWC64_t * p_mwc, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_fill(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc64_fill_multi(SimpleRandomMWC64_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out);
+uint64_t simplerandom_mwc64_next64(SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_fill64(SimpleRandomMWC64_t * p_mwc, uint64_t * p_out, size_t num_out);
 void simplerandom_mwc64_discard(SimpleRandomMWC64_t * p_mwc, uintmax_t n);
 
 /* KISS2 -- "Keep It Simple Stupid" random number generator
@@ -358,9 +637,16 @@ void simplerandom_mwc64_discard(SimpleRandomMWC64_t * p_mwc, uintmax_t n);
 size_t simplerandom_kiss2_num_seeds(const SimpleRandomKISS2_t * p_kiss2);
 size_t simplerandom_kiss2_seed_array(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_kiss2_seed(SimpleRandomKISS2_t * p_kiss2, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
+void simplerandom_kiss2_seed_batch(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_seeds, size_t count);
 void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2);
 void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss2_mix_bulk(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss2_mix_hash(SimpleRandomKISS2_t * p_kiss2, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2_fill(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out);
+void simplerandom_kiss2_fill_multi(SimpleRandomKISS2_t * p_kiss2, size_t num_states, uint32_t * p_out, size_t num_out);
+uint64_t simplerandom_kiss2_next64(SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2_fill64(SimpleRandomKISS2_t * p_kiss2, uint64_t * p_out, size_t num_out);
 void simplerandom_kiss2_discard(SimpleRandomKISS2_t * p_kiss2, uintmax_t n);
 
 static inline uint32_t kiss2_current(SimpleRandomKISS2_t * p_kiss2)
@@ -368,6 +654,64 @@ static inline uint32_t kiss2_current(SimpleRandomKISS2_t * p_kiss2)
     return (p_kiss2->mwc_lower + p_kiss2->cong + p_kiss2->shr3);
 }
 
+/* KISS64 -- "Keep It Simple Stupid" random number generator
+ *
+ * It combines 64-bit MWC, SHR3 and Cong generators. The
+ * MWC has multiplier 2^58+1 and base 2^64. Period is
+ * about 2^249.
+ *
+ * This is Marsaglia's 64-bit KISS generator, from the
+ * newsgroup post in 2009. All the state and calculations
+ * are 64-bit, so simplerandom_kiss64_next() and
+ * simplerandom_kiss64_fill() give 64-bit values, twice
+ * the random bits per step of KISS2.
+ *
+ * The seeds are 64-bit values. For _seed_array() and
+ * _seed_batch(), each 64-bit seed is given as two 32-bit
+ * values, low word first.
+ */
+size_t simplerandom_kiss64_num_seeds(const SimpleRandomKISS64_t * p_kiss64);
+size_t simplerandom_kiss64_seed_array(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
+void simplerandom_kiss64_seed(SimpleRandomKISS64_t * p_kiss64, uint64_t seed_mwc_upper, uint64_t seed_mwc_lower, uint64_t seed_cong, uint64_t seed_shr3);
+void simplerandom_kiss64_seed_batch(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_seeds, size_t count);
+void simplerandom_kiss64_sanitize(SimpleRandomKISS64_t * p_kiss64);
+void simplerandom_kiss64_mix(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss64_mix_bulk(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_data, size_t num_data);
+void simplerandom_kiss64_mix_hash(SimpleRandomKISS64_t * p_kiss64, SimpleRandomMixHash_t * p_hash);
+uint64_t simplerandom_kiss64_next(SimpleRandomKISS64_t * p_kiss64);
+void simplerandom_kiss64_fill(SimpleRandomKISS64_t * p_kiss64, uint64_t * p_out, size_t num_out);
+void simplerandom_kiss64_discard(SimpleRandomKISS64_t * p_kiss64, uintmax_t n);
+
+static inline uint64_t kiss64_current(SimpleRandomKISS64_t * p_kiss64)
+{
+    return (p_kiss64->mwc_lower + p_kiss64->shr3 + p_kiss64->cong);
+}
+
+/* CMWC4096 -- Complementary multiply-with-carry random number generator
+ *
+ * From a 2003 newsgroup post by Marsaglia. It is a lag-4096
+ * CMWC with multiplier 18782 and base 2^32-1:
+ *     x[n] = (b-1) - (18782 * x[n-4096] + c) mod b
+ * The period is about 2^131104.
+ *
+ * Unlike the lag-1 MWCs, the multiply of each step uses
+ * a value from 4096 steps before, so only the carry add
+ * is serial, and the CPU can overlap the steps in
+ * simplerandom_cmwc4096_fill().
+ *
+ * The seeds are the same as for KISS. The table and
+ * initial carry are filled with values from KISS.
+ */
+size_t simplerandom_cmwc4096_num_seeds(const SimpleRandomCMWC4096_t * p_cmwc);
+size_t simplerandom_cmwc4096_seed_array(SimpleRandomCMWC4096_t * p_cmwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
+void simplerandom_cmwc4096_seed(SimpleRandomCMWC4096_t * p_cmwc, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
+void simplerandom_cmwc4096_sanitize(SimpleRandomCMWC4096_t * p_cmwc);
+void simplerandom_cmwc4096_mix(SimpleRandomCMWC4096_t * p_cmwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_cmwc4096_mix_bulk(SimpleRandomCMWC4096_t * p_cmwc, const uint32_t * p_data, size_t num_data);
+void simplerandom_cmwc4096_mix_hash(SimpleRandomCMWC4096_t * p_cmwc, SimpleRandomMixHash_t * p_hash);
+uint32_t simplerandom_cmwc4096_next(SimpleRandomCMWC4096_t * p_cmwc);
+void simplerandom_cmwc4096_fill(SimpleRandomCMWC4096_t * p_cmwc, uint32_t * p_out, size_t num_out);
+
 #endif /* defined(UINT64_C) */
 
 
@@ -386,9 +730,18 @@ static inline uint32_t kiss2_current(SimpleRandomKISS2_t * p_kiss2)
 size_t simplerandom_lfsr113_num_seeds(const SimpleRandomLFSR113_t * p_lfsr113);
 size_t simplerandom_lfsr113_seed_array(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_z1, uint32_t seed_z2, uint32_t seed_z3, uint32_t seed_z4);
+void simplerandom_lfsr113_seed_batch(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_seeds, size_t count);
 void simplerandom_lfsr113_sanitize(SimpleRandomLFSR113_t * p_lfsr113);
 void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfsr113_mix_bulk(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfsr113_mix_hash(SimpleRandomLFSR113_t * p_lfsr113, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113_fill(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out);
+void simplerandom_lfsr113_fill_multi(SimpleRandomLFSR113_t * p_lfsr113, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_lfsr113_next64(SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113_fill64(SimpleRandomLFSR113_t * p_lfsr113, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_lfsr113_discard(SimpleRandomLFSR113_t * p_lfsr113, uintmax_t n);
 
 /* LFSR88 -- Combined LFSR random number generator by L'Ecuyer
@@ -405,11 +758,235 @@ void simplerandom_lfsr113_discard(SimpleRandomLFSR113_t * p_lfsr113, uintmax_t n
 size_t simplerandom_lfsr88_num_seeds(const SimpleRandomLFSR88_t * p_lfsr88);
 size_t simplerandom_lfsr88_seed_array(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1, uint32_t seed_z2, uint32_t seed_z3);
+void simplerandom_lfsr88_seed_batch(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_seeds, size_t count);
 void simplerandom_lfsr88_sanitize(SimpleRandomLFSR88_t * p_lfsr88);
 void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfsr88_mix_bulk(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfsr88_mix_hash(SimpleRandomLFSR88_t * p_lfsr88, SimpleRandomMixHash_t * p_hash);
 uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88);
+void simplerandom_lfsr88_fill(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out);
+void simplerandom_lfsr88_fill_multi(SimpleRandomLFSR88_t * p_lfsr88, size_t num_states, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+uint64_t simplerandom_lfsr88_next64(SimpleRandomLFSR88_t * p_lfsr88);
+void simplerandom_lfsr88_fill64(SimpleRandomLFSR88_t * p_lfsr88, uint64_t * p_out, size_t num_out);
+#endif
 void simplerandom_lfsr88_discard(SimpleRandomLFSR88_t * p_lfsr88, uintmax_t n);
 
+/* LFIB4 -- Lagged-Fibonacci random number generator
+ *
+ * From Marsaglia's 1999 newsgroup post:
+ *     t[n] = t[n-256] + t[n-198] + t[n-137] + t[n-78] mod 2^32
+ * (Marsaglia's comment gives the lags as 256, 179, 119, 55, but
+ * these are the lags of his LFIB4 macro.)
+ *
+ * Marsaglia gives the period as about 2^287.
+ *
+ * The seeds are the same as for KISS. The table is filled
+ * with values from Marsaglia's 1999 KISS, which combines
+ * MWC1, Cong and SHR3. So with the seeds of his test program,
+ * the values are the same as his LFIB4 macro.
+ */
+size_t simplerandom_lfib4_num_seeds(const SimpleRandomLFIB4_t * p_lfib4);
+size_t simplerandom_lfib4_seed_array(SimpleRandomLFIB4_t * p_lfib4, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
+void simplerandom_lfib4_seed(SimpleRandomLFIB4_t * p_lfib4, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
+void simplerandom_lfib4_sanitize(SimpleRandomLFIB4_t * p_lfib4);
+void simplerandom_lfib4_mix(SimpleRandomLFIB4_t * p_lfib4, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfib4_mix_bulk(SimpleRandomLFIB4_t * p_lfib4, const uint32_t * p_data, size_t num_data);
+void simplerandom_lfib4_mix_hash(SimpleRandomLFIB4_t * p_lfib4, SimpleRandomMixHash_t * p_hash);
+uint32_t simplerandom_lfib4_next(SimpleRandomLFIB4_t * p_lfib4);
+void simplerandom_lfib4_fill(SimpleRandomLFIB4_t * p_lfib4, uint32_t * p_out, size_t num_out);
+
+/* SWB -- Subtract-with-borrow random number generator
+ *
+ * From Marsaglia's 1999 newsgroup post:
+ *     t[n] = t[n-222] - t[n-237] - borrow mod 2^32
+ *
+ * Marsaglia gives the period as about 2^7578.
+ *
+ * Seeding is as for LFIB4, with the borrow starting at 0.
+ */
+size_t simplerandom_swb_num_seeds(const SimpleRandomSWB_t * p_swb);
+size_t simplerandom_swb_seed_array(SimpleRandomSWB_t * p_swb, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
+void simplerandom_swb_seed(SimpleRandomSWB_t * p_swb, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
+void simplerandom_swb_sanitize(SimpleRandomSWB_t * p_swb);
+void simplerandom_swb_mix(SimpleRandomSWB_t * p_swb, const uint32_t * p_data, size_t num_data);
+void simplerandom_swb_mix_bulk(SimpleRandomSWB_t * p_swb, const uint32_t * p_data, size_t num_data);
+void simplerandom_swb_mix_hash(SimpleRandomSWB_t * p_swb, SimpleRandomMixHash_t * p_hash);
+uint32_t simplerandom_swb_next(SimpleRandomSWB_t * p_swb);
+void simplerandom_swb_fill(SimpleRandomSWB_t * p_swb, uint32_t * p_out, size_t num_out);
+
+/* Multi-lane generators
+ *
+ * SIMPLERANDOM_LANES copies of a generator, started at evenly spaced points
+ * of the generator's sequence, and stepped together with SIMD operations.
+ * For generator 'zzz':
+ *
+ *     simplerandom_zzz_lanes_init(p_lanes, p_zzz)
+ *         Start lane 0 at the state of 'p_zzz'. Each following lane starts
+ *         (period / SIMPLERANDOM_LANES) values further on.
+ *     simplerandom_zzz_lanes_fill(p_lanes, p_out, num_out)
+ *         Generate lane-interleaved values: value i is from lane
+ *         (i % SIMPLERANDOM_LANES). The output doesn't depend on how it is
+ *         split into calls.
+ *     simplerandom_zzz_lanes_fill_blocked(p_lanes, p_out, num_per_lane)
+ *         Generate 'num_per_lane' values from each lane, lane-blocked: value
+ *         k of lane j goes to p_out[j * num_per_lane + k]. Each lane continues
+ *         its own sequence. Only for MWC64.
+ */
+void simplerandom_cong_lanes_init(SimpleRandomCongLanes_t * p_lanes, const SimpleRandomCong_t * p_cong);
+void simplerandom_cong_lanes_fill(SimpleRandomCongLanes_t * p_lanes, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc1_lanes_init(SimpleRandomMWC1Lanes_t * p_lanes, const SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_lanes_fill(SimpleRandomMWC1Lanes_t * p_lanes, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc2_lanes_init(SimpleRandomMWC2Lanes_t * p_lanes, const SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_lanes_fill(SimpleRandomMWC2Lanes_t * p_lanes, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+void simplerandom_mwc64_lanes_init(SimpleRandomMWC64Lanes_t * p_lanes, const SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_lanes_fill(SimpleRandomMWC64Lanes_t * p_lanes, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc64_lanes_fill_blocked(SimpleRandomMWC64Lanes_t * p_lanes, uint32_t * p_out, size_t num_per_lane);
+#endif
+
+/* Incremental hash for mixing data into generators
+ *
+ * For mixing data that isn't all available at once, or to mix the same data
+ * into several generators:
+ *
+ *     simplerandom_mix_hash_init(p_hash)
+ *         Start a new hash.
+ *     simplerandom_mix_hash_update(p_hash, p_data, num_data)
+ *         Add data words to the hash. The result only depends on the
+ *         concatenation of all the data, not how it is split between calls.
+ *     simplerandom_zzz_mix_hash(p_zzz, p_hash)
+ *         Finalise the hash and mix it into a generator. This gives the same
+ *         result as simplerandom_zzz_mix_bulk() with all the data.
+ *     simplerandom_mix_hash_final(p_hash, p_out, num_out)
+ *         Finalise the hash, and write 'num_out' words of hash output.
+ *
+ * After finalising, the hash must be initialised again before it's used.
+ * The hash algorithm is fixed, so mixing the same data always gives the same
+ * generator state. It is not a cryptographic hash.
+ */
+void simplerandom_mix_hash_init(SimpleRandomMixHash_t * p_hash);
+void simplerandom_mix_hash_update(SimpleRandomMixHash_t * p_hash, const uint32_t * p_data, size_t num_data);
+void simplerandom_mix_hash_final(SimpleRandomMixHash_t * p_hash, uint32_t * p_out, size_t num_out);
+
+/* Binary state encoding
+ *
+ * A versioned, endian-stable encoding of any generator's state, for saving
+ * and restoring. 'p_state' points to the state structure of the generator
+ * given by 'type', e.g. a SimpleRandomKISS_t for SIMPLERANDOM_TYPE_KISS.
+ * 'position' is an arbitrary stream position stored along with the state,
+ * e.g. the number of values generated so far. It is stored as 64 bits.
+ *
+ *     simplerandom_state_num_words()
+ *         Number of uint32_t state words of the given generator type, or 0 if
+ *         the type is not known.
+ *     simplerandom_state_record_size()
+ *         Number of bytes in a state record of the given generator type. This
+ *         is a SIMPLERANDOM_STATE_HEADER_SIZE byte header followed by the
+ *         state words, so it varies from type to type.
+ *     simplerandom_state_encode()
+ *         Encode one state into a record. Returns the number of bytes
+ *         written, or 0 on error.
+ *     simplerandom_state_decode()
+ *         Decode one state record. Returns the number of bytes used, or 0 if
+ *         the record is not a valid record for the given generator type.
+ *     simplerandom_state_type()
+ *         Return the generator type of a state record or state array, or
+ *         SIMPLERANDOM_TYPE_NONE if it is not valid.
+ *
+ * A state array is a SIMPLERANDOM_STATE_HEADER_SIZE byte header, followed by
+ * the state words of all the generators as little-endian uint32_t values, in
+ * the same order as the state structure members.
+ *
+ *     simplerandom_state_array_size()
+ *         Number of bytes needed to save an array of 'num_states' states.
+ *     simplerandom_state_save_array()
+ *         Save an array of states. Returns the number of bytes written, or 0
+ *         on error.
+ *     simplerandom_state_array_num_states()
+ *         Number of states in a saved state array, or SIMPLERANDOM_STATE_ERROR
+ *         if it is not valid for the given generator type.
+ *     simplerandom_state_load_array()
+ *         Load an array of states, into an array that can hold 'max_states'.
+ *         Returns the number of states loaded, or SIMPLERANDOM_STATE_ERROR on
+ *         error.
+ *     simplerandom_state_map_array()
+ *         Return a pointer to the states directly within the saved data
+ *         (e.g. a memory-mapped file), without copying. This is possible if
+ *         the host is little-endian and the data is suitably aligned;
+ *         otherwise it returns NULL and simplerandom_state_load_array() must
+ *         be used instead.
+ *
+ * States are restored exactly as saved; they are not sanitized.
+ */
+size_t simplerandom_state_num_words(SimpleRandomType_t type);
+size_t simplerandom_state_record_size(SimpleRandomType_t type);
+size_t simplerandom_state_encode(SimpleRandomType_t type, const void * p_state, uintmax_t position, uint8_t * p_buf, size_t buf_len);
+size_t simplerandom_state_decode(SimpleRandomType_t type, void * p_state, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len);
+SimpleRandomType_t simplerandom_state_type(const uint8_t * p_buf, size_t buf_len);
+size_t simplerandom_state_array_size(SimpleRandomType_t type, size_t num_states);
+size_t simplerandom_state_save_array(SimpleRandomType_t type, const void * p_states, size_t num_states, uintmax_t position, uint8_t * p_buf, size_t buf_len);
+size_t simplerandom_state_array_num_states(SimpleRandomType_t type, const uint8_t * p_buf, size_t buf_len);
+size_t simplerandom_state_load_array(SimpleRandomType_t type, void * p_states, size_t max_states, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len);
+const void * simplerandom_state_map_array(SimpleRandomType_t type, size_t * p_num_states, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len);
+
+/* Batches of generators
+ *
+ * A batch holds many independent generators of the same type, with each
+ * state word in a separate array ("structure of arrays"), so that all of them
+ * can be stepped with SIMD operations. The caller provides the memory. For
+ * generator 'zzz':
+ *
+ *     simplerandom_zzz_batch_buf_size(num)
+ *         Size in bytes of the buffer needed for 'num' generators. Returns 0
+ *         on overflow.
+ *     simplerandom_zzz_batch_init(p_batch, p_buf, buf_size, num)
+ *         Set up a batch of 'num' generators in the given buffer, which
+ *         should be aligned to SIMPLERANDOM_BATCH_ALIGN bytes. Returns false
+ *         if the buffer is too small. The buffer contents are not changed.
+ *     simplerandom_zzz_batch_step_all(p_batch)
+ *         Step all the generators once, without output.
+ *     simplerandom_zzz_batch_next_all(p_batch, p_out)
+ *         Step all the generators once, writing the output value of
+ *         generator 'i' to p_out[i].
+ *     simplerandom_zzz_batch_gather(p_batch, p_states, p_indices, num_indices)
+ *         Copy the states of generators p_indices[0..num_indices-1] into the
+ *         state structures p_states[0..num_indices-1].
+ *     simplerandom_zzz_batch_scatter(p_batch, p_states, p_indices, num_indices)
+ *         Set the states of generators p_indices[0..num_indices-1] from the
+ *         state structures p_states[0..num_indices-1].
+ *
+ * For gather and scatter, if 'p_indices' is NULL, then the indices
+ * 0..num_indices-1 are used.
+ */
+size_t simplerandom_shr3_batch_buf_size(size_t num);
+bool simplerandom_shr3_batch_init(SimpleRandomSHR3Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num);
+void simplerandom_shr3_batch_step_all(SimpleRandomSHR3Batch_t * p_batch);
+void simplerandom_shr3_batch_next_all(SimpleRandomSHR3Batch_t * p_batch, uint32_t * p_out);
+void simplerandom_shr3_batch_gather(const SimpleRandomSHR3Batch_t * p_batch, SimpleRandomSHR3_t * p_states, const size_t * p_indices, size_t num_indices);
+void simplerandom_shr3_batch_scatter(SimpleRandomSHR3Batch_t * p_batch, const SimpleRandomSHR3_t * p_states, const size_t * p_indices, size_t num_indices);
+
+size_t simplerandom_mwc2_batch_buf_size(size_t num);
+bool simplerandom_mwc2_batch_init(SimpleRandomMWC2Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num);
+void simplerandom_mwc2_batch_step_all(SimpleRandomMWC2Batch_t * p_batch);
+void simplerandom_mwc2_batch_next_all(SimpleRandomMWC2Batch_t * p_batch, uint32_t * p_out);
+void simplerandom_mwc2_batch_gather(const SimpleRandomMWC2Batch_t * p_batch, SimpleRandomMWC2_t * p_states, const size_t * p_indices, size_t num_indices);
+void simplerandom_mwc2_batch_scatter(SimpleRandomMWC2Batch_t * p_batch, const SimpleRandomMWC2_t * p_states, const size_t * p_indices, size_t num_indices);
+
+size_t simplerandom_kiss_batch_buf_size(size_t num);
+bool simplerandom_kiss_batch_init(SimpleRandomKISSBatch_t * p_batch, void * p_buf, size_t buf_size, size_t num);
+void simplerandom_kiss_batch_step_all(SimpleRandomKISSBatch_t * p_batch);
+void simplerandom_kiss_batch_next_all(SimpleRandomKISSBatch_t * p_batch, uint32_t * p_out);
+void simplerandom_kiss_batch_gather(const SimpleRandomKISSBatch_t * p_batch, SimpleRandomKISS_t * p_states, const size_t * p_indices, size_t num_indices);
+void simplerandom_kiss_batch_scatter(SimpleRandomKISSBatch_t * p_batch, const SimpleRandomKISS_t * p_states, const size_t * p_indices, size_t num_indices);
+
+size_t simplerandom_lfsr113_batch_buf_size(size_t num);
+bool simplerandom_lfsr113_batch_init(SimpleRandomLFSR113Batch_t * p_batch, void * p_buf, size_t buf_size, size_t num);
+void simplerandom_lfsr113_batch_step_all(SimpleRandomLFSR113Batch_t * p_batch);
+void simplerandom_lfsr113_batch_next_all(SimpleRandomLFSR113Batch_t * p_batch, uint32_t * p_out);
+void simplerandom_lfsr113_batch_gather(const SimpleRandomLFSR113Batch_t * p_batch, SimpleRandomLFSR113_t * p_states, const size_t * p_indices, size_t num_indices);
+void simplerandom_lfsr113_batch_scatter(SimpleRandomLFSR113Batch_t * p_batch, const SimpleRandomLFSR113_t * p_states, const size_t * p_indices, size_t num_indices);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -194,6 +194,40 @@ static const BitColumnMatrix32_t lfsr88_3_matrix =
     },
 };
 
+#ifdef UINT64_C
+
+/* KISS64 SHR3 'next' operation is defined by:
+ *     shr3 ^= (shr3 << 13);
+ *     shr3 ^= (shr3 >> 17);
+ *     shr3 ^= (shr3 << 43);
+ *
+ * The derivation is the same as for shr3_matrix, with BitColumnMatrix64_t
+ * and the bitcolumnmatrix64_...() functions.
+ */
+static const BitColumnMatrix64_t kiss64_shr3_matrix =
+{
+    {
+        UINT64_C(0x0100080000002001), UINT64_C(0x0200100000004002), UINT64_C(0x0400200000008004), UINT64_C(0x0800400000010008),
+        UINT64_C(0x1000880000020011), UINT64_C(0x2001100000040022), UINT64_C(0x4002200000080044), UINT64_C(0x8004400000100088),
+        UINT64_C(0x0008800000200110), UINT64_C(0x0011000000400220), UINT64_C(0x0022000000800440), UINT64_C(0x0044000001000880),
+        UINT64_C(0x0088000002001100), UINT64_C(0x0110000004002200), UINT64_C(0x0220000008004400), UINT64_C(0x0440000010008800),
+        UINT64_C(0x0880000020011000), UINT64_C(0x1100080040022001), UINT64_C(0x2200100080044002), UINT64_C(0x4400200100088004),
+        UINT64_C(0x8800400200110008), UINT64_C(0x1000800400220010), UINT64_C(0x2001000800440020), UINT64_C(0x4002001000880040),
+        UINT64_C(0x8004002001100080), UINT64_C(0x0008004002200100), UINT64_C(0x0010008004400200), UINT64_C(0x0020010008800400),
+        UINT64_C(0x0040020011000800), UINT64_C(0x0080040022001000), UINT64_C(0x0100080044002000), UINT64_C(0x0200100088004000),
+        UINT64_C(0x0400200110008000), UINT64_C(0x0800400220010000), UINT64_C(0x1000800440020000), UINT64_C(0x2001000880040000),
+        UINT64_C(0x4002001100080000), UINT64_C(0x8004002200100000), UINT64_C(0x0008004400200000), UINT64_C(0x0010008800400000),
+        UINT64_C(0x0020011000800000), UINT64_C(0x0040022001000000), UINT64_C(0x0080044002000000), UINT64_C(0x0100088004000000),
+        UINT64_C(0x0200110008000000), UINT64_C(0x0400220010000000), UINT64_C(0x0800440020000000), UINT64_C(0x1000880040000000),
+        UINT64_C(0x2001100080000000), UINT64_C(0x4002200100000000), UINT64_C(0x8004400200000000), UINT64_C(0x0008000400000000),
+        UINT64_C(0x0010000800000000), UINT64_C(0x0020001000000000), UINT64_C(0x0040002000000000), UINT64_C(0x0080004000000000),
+        UINT64_C(0x0100008000000000), UINT64_C(0x0200010000000000), UINT64_C(0x0400020000000000), UINT64_C(0x0800040000000000),
+        UINT64_C(0x1000080000000000), UINT64_C(0x2000100000000000), UINT64_C(0x4000200000000000), UINT64_C(0x8000400000000000),
+    },
+};
+
+#endif /* defined(UINT64_C) */
+
 
 /*****************************************************************************
  * Functions
@@ -360,6 +394,46 @@ void simplerandom_kiss2_discard(SimpleRandomKISS2_t * p_kiss2, uintmax_t n)
     p_kiss2->shr3       = rng_shr3.shr3;
 }
 
+
+/*********
+ * KISS64
+ ********/
+
+#define _KISS64_MWC_MULT        ((UINT64_C(1) << 58u) + 1u)
+#define _KISS64_CONG_MULT       UINT64_C(6906969069)
+#define _KISS64_CONG_CONST      UINT64_C(1234567)
+
+/* As for MWC64, the MWC state is multiplied by _KISS64_MWC_MULT^n modulo
+ * _KISS64_MWC_MULT * 2^64 - 1, but with 128-bit values. The Cong is as for
+ * simplerandom_cong_discard(), but modulo 2^64.
+ */
+void simplerandom_kiss64_discard(SimpleRandomKISS64_t * p_kiss64, uintmax_t n)
+{
+    BitColumnMatrix64_t shr3_mult;
+    Uint128_t           mwc_mult;
+    Uint128_t           mwc_modulo;
+    Uint128_t           mwc;
+    uint64_t            mult_exp;
+    uint64_t            add_const;
+
+    mwc_mult.high = 0;
+    mwc_mult.low = _KISS64_MWC_MULT;
+    mwc_modulo.high = _KISS64_MWC_MULT - 1u;
+    mwc_modulo.low = UINT64_C(0xFFFFFFFFFFFFFFFF);
+    mwc.high = p_kiss64->mwc_upper;
+    mwc.low = p_kiss64->mwc_lower;
+    mwc = mul_mod_uint128(pow_mod_uint128(mwc_mult, n, mwc_modulo), mwc, mwc_modulo);
+    p_kiss64->mwc_upper = mwc.high;
+    p_kiss64->mwc_lower = mwc.low;
+
+    mult_exp = pow_uint64(_KISS64_CONG_MULT, n);
+    add_const = geom_series_uint64(_KISS64_CONG_MULT, n) * _KISS64_CONG_CONST;
+    p_kiss64->cong = mult_exp * p_kiss64->cong + add_const;
+
+    bitcolumnmatrix64_pow(&shr3_mult, &kiss64_shr3_matrix, n);
+    p_kiss64->shr3 = bitcolumnmatrix64_mul_uint64(&shr3_mult, p_kiss64->shr3);
+}
+
 #endif /* defined(UINT64_C) */
 
 
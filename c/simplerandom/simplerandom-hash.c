@@ -0,0 +1,275 @@
+/*
+ * simplerandom-hash.c
+ *
+ * Simple Pseudo-random Number Generators -- mixing in large amounts of data.
+ *
+ * The simplerandom_zzz_mix() functions take the data one word at a time,
+ * selecting which part of the state to modify from the current output, then
+ * sanitizing and stepping the generator. That is fine for a few words, but
+ * slow for seeding from a large block of data such as the contents of a file.
+ *
+ * For large data, the data is first hashed down to a few words, using a fast
+ * hash that only needs 32-bit math. Then those words are mixed into the
+ * generator with simplerandom_zzz_mix(), taking
+ * simplerandom_zzz_num_seeds() words, so that all of the generator state
+ * depends on the data.
+ *
+ * The hash can be calculated incrementally, for data that isn't all available
+ * at once, with:
+ *     simplerandom_mix_hash_init()
+ *     simplerandom_mix_hash_update() -- any number of times
+ *     simplerandom_zzz_mix_hash() -- or simplerandom_mix_hash_final()
+ * The result only depends on the concatenation of all the data words, not on
+ * how it was split into calls to simplerandom_mix_hash_update().
+ * simplerandom_zzz_mix_bulk() does all of those steps in one call.
+ *
+ * The hash is defined as follows, and the output must never change, because
+ * it's used for seeding reproducible sequences:
+ *
+ * - There are 16 lanes of 32 bits. Lane j is initialised to P2 + j * P1,
+ *   where the constants are the 32-bit primes from xxHash:
+ *       P1 = 0x9E3779B1, P2 = 0x85EBCA77
+ * - Data word i is added to lane (i % 16) with the xxHash round function:
+ *       lane = rotl(lane + word * P2, 13) * P1
+ *   The lanes are independent, so they can be processed in parallel. 16
+ *   lanes are enough to keep several SIMD registers busy, because the
+ *   multiplies have a long latency.
+ * - To finalise, the 16 lanes are folded into 4 words:
+ *       h[k] = lane[k] + rotl(lane[k + 4], 7) + rotl(lane[k + 8], 13)
+ *              + rotl(lane[k + 12], 19)
+ *   Then h[0] is XORed with the low 32 bits of the total number of words,
+ *   and h[1] with the next 32 bits.
+ * - The output words are then produced 4 at a time. For each group of 4, h[]
+ *   is mixed with 2 ChaCha quarter-rounds, then each output word is the
+ *   MurmurHash3 finaliser of the corresponding h[k].
+ *
+ * This is not a cryptographic hash. It's intended to make each generator
+ * state bit depend on all the data bits.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define MIX_HASH_LANES          SIMPLERANDOM_MIX_HASH_LANES
+
+#define MIX_HASH_P1             UINT32_C(0x9E3779B1)
+#define MIX_HASH_P2             UINT32_C(0x85EBCA77)
+
+/* Most number of seed words of any generator. Each generator's number of
+ * seeds is checked against this at compile time, in MIX_HASH_FUNCTIONS().
+ */
+#define MIX_HASH_MAX_SEEDS      8u
+
+/* simplerandom_zzz_mix_hash() and simplerandom_zzz_mix_bulk() for generator
+ * 'zzz', with state type 'state_t' and SIMPLERANDOM_ZZZ_NUM_SEEDS 'num_seeds'.
+ * The typedef fails to compile (negative array size) if 'num_seeds' is more
+ * than MIX_HASH_MAX_SEEDS.
+ */
+#define MIX_HASH_FUNCTIONS(zzz, state_t, num_seeds) \
+typedef char zzz##_mix_hash_num_seeds_check[((num_seeds) <= MIX_HASH_MAX_SEEDS) ? 1 : -1]; \
+\
+void simplerandom_##zzz##_mix_hash(state_t * p_state, SimpleRandomMixHash_t * p_hash) \
+{ \
+    uint32_t    seeds[MIX_HASH_MAX_SEEDS]; \
+\
+    if (p_hash->num_words != 0) \
+    { \
+        simplerandom_mix_hash_final(p_hash, seeds, (num_seeds)); \
+        simplerandom_##zzz##_mix(p_state, seeds, (num_seeds)); \
+    } \
+} \
+\
+void simplerandom_##zzz##_mix_bulk(state_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    SimpleRandomMixHash_t   hash; \
+\
+    if (p_data != NULL && num_data != 0) \
+    { \
+        simplerandom_mix_hash_init(&hash); \
+        simplerandom_mix_hash_update(&hash, p_data, num_data); \
+        simplerandom_##zzz##_mix_hash(p_state, &hash); \
+    } \
+}
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static inline uint32_t mix_hash_rotl(uint32_t x, unsigned shift)
+{
+    return (x << shift) | (x >> (32u - shift));
+}
+
+static inline uint32_t mix_hash_round(uint32_t lane, uint32_t data)
+{
+    return mix_hash_rotl(lane + data * MIX_HASH_P2, 13u) * MIX_HASH_P1;
+}
+
+/* Add 'num_stripes' stripes of MIX_HASH_LANES words to the lanes. The lanes
+ * are copied to a local array so the compiler can keep them in SIMD registers
+ * for the whole loop.
+ */
+static void mix_hash_stripes(uint32_t * restrict p_lanes, const uint32_t * restrict p_data, size_t num_stripes)
+{
+    uint32_t    lanes[MIX_HASH_LANES];
+    size_t      j;
+
+    for (j = 0; j < MIX_HASH_LANES; j++)
+    {
+        lanes[j] = p_lanes[j];
+    }
+    while (num_stripes)
+    {
+        --num_stripes;
+        for (j = 0; j < MIX_HASH_LANES; j++)
+        {
+            lanes[j] = mix_hash_round(lanes[j], p_data[j]);
+        }
+        p_data += MIX_HASH_LANES;
+    }
+    for (j = 0; j < MIX_HASH_LANES; j++)
+    {
+        p_lanes[j] = lanes[j];
+    }
+}
+
+/* ChaCha quarter-round, to mix the 4 words together. */
+static void mix_hash_quarter_round(uint32_t * p_h)
+{
+    p_h[0] += p_h[1]; p_h[3] ^= p_h[0]; p_h[3] = mix_hash_rotl(p_h[3], 16u);
+    p_h[2] += p_h[3]; p_h[1] ^= p_h[2]; p_h[1] = mix_hash_rotl(p_h[1], 12u);
+    p_h[0] += p_h[1]; p_h[3] ^= p_h[0]; p_h[3] = mix_hash_rotl(p_h[3], 8u);
+    p_h[2] += p_h[3]; p_h[1] ^= p_h[2]; p_h[1] = mix_hash_rotl(p_h[1], 7u);
+}
+
+/* MurmurHash3 32-bit finaliser. */
+static inline uint32_t mix_hash_avalanche(uint32_t x)
+{
+    x ^= x >> 16u;
+    x *= UINT32_C(0x85EBCA6B);
+    x ^= x >> 13u;
+    x *= UINT32_C(0xC2B2AE35);
+    x ^= x >> 16u;
+    return x;
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+void simplerandom_mix_hash_init(SimpleRandomMixHash_t * p_hash)
+{
+    size_t      j;
+
+    for (j = 0; j < MIX_HASH_LANES; j++)
+    {
+        p_hash->lanes[j] = MIX_HASH_P2 + (uint32_t)j * MIX_HASH_P1;
+    }
+    p_hash->num_words = 0;
+}
+
+void simplerandom_mix_hash_update(SimpleRandomMixHash_t * p_hash, const uint32_t * p_data, size_t num_data)
+{
+    size_t      num_buffered;
+    size_t      num_stripes;
+
+    if (p_data == NULL)
+        return;
+
+    /* Complete a stripe that was left over from a previous call. */
+    num_buffered = (size_t)(p_hash->num_words % MIX_HASH_LANES);
+    p_hash->num_words += num_data;
+    if (num_buffered != 0)
+    {
+        while (num_data && num_buffered < MIX_HASH_LANES)
+        {
+            --num_data;
+            p_hash->buf[num_buffered++] = *p_data++;
+        }
+        if (num_buffered < MIX_HASH_LANES)
+            return;
+        mix_hash_stripes(p_hash->lanes, p_hash->buf, 1u);
+    }
+
+    num_stripes = num_data / MIX_HASH_LANES;
+    mix_hash_stripes(p_hash->lanes, p_data, num_stripes);
+    p_data += num_stripes * MIX_HASH_LANES;
+    num_data -= num_stripes * MIX_HASH_LANES;
+
+    /* Keep any remainder for the next call. */
+    for (num_buffered = 0; num_buffered < num_data; num_buffered++)
+    {
+        p_hash->buf[num_buffered] = p_data[num_buffered];
+    }
+}
+
+/* Finalise the hash, and write 'num_out' words of output. After this, the hash
+ * must be initialised again before it is used.
+ */
+void simplerandom_mix_hash_final(SimpleRandomMixHash_t * p_hash, uint32_t * p_out, size_t num_out)
+{
+    uint32_t  * p_lanes = p_hash->lanes;
+    uint32_t    h[4];
+    size_t      num_buffered;
+    size_t      i;
+
+    /* The lanes take the remaining words of an incomplete stripe. */
+    num_buffered = (size_t)(p_hash->num_words % MIX_HASH_LANES);
+    for (i = 0; i < num_buffered; i++)
+    {
+        p_lanes[i] = mix_hash_round(p_lanes[i], p_hash->buf[i]);
+    }
+
+    for (i = 0; i < 4u; i++)
+    {
+        h[i] = p_lanes[i] + mix_hash_rotl(p_lanes[i + 4u], 7u) +
+               mix_hash_rotl(p_lanes[i + 8u], 13u) + mix_hash_rotl(p_lanes[i + 12u], 19u);
+    }
+    h[0] ^= (uint32_t)p_hash->num_words;
+    h[1] ^= (uint32_t)(p_hash->num_words >> 32u);
+
+    for (i = 0; i < num_out; i++)
+    {
+        if (i % 4u == 0)
+        {
+            mix_hash_quarter_round(h);
+            mix_hash_quarter_round(h);
+        }
+        p_out[i] = mix_hash_avalanche(h[i % 4u]);
+    }
+}
+
+/* simplerandom_zzz_mix_hash() finalises the hash, and mixes the output into
+ * the generator with simplerandom_zzz_mix(). If no data was hashed, the
+ * generator is unchanged, as for simplerandom_zzz_mix() with no data.
+ *
+ * simplerandom_zzz_mix_bulk() gives the same result as hashing the data and
+ * calling simplerandom_zzz_mix_hash().
+ */
+
+MIX_HASH_FUNCTIONS(cong, SimpleRandomCong_t, SIMPLERANDOM_CONG_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(shr3, SimpleRandomSHR3_t, SIMPLERANDOM_SHR3_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(mwc1, SimpleRandomMWC1_t, SIMPLERANDOM_MWC1_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(mwc2, SimpleRandomMWC2_t, SIMPLERANDOM_MWC2_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(kiss, SimpleRandomKISS_t, SIMPLERANDOM_KISS_NUM_SEEDS)
+#ifdef UINT64_C
+MIX_HASH_FUNCTIONS(mwc64, SimpleRandomMWC64_t, SIMPLERANDOM_MWC64_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(kiss2, SimpleRandomKISS2_t, SIMPLERANDOM_KISS2_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(kiss64, SimpleRandomKISS64_t, SIMPLERANDOM_KISS64_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(cmwc4096, SimpleRandomCMWC4096_t, SIMPLERANDOM_CMWC4096_NUM_SEEDS)
+#endif /* defined(UINT64_C) */
+MIX_HASH_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t, SIMPLERANDOM_LFSR113_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t, SIMPLERANDOM_LFSR88_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(lfib4, SimpleRandomLFIB4_t, SIMPLERANDOM_LFIB4_NUM_SEEDS)
+MIX_HASH_FUNCTIONS(swb, SimpleRandomSWB_t, SIMPLERANDOM_SWB_NUM_SEEDS)
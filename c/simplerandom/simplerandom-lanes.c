@@ -0,0 +1,415 @@
+/*
+ * simplerandom-lanes.c
+ *
+ * Simple Pseudo-random Number Generators -- multi-lane generators.
+ *
+ * A multi-lane generator holds SIMPLERANDOM_LANES independent copies of a
+ * generator ("lanes"), each started at a widely spaced point in the sequence
+ * of the same generator, by using the discard function. The lanes are stepped
+ * together, which the compiler can vectorize with SIMD instructions, and the
+ * output is lane-interleaved. That is, output value i comes from lane
+ * (i % SIMPLERANDOM_LANES), and is that lane's (i / SIMPLERANDOM_LANES)'th
+ * value.
+ *
+ * As for the batch functions (see simplerandom-batch.c), rather than using
+ * platform-specific intrinsics, the loops are written so that the compiler
+ * auto-vectorizes them, with a fixed-length inner loop over the lanes.
+ *
+ * The lanes don't overlap until each lane has generated (period /
+ * SIMPLERANDOM_LANES) values. So the output is different from the normal
+ * (scalar) generator output, but each lane's values are a contiguous part
+ * of the normal output sequence.
+ *
+ * The output is the same, regardless of how it is split into calls to the
+ * fill function.
+ *
+ * Some generators also have a lane-blocked fill function, which writes a
+ * contiguous run of values for each lane, rather than interleaving them.
+ * Each lane continues its own sequence, so lane-blocked and lane-interleaved
+ * fills can be mixed.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define LANES                   SIMPLERANDOM_LANES
+
+/* Spacing of lanes in the Cong sequence: the period 2^32, divided evenly. */
+#define CONG_LANE_SPACING       (UINT32_C(0xFFFFFFFF) / LANES + 1u)
+
+/* Spacing of lanes in the MWC1/MWC2 sequence, whose period is about 2^59.3. */
+#define MWC_LANE_SPACING        (UINTMAX_C(1) << 55u)
+
+#ifdef UINT64_C
+
+/* Spacing of lanes in the MWC64 sequence, whose period is about 2^60.4. */
+#define MWC64_LANE_SPACING      (UINTMAX_C(1) << 56u)
+
+#define MWC64_MULT              UINT64_C(698769069)
+
+#endif /* defined(UINT64_C) */
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*********
+ * Cong
+ ********/
+
+/* Lane 0 starts at the state of 'p_cong'. Each following lane starts
+ * CONG_LANE_SPACING values further on.
+ */
+void simplerandom_cong_lanes_init(SimpleRandomCongLanes_t * p_lanes, const SimpleRandomCong_t * p_cong)
+{
+    SimpleRandomCong_t  cong = *p_cong;
+    size_t              j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        p_lanes->cong[j] = cong.cong;
+        simplerandom_cong_discard(&cong, CONG_LANE_SPACING);
+    }
+    p_lanes->next_lane = 0;
+}
+
+static void cong_lanes_fill_blocks(uint32_t * restrict p_state, uint32_t * restrict p_out, size_t num_blocks)
+{
+    uint32_t    cong[LANES];
+    size_t      i;
+    size_t      j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        cong[j] = p_state[j];
+    }
+    for (i = 0; i < num_blocks; i++)
+    {
+        for (j = 0; j < LANES; j++)
+        {
+            cong[j] = UINT32_C(69069) * cong[j] + 12345u;
+            p_out[j] = cong[j];
+        }
+        p_out += LANES;
+    }
+    for (j = 0; j < LANES; j++)
+    {
+        p_state[j] = cong[j];
+    }
+}
+
+void simplerandom_cong_lanes_fill(SimpleRandomCongLanes_t * p_lanes, uint32_t * p_out, size_t num_out)
+{
+    size_t      lane = p_lanes->next_lane;
+    size_t      num_blocks;
+
+    /* Finish the lanes left over from a previous call. */
+    while (lane != 0 && num_out != 0)
+    {
+        p_lanes->cong[lane] = UINT32_C(69069) * p_lanes->cong[lane] + 12345u;
+        *p_out++ = p_lanes->cong[lane];
+        lane = (lane + 1u) % LANES;
+        --num_out;
+    }
+    if (lane != 0)
+    {
+        p_lanes->next_lane = lane;
+        return;
+    }
+
+    num_blocks = num_out / LANES;
+    cong_lanes_fill_blocks(p_lanes->cong, p_out, num_blocks);
+    p_out += num_blocks * LANES;
+    num_out -= num_blocks * LANES;
+
+    for (lane = 0; lane < num_out; lane++)
+    {
+        p_lanes->cong[lane] = UINT32_C(69069) * p_lanes->cong[lane] + 12345u;
+        p_out[lane] = p_lanes->cong[lane];
+    }
+    p_lanes->next_lane = lane;
+}
+
+
+/*********
+ * MWC2
+ ********/
+
+/* Lane 0 starts at the state of 'p_mwc'. Each following lane starts
+ * MWC_LANE_SPACING values further on.
+ */
+void simplerandom_mwc2_lanes_init(SimpleRandomMWC2Lanes_t * p_lanes, const SimpleRandomMWC2_t * p_mwc)
+{
+    SimpleRandomMWC2_t  mwc = *p_mwc;
+    size_t              j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        p_lanes->mwc_upper[j] = mwc.mwc_upper;
+        p_lanes->mwc_lower[j] = mwc.mwc_lower;
+        simplerandom_mwc2_discard(&mwc, MWC_LANE_SPACING);
+    }
+    p_lanes->next_lane = 0;
+}
+
+/* Step one lane, and return its new state. */
+static inline SimpleRandomMWC2_t mwc_lanes_next_lane(SimpleRandomMWC2Lanes_t * p_lanes, size_t lane)
+{
+    SimpleRandomMWC2_t  mwc;
+
+    mwc.mwc_upper = 36969u * (p_lanes->mwc_upper[lane] & 0xFFFFu) + (p_lanes->mwc_upper[lane] >> 16u);
+    mwc.mwc_lower = 18000u * (p_lanes->mwc_lower[lane] & 0xFFFFu) + (p_lanes->mwc_lower[lane] >> 16u);
+    p_lanes->mwc_upper[lane] = mwc.mwc_upper;
+    p_lanes->mwc_lower[lane] = mwc.mwc_lower;
+    return mwc;
+}
+
+/* Step all the lanes 'num_blocks' times. The MWC1 output is written if 'mwc1'
+ * is true, otherwise the MWC2 output. This is inlined with a constant 'mwc1'
+ * so there is no test in the loop.
+ */
+static inline void mwc_lanes_fill_blocks(uint32_t * restrict p_upper, uint32_t * restrict p_lower, uint32_t * restrict p_out, size_t num_blocks, bool mwc1)
+{
+    uint32_t    mwc_upper[LANES];
+    uint32_t    mwc_lower[LANES];
+    size_t      i;
+    size_t      j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        mwc_upper[j] = p_upper[j];
+        mwc_lower[j] = p_lower[j];
+    }
+    for (i = 0; i < num_blocks; i++)
+    {
+        for (j = 0; j < LANES; j++)
+        {
+            mwc_upper[j] = 36969u * (mwc_upper[j] & 0xFFFFu) + (mwc_upper[j] >> 16u);
+            mwc_lower[j] = 18000u * (mwc_lower[j] & 0xFFFFu) + (mwc_lower[j] >> 16u);
+            if (mwc1)
+                p_out[j] = (mwc_upper[j] << 16u) + mwc_lower[j];
+            else
+                p_out[j] = (mwc_upper[j] << 16u) + (mwc_upper[j] >> 16u) + mwc_lower[j];
+        }
+        p_out += LANES;
+    }
+    for (j = 0; j < LANES; j++)
+    {
+        p_upper[j] = mwc_upper[j];
+        p_lower[j] = mwc_lower[j];
+    }
+}
+
+void simplerandom_mwc2_lanes_fill(SimpleRandomMWC2Lanes_t * p_lanes, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC2_t  mwc;
+    size_t              lane = p_lanes->next_lane;
+    size_t              num_blocks;
+
+    /* Finish the lanes left over from a previous call. */
+    while (lane != 0 && num_out != 0)
+    {
+        mwc = mwc_lanes_next_lane(p_lanes, lane);
+        *p_out++ = mwc2_current(&mwc);
+        lane = (lane + 1u) % LANES;
+        --num_out;
+    }
+    if (lane != 0)
+    {
+        p_lanes->next_lane = lane;
+        return;
+    }
+
+    num_blocks = num_out / LANES;
+    mwc_lanes_fill_blocks(p_lanes->mwc_upper, p_lanes->mwc_lower, p_out, num_blocks, false);
+    p_out += num_blocks * LANES;
+    num_out -= num_blocks * LANES;
+
+    for (lane = 0; lane < num_out; lane++)
+    {
+        mwc = mwc_lanes_next_lane(p_lanes, lane);
+        p_out[lane] = mwc2_current(&mwc);
+    }
+    p_lanes->next_lane = lane;
+}
+
+/*********
+ * MWC1
+ ********/
+
+/* MWC1 has the same state and sequence as MWC2, only a different output. */
+void simplerandom_mwc1_lanes_init(SimpleRandomMWC1Lanes_t * p_lanes, const SimpleRandomMWC1_t * p_mwc)
+{
+    simplerandom_mwc2_lanes_init(p_lanes, p_mwc);
+}
+
+void simplerandom_mwc1_lanes_fill(SimpleRandomMWC1Lanes_t * p_lanes, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC1_t  mwc;
+    size_t              lane = p_lanes->next_lane;
+    size_t              num_blocks;
+
+    /* Finish the lanes left over from a previous call. */
+    while (lane != 0 && num_out != 0)
+    {
+        mwc = mwc_lanes_next_lane(p_lanes, lane);
+        *p_out++ = mwc1_current(&mwc);
+        lane = (lane + 1u) % LANES;
+        --num_out;
+    }
+    if (lane != 0)
+    {
+        p_lanes->next_lane = lane;
+        return;
+    }
+
+    num_blocks = num_out / LANES;
+    mwc_lanes_fill_blocks(p_lanes->mwc_upper, p_lanes->mwc_lower, p_out, num_blocks, true);
+    p_out += num_blocks * LANES;
+    num_out -= num_blocks * LANES;
+
+    for (lane = 0; lane < num_out; lane++)
+    {
+        mwc = mwc_lanes_next_lane(p_lanes, lane);
+        p_out[lane] = mwc1_current(&mwc);
+    }
+    p_lanes->next_lane = lane;
+}
+
+#ifdef UINT64_C
+
+/*********
+ * MWC64
+ ********/
+
+/* Lane 0 starts at the state of 'p_mwc'. Each following lane starts
+ * MWC64_LANE_SPACING values further on.
+ */
+void simplerandom_mwc64_lanes_init(SimpleRandomMWC64Lanes_t * p_lanes, const SimpleRandomMWC64_t * p_mwc)
+{
+    SimpleRandomMWC64_t mwc = *p_mwc;
+    size_t              j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        p_lanes->mwc_upper[j] = mwc.mwc_upper;
+        p_lanes->mwc_lower[j] = mwc.mwc_lower;
+        simplerandom_mwc64_discard(&mwc, MWC64_LANE_SPACING);
+    }
+    p_lanes->next_lane = 0;
+}
+
+/* Step one lane, and return its output value. */
+static inline uint32_t mwc64_lanes_next_lane(SimpleRandomMWC64Lanes_t * p_lanes, size_t lane)
+{
+    uint64_t    mwc64;
+
+    mwc64 = MWC64_MULT * p_lanes->mwc_lower[lane] + p_lanes->mwc_upper[lane];
+    p_lanes->mwc_upper[lane] = (uint32_t)(mwc64 >> 32u);
+    p_lanes->mwc_lower[lane] = (uint32_t)mwc64;
+    return (uint32_t)mwc64;
+}
+
+/* The 32x32->64 bit multiply of each lane maps directly to SIMD unsigned
+ * 32-bit multiplies (e.g. pmuludq, vpmuludq).
+ */
+static void mwc64_lanes_fill_blocks(uint32_t * restrict p_upper, uint32_t * restrict p_lower, uint32_t * restrict p_out, size_t num_blocks)
+{
+    uint32_t    mwc_upper[LANES];
+    uint32_t    mwc_lower[LANES];
+    uint64_t    mwc64;
+    size_t      i;
+    size_t      j;
+
+    for (j = 0; j < LANES; j++)
+    {
+        mwc_upper[j] = p_upper[j];
+        mwc_lower[j] = p_lower[j];
+    }
+    for (i = 0; i < num_blocks; i++)
+    {
+        for (j = 0; j < LANES; j++)
+        {
+            mwc64 = MWC64_MULT * mwc_lower[j] + mwc_upper[j];
+            mwc_upper[j] = (uint32_t)(mwc64 >> 32u);
+            mwc_lower[j] = (uint32_t)mwc64;
+            p_out[j] = (uint32_t)mwc64;
+        }
+        p_out += LANES;
+    }
+    for (j = 0; j < LANES; j++)
+    {
+        p_upper[j] = mwc_upper[j];
+        p_lower[j] = mwc_lower[j];
+    }
+}
+
+void simplerandom_mwc64_lanes_fill(SimpleRandomMWC64Lanes_t * p_lanes, uint32_t * p_out, size_t num_out)
+{
+    size_t      lane = p_lanes->next_lane;
+    size_t      num_blocks;
+
+    /* Finish the lanes left over from a previous call. */
+    while (lane != 0 && num_out != 0)
+    {
+        *p_out++ = mwc64_lanes_next_lane(p_lanes, lane);
+        lane = (lane + 1u) % LANES;
+        --num_out;
+    }
+    if (lane != 0)
+    {
+        p_lanes->next_lane = lane;
+        return;
+    }
+
+    num_blocks = num_out / LANES;
+    mwc64_lanes_fill_blocks(p_lanes->mwc_upper, p_lanes->mwc_lower, p_out, num_blocks);
+    p_out += num_blocks * LANES;
+    num_out -= num_blocks * LANES;
+
+    for (lane = 0; lane < num_out; lane++)
+    {
+        p_out[lane] = mwc64_lanes_next_lane(p_lanes, lane);
+    }
+    p_lanes->next_lane = lane;
+}
+
+/* Generate 'num_per_lane' values from each lane, into
+ * p_out[lane * num_per_lane + k]. The values are generated lane-interleaved
+ * into a small local buffer, then copied out lane by lane.
+ */
+void simplerandom_mwc64_lanes_fill_blocked(SimpleRandomMWC64Lanes_t * p_lanes, uint32_t * p_out, size_t num_per_lane)
+{
+    uint32_t    buf[LANES * LANES];
+    size_t      num_done;
+    size_t      num_now;
+    size_t      j;
+    size_t      k;
+
+    for (num_done = 0; num_done < num_per_lane; num_done += num_now)
+    {
+        num_now = num_per_lane - num_done;
+        if (num_now > LANES)
+            num_now = LANES;
+        mwc64_lanes_fill_blocks(p_lanes->mwc_upper, p_lanes->mwc_lower, buf, num_now);
+        for (j = 0; j < LANES; j++)
+        {
+            for (k = 0; k < num_now; k++)
+            {
+                p_out[j * num_per_lane + num_done + k] = buf[k * LANES + j];
+            }
+        }
+    }
+}
+
+#endif /* defined(UINT64_C) */
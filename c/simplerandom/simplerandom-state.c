@@ -0,0 +1,437 @@
+/*
+ * simplerandom-state.c
+ *
+ * Simple Pseudo-random Number Generators -- binary state encoding.
+ *
+ * Save and restore generator states in a versioned, endian-stable binary
+ * format. This allows states to be checkpointed to a file and restored later,
+ * possibly on a different machine.
+ *
+ * All the generator state structures consist only of uint32_t members, or
+ * only of uint64_t members, so each state is handled as an array of uint32_t
+ * "state words", in the same order as the structure members. A uint64_t
+ * member is two state words, the low half first.
+ *
+ * A single state record and a state array both begin with a
+ * SIMPLERANDOM_STATE_HEADER_SIZE (32) byte header:
+ *
+ *     Offset  Size    Contents
+ *     0       4       Magic "SRst"
+ *     4       1       Format version, SIMPLERANDOM_STATE_VERSION
+ *     5       1       Generator type, SimpleRandomType_t
+ *     6       1       Kind: 0 for a single state record, 1 for a state array
+ *     7       1       Reserved, 0
+ *     8       8       Stream position, little-endian
+ *     16      4       Number of state words per state, little-endian
+ *     20      4       Reserved, 0
+ *     24      8       Number of states, little-endian. 0 for a state record.
+ *
+ * The header is followed directly by the state words, as little-endian
+ * uint32_t values: the words of one state for a state record, or the words of
+ * all the states for a state array. So the size of a record depends on the
+ * generator type, from 36 bytes for Cong to 16424 bytes for CMWC4096.
+ *
+ * On a little-endian host, the state words of an array are identical to an
+ * in-memory array of the state structures, so a saved state array can be used
+ * in place (e.g. from a memory-mapped file) with no parsing.
+ *
+ * Version 1 of the format had 32 byte records with room for only 4 state
+ * words. It is not supported.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+
+#include <string.h>
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define STATE_MAGIC_0           'S'
+#define STATE_MAGIC_1           'R'
+#define STATE_MAGIC_2           's'
+#define STATE_MAGIC_3           't'
+
+#define STATE_KIND_RECORD       0u
+#define STATE_KIND_ARRAY        1u
+
+#define STATE_OFFSET_VERSION    4u
+#define STATE_OFFSET_TYPE       5u
+#define STATE_OFFSET_KIND       6u
+#define STATE_OFFSET_POSITION   8u
+#define STATE_OFFSET_NUM_WORDS  16u
+#define STATE_OFFSET_NUM_STATES 24u
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static bool host_is_little_endian(void)
+{
+    const uint32_t  value = 1u;
+
+    return (*(const uint8_t *)&value == 1u);
+}
+
+static void put_uint32_le(uint8_t * p_buf, uint32_t value)
+{
+    p_buf[0] = (uint8_t)value;
+    p_buf[1] = (uint8_t)(value >> 8u);
+    p_buf[2] = (uint8_t)(value >> 16u);
+    p_buf[3] = (uint8_t)(value >> 24u);
+}
+
+static uint32_t get_uint32_le(const uint8_t * p_buf)
+{
+    return (uint32_t)p_buf[0] |
+            ((uint32_t)p_buf[1] << 8u) |
+            ((uint32_t)p_buf[2] << 16u) |
+            ((uint32_t)p_buf[3] << 24u);
+}
+
+/* 64-bit values are handled as two 32-bit halves, so that this works even if
+ * uintmax_t is only 32 bits. The double shifts avoid shifting by the full
+ * width of the type.
+ */
+static void put_uint64_le(uint8_t * p_buf, uintmax_t value)
+{
+    put_uint32_le(p_buf, (uint32_t)value);
+    put_uint32_le(p_buf + 4u, (uint32_t)((value >> 16u) >> 16u));
+}
+
+static uintmax_t get_uint64_le(const uint8_t * p_buf)
+{
+    return (uintmax_t)get_uint32_le(p_buf) |
+            (((uintmax_t)get_uint32_le(p_buf + 4u) << 16u) << 16u);
+}
+
+/* Size of each state word in memory: 8 for generators with uint64_t state
+ * members, otherwise 4.
+ */
+static size_t state_word_size(SimpleRandomType_t type)
+{
+#ifdef UINT64_C
+    if (type == SIMPLERANDOM_TYPE_KISS64)
+    {
+        return sizeof(uint64_t);
+    }
+#endif /* defined(UINT64_C) */
+    (void)type;
+    return sizeof(uint32_t);
+}
+
+static void put_state_words(SimpleRandomType_t type, uint8_t * p_buf, const void * p_states, size_t num_words)
+{
+    const uint32_t    * p_words = (const uint32_t *)p_states;
+    size_t              i;
+
+    if (host_is_little_endian())
+    {
+        if (num_words != 0)
+        {
+            memcpy(p_buf, p_states, num_words * sizeof(uint32_t));
+        }
+    }
+#ifdef UINT64_C
+    else if (state_word_size(type) == sizeof(uint64_t))
+    {
+        for (i = 0; i < num_words / 2u; i++)
+        {
+            put_uint64_le(p_buf + i * sizeof(uint64_t), ((const uint64_t *)p_states)[i]);
+        }
+    }
+#endif /* defined(UINT64_C) */
+    else
+    {
+        for (i = 0; i < num_words; i++)
+        {
+            put_uint32_le(p_buf + i * sizeof(uint32_t), p_words[i]);
+        }
+    }
+    (void)type;
+}
+
+static void get_state_words(SimpleRandomType_t type, void * p_states, const uint8_t * p_buf, size_t num_words)
+{
+    uint32_t          * p_words = (uint32_t *)p_states;
+    size_t              i;
+
+    if (host_is_little_endian())
+    {
+        if (num_words != 0)
+        {
+            memcpy(p_states, p_buf, num_words * sizeof(uint32_t));
+        }
+    }
+#ifdef UINT64_C
+    else if (state_word_size(type) == sizeof(uint64_t))
+    {
+        for (i = 0; i < num_words / 2u; i++)
+        {
+            ((uint64_t *)p_states)[i] = get_uint64_le(p_buf + i * sizeof(uint64_t));
+        }
+    }
+#endif /* defined(UINT64_C) */
+    else
+    {
+        for (i = 0; i < num_words; i++)
+        {
+            p_words[i] = get_uint32_le(p_buf + i * sizeof(uint32_t));
+        }
+    }
+    (void)type;
+}
+
+static void put_header(uint8_t * p_buf, SimpleRandomType_t type, size_t num_words, uint8_t kind, uintmax_t position, size_t num_states)
+{
+    memset(p_buf, 0, SIMPLERANDOM_STATE_HEADER_SIZE);
+    p_buf[0] = STATE_MAGIC_0;
+    p_buf[1] = STATE_MAGIC_1;
+    p_buf[2] = STATE_MAGIC_2;
+    p_buf[3] = STATE_MAGIC_3;
+    p_buf[STATE_OFFSET_VERSION] = SIMPLERANDOM_STATE_VERSION;
+    p_buf[STATE_OFFSET_TYPE] = (uint8_t)type;
+    p_buf[STATE_OFFSET_KIND] = kind;
+    put_uint64_le(p_buf + STATE_OFFSET_POSITION, position);
+    put_uint32_le(p_buf + STATE_OFFSET_NUM_WORDS, (uint32_t)num_words);
+    put_uint64_le(p_buf + STATE_OFFSET_NUM_STATES, num_states);
+}
+
+/* Check a record or array header. Returns the number of state words per
+ * state, or 0 if it is not valid.
+ */
+static size_t check_header(SimpleRandomType_t type, const uint8_t * p_buf, size_t buf_len, uint8_t kind)
+{
+    size_t      num_words;
+
+    num_words = simplerandom_state_num_words(type);
+    if (num_words == 0 ||
+        p_buf == NULL || buf_len < SIMPLERANDOM_STATE_HEADER_SIZE ||
+        p_buf[0] != STATE_MAGIC_0 || p_buf[1] != STATE_MAGIC_1 ||
+        p_buf[2] != STATE_MAGIC_2 || p_buf[3] != STATE_MAGIC_3 ||
+        p_buf[STATE_OFFSET_VERSION] != SIMPLERANDOM_STATE_VERSION ||
+        p_buf[STATE_OFFSET_TYPE] != (uint8_t)type ||
+        p_buf[STATE_OFFSET_KIND] != kind ||
+        get_uint32_le(p_buf + STATE_OFFSET_NUM_WORDS) != num_words)
+    {
+        return 0;
+    }
+    return num_words;
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* Number of uint32_t state words for the given generator type, or 0 if the
+ * type is not known (or not supported in this build).
+ */
+size_t simplerandom_state_num_words(SimpleRandomType_t type)
+{
+    switch (type)
+    {
+        case SIMPLERANDOM_TYPE_CONG:
+            return sizeof(SimpleRandomCong_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_SHR3:
+            return sizeof(SimpleRandomSHR3_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_MWC1:
+            return sizeof(SimpleRandomMWC1_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_MWC2:
+            return sizeof(SimpleRandomMWC2_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_KISS:
+            return sizeof(SimpleRandomKISS_t) / sizeof(uint32_t);
+#ifdef UINT64_C
+        case SIMPLERANDOM_TYPE_MWC64:
+            return sizeof(SimpleRandomMWC64_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_KISS2:
+            return sizeof(SimpleRandomKISS2_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_KISS64:
+            return sizeof(SimpleRandomKISS64_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_CMWC4096:
+            return sizeof(SimpleRandomCMWC4096_t) / sizeof(uint32_t);
+#endif /* defined(UINT64_C) */
+        case SIMPLERANDOM_TYPE_LFSR113:
+            return sizeof(SimpleRandomLFSR113_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_LFSR88:
+            return sizeof(SimpleRandomLFSR88_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_LFIB4:
+            return sizeof(SimpleRandomLFIB4_t) / sizeof(uint32_t);
+        case SIMPLERANDOM_TYPE_SWB:
+            return sizeof(SimpleRandomSWB_t) / sizeof(uint32_t);
+        default:
+            return 0;
+    }
+}
+
+/* Number of bytes in a state record for the given generator type, or 0 if
+ * the type is not known.
+ */
+size_t simplerandom_state_record_size(SimpleRandomType_t type)
+{
+    size_t      num_words;
+
+    num_words = simplerandom_state_num_words(type);
+    if (num_words == 0)
+    {
+        return 0;
+    }
+    return SIMPLERANDOM_STATE_HEADER_SIZE + num_words * sizeof(uint32_t);
+}
+
+size_t simplerandom_state_encode(SimpleRandomType_t type, const void * p_state, uintmax_t position, uint8_t * p_buf, size_t buf_len)
+{
+    size_t              record_size;
+
+    record_size = simplerandom_state_record_size(type);
+    if (record_size == 0 || p_state == NULL ||
+        p_buf == NULL || buf_len < record_size)
+    {
+        return 0;
+    }
+
+    put_header(p_buf, type, simplerandom_state_num_words(type), STATE_KIND_RECORD, position, 0);
+    put_state_words(type, p_buf + SIMPLERANDOM_STATE_HEADER_SIZE, p_state, simplerandom_state_num_words(type));
+    return record_size;
+}
+
+size_t simplerandom_state_decode(SimpleRandomType_t type, void * p_state, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len)
+{
+    size_t              num_words;
+
+    num_words = check_header(type, p_buf, buf_len, STATE_KIND_RECORD);
+    if (num_words == 0 || p_state == NULL ||
+        buf_len < simplerandom_state_record_size(type) ||
+        get_uint64_le(p_buf + STATE_OFFSET_NUM_STATES) != 0)
+    {
+        return 0;
+    }
+
+    get_state_words(type, p_state, p_buf + SIMPLERANDOM_STATE_HEADER_SIZE, num_words);
+    if (p_position != NULL)
+    {
+        *p_position = get_uint64_le(p_buf + STATE_OFFSET_POSITION);
+    }
+    return simplerandom_state_record_size(type);
+}
+
+SimpleRandomType_t simplerandom_state_type(const uint8_t * p_buf, size_t buf_len)
+{
+    SimpleRandomType_t  type;
+
+    if (p_buf == NULL || buf_len < SIMPLERANDOM_STATE_HEADER_SIZE)
+    {
+        return SIMPLERANDOM_TYPE_NONE;
+    }
+    type = (SimpleRandomType_t)p_buf[STATE_OFFSET_TYPE];
+    if (check_header(type, p_buf, buf_len, STATE_KIND_RECORD) == 0 &&
+        check_header(type, p_buf, buf_len, STATE_KIND_ARRAY) == 0)
+    {
+        return SIMPLERANDOM_TYPE_NONE;
+    }
+    return type;
+}
+
+/* Number of bytes needed for a saved array of 'num_states' states. Returns 0
+ * if the type is not known, or the size would overflow size_t.
+ */
+size_t simplerandom_state_array_size(SimpleRandomType_t type, size_t num_states)
+{
+    size_t      state_size;
+
+    state_size = simplerandom_state_num_words(type) * sizeof(uint32_t);
+    if (state_size == 0 ||
+        num_states > (SIZE_MAX - SIMPLERANDOM_STATE_HEADER_SIZE) / state_size)
+    {
+        return 0;
+    }
+    return SIMPLERANDOM_STATE_HEADER_SIZE + num_states * state_size;
+}
+
+size_t simplerandom_state_save_array(SimpleRandomType_t type, const void * p_states, size_t num_states, uintmax_t position, uint8_t * p_buf, size_t buf_len)
+{
+    size_t              array_size;
+    size_t              num_words;
+
+    array_size = simplerandom_state_array_size(type, num_states);
+    if (array_size == 0 || (p_states == NULL && num_states != 0) ||
+        p_buf == NULL || buf_len < array_size)
+    {
+        return 0;
+    }
+    num_words = simplerandom_state_num_words(type);
+
+    put_header(p_buf, type, num_words, STATE_KIND_ARRAY, position, num_states);
+    put_state_words(type, p_buf + SIMPLERANDOM_STATE_HEADER_SIZE, p_states, num_states * num_words);
+    return array_size;
+}
+
+/* Number of states in a saved state array, which may be 0. Returns
+ * SIMPLERANDOM_STATE_ERROR if it is not valid. That can never be a valid
+ * number of states, because the array size would overflow size_t.
+ */
+size_t simplerandom_state_array_num_states(SimpleRandomType_t type, const uint8_t * p_buf, size_t buf_len)
+{
+    uintmax_t   num_states;
+
+    if (check_header(type, p_buf, buf_len, STATE_KIND_ARRAY) == 0)
+    {
+        return SIMPLERANDOM_STATE_ERROR;
+    }
+    num_states = get_uint64_le(p_buf + STATE_OFFSET_NUM_STATES);
+    if (num_states > SIZE_MAX ||
+        simplerandom_state_array_size(type, (size_t)num_states) == 0 ||
+        simplerandom_state_array_size(type, (size_t)num_states) > buf_len)
+    {
+        return SIMPLERANDOM_STATE_ERROR;
+    }
+    return (size_t)num_states;
+}
+
+size_t simplerandom_state_load_array(SimpleRandomType_t type, void * p_states, size_t max_states, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len)
+{
+    size_t              num_states;
+
+    num_states = simplerandom_state_array_num_states(type, p_buf, buf_len);
+    if (num_states == SIMPLERANDOM_STATE_ERROR || num_states > max_states ||
+        (p_states == NULL && num_states != 0))
+    {
+        return SIMPLERANDOM_STATE_ERROR;
+    }
+
+    if (p_position != NULL)
+    {
+        *p_position = get_uint64_le(p_buf + STATE_OFFSET_POSITION);
+    }
+    get_state_words(type, p_states, p_buf + SIMPLERANDOM_STATE_HEADER_SIZE, num_states * simplerandom_state_num_words(type));
+    return num_states;
+}
+
+const void * simplerandom_state_map_array(SimpleRandomType_t type, size_t * p_num_states, uintmax_t * p_position, const uint8_t * p_buf, size_t buf_len)
+{
+    size_t      num_states;
+
+    num_states = simplerandom_state_array_num_states(type, p_buf, buf_len);
+    if (num_states == SIMPLERANDOM_STATE_ERROR || !host_is_little_endian() ||
+        ((uintptr_t)(p_buf + SIMPLERANDOM_STATE_HEADER_SIZE) % state_word_size(type)) != 0)
+    {
+        return NULL;
+    }
+
+    if (p_num_states != NULL)
+    {
+        *p_num_states = num_states;
+    }
+    if (p_position != NULL)
+    {
+        *p_position = get_uint64_le(p_buf + STATE_OFFSET_POSITION);
+    }
+    return p_buf + SIMPLERANDOM_STATE_HEADER_SIZE;
+}
@@ -11,6 +11,215 @@
 
 #include "simplerandom.h"
 
+#include "bitcolumnmatrix.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of generators seeded in each vectorized block by the _seed_batch()
+ * functions. See simplerandom-batch.c for why loops are done in fixed-size
+ * blocks.
+ */
+#define SEED_BATCH_BLOCK        16u
+
+/* Cong "leapfrog" by CONG_LEAP values: x[n+16] = CONG_LEAP_MULT * x[n] +
+ * CONG_LEAP_CONST. As in simplerandom_cong_discard(), these are
+ * pow_uint32(69069, 16) and geom_series_uint32(69069, 16) * 12345.
+ */
+#define CONG_LEAP               16u
+#define CONG_LEAP_MULT          UINT32_C(0x99F9F041)
+#define CONG_LEAP_CONST         UINT32_C(0x57859E30)
+
+/* The linear generators (SHR3, LFSR113, LFSR88) fill in chunks of
+ * FILL_CHUNK values. Each chunk is split into FILL_LANES segments of
+ * FILL_SEGMENT consecutive values, and the segments are generated together.
+ * The segment length is a compromise between the cost of jumping to the
+ * start of each segment, and cache use. A power-of-2 stride much larger than
+ * 1 kB makes the segment writes alias in the L1 cache.
+ */
+#define FILL_LANES              16u
+#define FILL_SEGMENT            256u
+#define FILL_CHUNK              (FILL_LANES * FILL_SEGMENT)
+
+/* Number of generators stepped together by the _fill_multi() functions. Each
+ * generator's step is a short chain of dependent operations, so a single
+ * generator leaves most of the CPU's execution units idle. Interleaving the
+ * steps of independent generators lets them run in parallel, even without
+ * SIMD.
+ */
+#define FILL_MULTI_WAYS         4u
+
+/* Cong jump by FILL_SEGMENT values, for the chunked fill of KISS2. As for
+ * CONG_LEAP_MULT and CONG_LEAP_CONST, with FILL_SEGMENT instead of CONG_LEAP.
+ */
+#define CONG_SEGMENT_MULT       UINT32_C(0x40A68401)
+#define CONG_SEGMENT_CONST      UINT32_C(0x250B8300)
+
+#ifdef UINT64_C
+
+/* MWC64 is equivalent to a multiplicative congruential generator of the
+ * 64-bit state, modulo MWC64_MODULO. See simplerandom_mwc64_discard().
+ * MWC64_SEGMENT_MULT jumps FILL_SEGMENT values ahead. It is
+ * pow_mod_uint64(MWC64_MULT, FILL_SEGMENT, MWC64_MODULO).
+ */
+#define MWC64_MULT              UINT64_C(698769069)
+#define MWC64_MODULO            (MWC64_MULT * (UINT64_C(1) << 32u) - 1u)
+#define MWC64_SEGMENT_MULT      UINT64_C(0x00BC8059DEAB4964)
+
+/* The MWC of KISS64 has multiplier KISS64_MWC_MULT and base 2^64. As for
+ * MWC64, it is equivalent to a multiplicative congruential generator of the
+ * 128-bit state mwc_upper:mwc_lower, modulo KISS64_MWC_MULT * 2^64 - 1.
+ */
+#define KISS64_MWC_MULT         ((UINT64_C(1) << 58u) + 1u)
+#define KISS64_CONG_MULT        UINT64_C(6906969069)
+#define KISS64_CONG_CONST       UINT64_C(1234567)
+
+/* CMWC4096 has multiplier CMWC4096_MULT and base b = 2^32 - 1. Each value is
+ * complemented by subtracting from CMWC4096_R = b - 1.
+ */
+#define CMWC4096_MULT           UINT64_C(18782)
+#define CMWC4096_R              UINT32_C(0xFFFFFFFE)
+#define CMWC4096_MASK           (SIMPLERANDOM_CMWC4096_LAG - 1u)
+
+#endif /* defined(UINT64_C) */
+
+/* Offsets into the table of the lagged-Fibonacci generators, from the new
+ * index, as in Marsaglia's LFIB4 and SWB macros. The value at offset k was
+ * generated LAG(k) steps earlier.
+ */
+#define LAG_TABLE_MASK          (SIMPLERANDOM_LAG_TABLE_SIZE - 1u)
+#define LAG(OFFSET)             (SIMPLERANDOM_LAG_TABLE_SIZE - (OFFSET))
+#define LFIB4_OFFSET_1          58u
+#define LFIB4_OFFSET_2          119u
+#define LFIB4_OFFSET_3          178u
+#define SWB_OFFSET_X            34u
+#define SWB_OFFSET_Y            19u
+
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* Jump matrices to go FILL_SEGMENT values ahead, for the chunked fill
+ * functions. Each is the 'next' matrix of the generator, or LFSR component,
+ * from simplerandom-discard.c, to the power of FILL_SEGMENT. E.g.:
+ *     bitcolumnmatrix32_pow(&shr3_segment_matrix, &shr3_matrix, FILL_SEGMENT);
+ */
+static const BitColumnMatrix32_t shr3_segment_matrix =
+{
+    {
+        0x54EDA13C, 0xE9CD73EE, 0xB77136C3, 0xDEB89E2B, 0x4837DDB4, 0xAA7186BD, 0x47CCFD7D, 0x09409751,
+        0x4852E923, 0x935EB108, 0x58647569, 0x9E1D74F6, 0xE6C5E3F7, 0xB56F517A, 0xDFBAA62A, 0x6551E937,
+        0x1933008C, 0x74359566, 0xB2730C82, 0xC019BE4F, 0x7FEA9452, 0xED17FDB1, 0x926154AF, 0x200C67EB,
+        0x73FC8E9A, 0x68787DF8, 0x70E5D9CC, 0xC61D550E, 0xCB068D93, 0x3BA1B411, 0x0A6B48DA, 0x8C5A768C,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr113_1_segment_matrix =
+{
+    {
+        0x00000000, 0x94FE32D1, 0x29FC65A2, 0x53F8CB45, 0xA7F1968A, 0x4FE32D15, 0x9FC65A2A, 0x3F8CB455,
+        0x7F1968AB, 0xFE32D156, 0xFC65A2AD, 0xF8CB455B, 0xF1968AB7, 0xE32D156E, 0xC65A2ADC, 0x8CB455B9,
+        0x1968AB72, 0x32D156E5, 0x65A2ADCA, 0xCB455B94, 0x968AB728, 0x2D156E50, 0x5A2ADCA1, 0xB455B943,
+        0x68AB7286, 0xD156E50D, 0x3653F8CB, 0x6CA7F196, 0xD94FE32D, 0xB29FC65A, 0x653F8CB4, 0xCA7F1968,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr113_2_segment_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x23400005, 0x4680000A, 0x8D000015, 0x1A00002B, 0x34000057,
+        0x680000AE, 0xD000015C, 0xA00002B9, 0x40000572, 0x80000AE4, 0x000015C8, 0x00002B90, 0x00005720,
+        0x0000AE40, 0x00015C80, 0x0002B900, 0x00057200, 0x000AE400, 0x0015C800, 0x002B9000, 0x00572000,
+        0x00AE4000, 0x015C8000, 0x02B90000, 0x05720000, 0x0AE40001, 0x15C80002, 0x08D00001, 0x11A00002,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr113_3_segment_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D4148A3, 0x3A829146, 0x7505228D, 0xEA0A451A,
+        0xD4148A34, 0xA8291468, 0x505228D1, 0xA0A451A2, 0x4148A345, 0x8291468A, 0x05228D15, 0x0A451A2A,
+        0x148A3455, 0x291468AA, 0x5228D154, 0xB910EA0A, 0x7221D414, 0xE443A829, 0xC8875052, 0x910EA0A4,
+        0x221D4148, 0x443A8291, 0x88750522, 0x10EA0A45, 0x21D4148A, 0x43A82914, 0x87505228, 0x0EA0A451,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr113_4_segment_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA2CA02DA,
+        0x459405B4, 0x8B280B69, 0x165016D2, 0x2CA02DA4, 0x59405B49, 0xB280B693, 0x65016D26, 0xCA02DA4D,
+        0x9405B49A, 0x280B6934, 0x5016D268, 0xA02DA4D0, 0x405B49A1, 0x80B69342, 0x016D2685, 0x02DA4D0A,
+        0x05B49A14, 0x0B693428, 0x16D26850, 0x2DA4D0A0, 0x5B49A140, 0x1459405B, 0x28B280B6, 0x5165016D,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr88_1_segment_matrix =
+{
+    {
+        0x00000000, 0xBE1DE33E, 0x7C3BC67C, 0xF8778CF8, 0xF0EF19F0, 0xE1DE33E0, 0xC3BC67C0, 0x8778CF81,
+        0x0EF19F02, 0x1DE33E04, 0x3BC67C09, 0x778CF813, 0xEF19F027, 0xDE33E04F, 0xBC67C09E, 0x78CF813D,
+        0xF19F027A, 0xE33E04F4, 0xC67C09E8, 0x32E5F0EF, 0x65CBE1DE, 0xCB97C3BC, 0x972F8778, 0x2E5F0EF1,
+        0x5CBE1DE3, 0xB97C3BC6, 0x72F8778C, 0xE5F0EF19, 0xCBE1DE33, 0x97C3BC67, 0x2F8778CF, 0x5F0EF19F,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr88_2_segment_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x14115002, 0x2822A004, 0x50454008, 0xA08A8011, 0x41150022,
+        0x822A0044, 0x04540088, 0x08A80111, 0x11500222, 0x22A00445, 0x4540088A, 0x8A801115, 0x1500222A,
+        0x2A004454, 0x540088A8, 0xA8011150, 0x500222A0, 0xA0044541, 0x40088A82, 0x80111504, 0x00222A08,
+        0x00445410, 0x0088A820, 0x01115040, 0x0222A080, 0x04454100, 0x088A8201, 0x05045400, 0x0A08A801,
+    },
+};
+
+static const BitColumnMatrix32_t lfsr88_3_segment_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x938110D0, 0x270221A1, 0x4E044343, 0x9C088687,
+        0x38110D0F, 0x70221A1F, 0xE044343E, 0xC088687C, 0x8110D0F8, 0x0221A1F1, 0x044343E2, 0x088687C4,
+        0x110D0F89, 0x221A1F13, 0x44343E26, 0x88687C4C, 0x10D0F899, 0x21A1F132, 0x4343E265, 0x8687C4CB,
+        0x0D0F8996, 0x1A1F132C, 0x343E2659, 0x687C4CB2, 0xD0F89965, 0x3270221A, 0x64E04434, 0xC9C08868,
+    },
+};
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+/* Combine two consecutive 32-bit generator values into a 64-bit value, for
+ * the _next64() and _fill64() functions. The first value is the low word.
+ * This is the same order as getrandbits(64) in the Python simplerandom.random
+ * module, and as reading a pair of simplerandom_zzz_fill() values as one
+ * uint64_t on a little-endian CPU.
+ */
+static inline uint64_t value64(uint32_t first, uint32_t second)
+{
+    return ((uint64_t)second << 32u) | first;
+}
+
+/* Combine 2 * 'num_out' 32-bit values from 'p_in' into 'num_out' 64-bit
+ * values in 'p_out', with value64().
+ */
+static void fill64_combine(uint64_t * restrict p_out, const uint32_t * restrict p_in, size_t num_out)
+{
+    size_t      i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = value64(p_in[2u * i], p_in[2u * i + 1u]);
+    }
+}
+
+#endif /* defined(UINT64_C) */
+
 
 /*****************************************************************************
  * Functions
@@ -24,7 +233,7 @@ size_t simplerandom_cong_num_seeds(const SimpleRandomCong_t * p_cong)
 {
     (void)p_cong;   /* We only use this parameter for type checking. */
 
-    return 1u;
+    return SIMPLERANDOM_CONG_NUM_SEEDS;
 }
 
 size_t simplerandom_cong_seed_array(SimpleRandomCong_t * p_cong, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -53,13 +262,42 @@ void simplerandom_cong_seed(SimpleRandomCong_t * p_cong, uint32_t seed)
     /* No sanitize is needed because for Cong, all state values are valid. */
 }
 
+/* Seed the 'count' generators in the array 'p_cong'. 'p_seeds' holds one seed
+ * value for each generator. This gives the same states as calling
+ * simplerandom_cong_seed() for each generator.
+ */
+void simplerandom_cong_seed_batch(SimpleRandomCong_t * restrict p_cong, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_cong[n].cong = p_seeds[n];
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_cong[n].cong = p_seeds[n];
+    }
+}
+
 void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong)
 {
     /* All state values are valid for Cong. No sanitizing needed. */
     (void) p_cong;
 }
 
-uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong)
+/* Inline version of simplerandom_cong_next(), for the fill functions. In a
+ * shared library, the compiler can't inline calls to the public
+ * simplerandom_zzz_next() functions, because they could be interposed by
+ * another library. So each generator has an inline zzz_next() function.
+ */
+static inline uint32_t cong_next(SimpleRandomCong_t * p_cong)
 {
     uint32_t    cong;
 
@@ -69,6 +307,163 @@ uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong)
     return cong;
 }
 
+uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong)
+{
+    return cong_next(p_cong);
+}
+
+/* Given the first CONG_LEAP values in p_out[], calculate the rest from the
+ * values CONG_LEAP before them. The CONG_LEAP values in each step are
+ * independent, so the compiler can vectorize them.
+ */
+static void cong_fill_leapfrog(uint32_t * restrict p_out, size_t num_out)
+{
+    uint32_t    cong[CONG_LEAP];
+    size_t      i;
+    size_t      j;
+
+    for (j = 0; j < CONG_LEAP; j++)
+    {
+        cong[j] = p_out[j];
+    }
+    for (i = CONG_LEAP; i + CONG_LEAP <= num_out; i += CONG_LEAP)
+    {
+        for (j = 0; j < CONG_LEAP; j++)
+        {
+            cong[j] = CONG_LEAP_MULT * cong[j] + CONG_LEAP_CONST;
+            p_out[i + j] = cong[j];
+        }
+    }
+    for (j = 0; i + j < num_out; j++)
+    {
+        p_out[i + j] = CONG_LEAP_MULT * cong[j] + CONG_LEAP_CONST;
+    }
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_cong_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. For longer fills, all but
+ * the first CONG_LEAP values are calculated by leapfrogging.
+ */
+void simplerandom_cong_fill(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomCong_t    cong = *p_cong;
+    size_t                i;
+
+    if (num_out >= 2u * CONG_LEAP)
+    {
+        for (i = 0; i < CONG_LEAP; i++)
+        {
+            p_out[i] = cong_next(&cong);
+        }
+        cong_fill_leapfrog(p_out, num_out);
+        /* The Cong state is the same as its last output. */
+        cong.cong = p_out[num_out - 1u];
+    }
+    else
+    {
+        for (i = 0; i < num_out; i++)
+        {
+            p_out[i] = cong_next(&cong);
+        }
+    }
+    *p_cong = cong;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_cong', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1]. This gives the same
+ * values as calling simplerandom_cong_fill() for each generator, but
+ * FILL_MULTI_WAYS generators are stepped together, to hide the latency of
+ * each step.
+ * Long fills are already faster with simplerandom_cong_fill(), so those are
+ * done one generator at a time.
+ */
+void simplerandom_cong_fill_multi(SimpleRandomCong_t * p_cong, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomCong_t    state0;
+    SimpleRandomCong_t    state1;
+    SimpleRandomCong_t    state2;
+    SimpleRandomCong_t    state3;
+    uint32_t            * p_out0;
+    uint32_t            * p_out1;
+    uint32_t            * p_out2;
+    uint32_t            * p_out3;
+    size_t                i;
+    size_t                k = 0;
+
+    if (num_out < 2u * CONG_LEAP)
+    {
+        for ( ; k + FILL_MULTI_WAYS <= num_states; k += FILL_MULTI_WAYS)
+        {
+            state0 = p_cong[k];
+            state1 = p_cong[k + 1u];
+            state2 = p_cong[k + 2u];
+            state3 = p_cong[k + 3u];
+            p_out0 = p_out + k * num_out;
+            p_out1 = p_out0 + num_out;
+            p_out2 = p_out1 + num_out;
+            p_out3 = p_out2 + num_out;
+            for (i = 0; i < num_out; i++)
+            {
+                p_out0[i] = cong_next(&state0);
+                p_out1[i] = cong_next(&state1);
+                p_out2[i] = cong_next(&state2);
+                p_out3[i] = cong_next(&state3);
+            }
+            p_cong[k] = state0;
+            p_cong[k + 1u] = state1;
+            p_cong[k + 2u] = state2;
+            p_cong[k + 3u] = state3;
+        }
+    }
+    for ( ; k < num_states; k++)
+    {
+        simplerandom_cong_fill(&p_cong[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_cong_next(), as one 64-bit value. See value64(). */
+static inline uint64_t cong_next64(SimpleRandomCong_t * p_cong)
+{
+    uint32_t    first;
+
+    first = cong_next(p_cong);
+    return value64(first, cong_next(p_cong));
+}
+
+uint64_t simplerandom_cong_next64(SimpleRandomCong_t * p_cong)
+{
+    return cong_next64(p_cong);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_cong_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_cong_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_cong_fill64(SimpleRandomCong_t * p_cong, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomCong_t    cong = *p_cong;
+    uint32_t              buf[FILL_CHUNK];
+    size_t                i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_cong_fill(&cong, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = cong_next64(&cong);
+    }
+    *p_cong = cong;
+}
+
+#endif /* defined(UINT64_C) */
+
 void simplerandom_cong_mix(SimpleRandomCong_t * p_cong, const uint32_t * p_data, size_t num_data)
 {
     if (p_data != NULL)
@@ -91,7 +486,7 @@ size_t simplerandom_shr3_num_seeds(const SimpleRandomSHR3_t * p_shr3)
 {
     (void)p_shr3;   /* We only use this parameter for type checking. */
 
-    return 1u;
+    return SIMPLERANDOM_SHR3_NUM_SEEDS;
 }
 
 size_t simplerandom_shr3_seed_array(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -129,10 +524,43 @@ void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3)
     }
 }
 
-uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3)
+/* Branchless equivalent of simplerandom_shr3_sanitize(), for seeding arrays
+ * of generators. The conditional expression becomes a SIMD compare and select
+ * when the compiler vectorizes the loop.
+ */
+static inline uint32_t shr3_sanitized(uint32_t shr3)
 {
-    uint32_t    shr3;
+    return (shr3 == 0) ? UINT32_C(0xFFFFFFFF) : shr3;
+}
+
+/* Seed the 'count' generators in the array 'p_shr3'. 'p_seeds' holds one seed
+ * value for each generator. This gives the same states as calling
+ * simplerandom_shr3_seed() for each generator, but the loop is branchless so
+ * that the compiler can vectorize it.
+ */
+void simplerandom_shr3_seed_batch(SimpleRandomSHR3_t * restrict p_shr3, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_shr3[n].shr3 = shr3_sanitized(p_seeds[n]);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_shr3[n].shr3 = shr3_sanitized(p_seeds[n]);
+    }
+}
 
+static inline uint32_t shr3_next(SimpleRandomSHR3_t * p_shr3)
+{
+    uint32_t    shr3;
 
     shr3 = p_shr3->shr3;
     shr3 ^= (shr3 << 13);
@@ -143,6 +571,161 @@ uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3)
     return shr3;
 }
 
+uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3)
+{
+    return shr3_next(p_shr3);
+}
+
+/* Generate FILL_CHUNK values into 'p_out', and update the generator state.
+ * Each of FILL_LANES lanes generates one FILL_SEGMENT segment of the output.
+ * Each lane starts FILL_SEGMENT values ahead of the previous lane, by
+ * multiplying by shr3_segment_matrix. The lanes are independent, so the
+ * compiler can vectorize them.
+ */
+static void shr3_fill_chunk(SimpleRandomSHR3_t * p_shr3, uint32_t * restrict p_out)
+{
+    uint32_t    shr3[FILL_LANES];
+    uint32_t    x;
+    size_t      i;
+    size_t      j;
+
+    shr3[0] = p_shr3->shr3;
+    for (j = 1; j < FILL_LANES; j++)
+    {
+        shr3[j] = bitcolumnmatrix32_mul_uint32(&shr3_segment_matrix, shr3[j - 1u]);
+    }
+    for (i = 0; i < FILL_SEGMENT; i++)
+    {
+        for (j = 0; j < FILL_LANES; j++)
+        {
+            x = shr3[j];
+            x ^= (x << 13);
+            x ^= (x >> 17);
+            x ^= (x << 5);
+            shr3[j] = x;
+            p_out[j * FILL_SEGMENT + i] = x;
+        }
+    }
+    /* The last lane has finished where the whole chunk finishes. */
+    p_shr3->shr3 = shr3[FILL_LANES - 1u];
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_shr3_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. Longer fills are done in
+ * chunks of FILL_CHUNK values, by shr3_fill_chunk().
+ */
+void simplerandom_shr3_fill(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomSHR3_t    shr3 = *p_shr3;
+    size_t                i;
+
+    for ( ; num_out >= FILL_CHUNK; num_out -= FILL_CHUNK)
+    {
+        shr3_fill_chunk(&shr3, p_out);
+        p_out += FILL_CHUNK;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = shr3_next(&shr3);
+    }
+    *p_shr3 = shr3;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_shr3', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1]. This gives the same
+ * values as calling simplerandom_shr3_fill() for each generator, but
+ * FILL_MULTI_WAYS generators are stepped together, to hide the latency of
+ * each step.
+ * Long fills are already faster with simplerandom_shr3_fill(), so those are
+ * done one generator at a time.
+ */
+void simplerandom_shr3_fill_multi(SimpleRandomSHR3_t * p_shr3, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomSHR3_t    state0;
+    SimpleRandomSHR3_t    state1;
+    SimpleRandomSHR3_t    state2;
+    SimpleRandomSHR3_t    state3;
+    uint32_t            * p_out0;
+    uint32_t            * p_out1;
+    uint32_t            * p_out2;
+    uint32_t            * p_out3;
+    size_t                i;
+    size_t                k = 0;
+
+    if (num_out < FILL_CHUNK)
+    {
+        for ( ; k + FILL_MULTI_WAYS <= num_states; k += FILL_MULTI_WAYS)
+        {
+            state0 = p_shr3[k];
+            state1 = p_shr3[k + 1u];
+            state2 = p_shr3[k + 2u];
+            state3 = p_shr3[k + 3u];
+            p_out0 = p_out + k * num_out;
+            p_out1 = p_out0 + num_out;
+            p_out2 = p_out1 + num_out;
+            p_out3 = p_out2 + num_out;
+            for (i = 0; i < num_out; i++)
+            {
+                p_out0[i] = shr3_next(&state0);
+                p_out1[i] = shr3_next(&state1);
+                p_out2[i] = shr3_next(&state2);
+                p_out3[i] = shr3_next(&state3);
+            }
+            p_shr3[k] = state0;
+            p_shr3[k + 1u] = state1;
+            p_shr3[k + 2u] = state2;
+            p_shr3[k + 3u] = state3;
+        }
+    }
+    for ( ; k < num_states; k++)
+    {
+        simplerandom_shr3_fill(&p_shr3[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_shr3_next(), as one 64-bit value. See value64(). */
+static inline uint64_t shr3_next64(SimpleRandomSHR3_t * p_shr3)
+{
+    uint32_t    first;
+
+    first = shr3_next(p_shr3);
+    return value64(first, shr3_next(p_shr3));
+}
+
+uint64_t simplerandom_shr3_next64(SimpleRandomSHR3_t * p_shr3)
+{
+    return shr3_next64(p_shr3);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_shr3_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_shr3_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_shr3_fill64(SimpleRandomSHR3_t * p_shr3, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomSHR3_t    shr3 = *p_shr3;
+    uint32_t              buf[FILL_CHUNK];
+    size_t                i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_shr3_fill(&shr3, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = shr3_next64(&shr3);
+    }
+    *p_shr3 = shr3;
+}
+
+#endif /* defined(UINT64_C) */
+
 void simplerandom_shr3_mix(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data, size_t num_data)
 {
     if (p_data != NULL)
@@ -169,7 +752,7 @@ size_t simplerandom_mwc2_num_seeds(const SimpleRandomMWC2_t * p_mwc)
 {
     (void)p_mwc;    /* We only use this parameter for type checking. */
 
-    return 2u;
+    return SIMPLERANDOM_MWC2_NUM_SEEDS;
 }
 
 size_t simplerandom_mwc2_seed_array(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -276,6 +859,71 @@ void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc)
     mwc2_sanitize_lower(p_mwc);
 }
 
+/* Branchless equivalents of mwc2_sanitize_upper() and mwc2_sanitize_lower(),
+ * for seeding arrays of generators. Both the original and the inverted value
+ * are reduced, and the choices are made with masks rather than branches, so
+ * the compiler can vectorize the loop.
+ */
+static inline uint32_t mwc_upper_reduce(uint32_t x)
+{
+    /* Equivalent to % 0x9068FFFF, for uint32_t. */
+    return x - (UINT32_C(0x9068FFFF) & -(uint32_t)(x >= UINT32_C(0x9068FFFF)));
+}
+
+static inline uint32_t mwc_lower_reduce(uint32_t x)
+{
+    /* Equivalent to % 0x464FFFFF, for uint32_t. */
+    x -= UINT32_C(0x464FFFFF) & -(uint32_t)(x >= UINT32_C(0x464FFFFF));
+    x -= UINT32_C(0x464FFFFF) & -(uint32_t)(x >= UINT32_C(0x464FFFFF));
+    x -= UINT32_C(0x464FFFFF) & -(uint32_t)(x >= UINT32_C(0x464FFFFF));
+    return x;
+}
+
+/* Returns 'temp', or 'temp_alt' if 'temp' is zero. */
+static inline uint32_t mwc_select_nonzero(uint32_t temp, uint32_t temp_alt)
+{
+    return temp ^ ((temp ^ temp_alt) & -(uint32_t)(temp == 0));
+}
+
+static inline uint32_t mwc_upper_sanitized(uint32_t mwc_upper)
+{
+    return mwc_select_nonzero(mwc_upper_reduce(mwc_upper),
+                              mwc_upper_reduce(mwc_upper ^ UINT32_C(0xFFFFFFFF)));
+}
+
+static inline uint32_t mwc_lower_sanitized(uint32_t mwc_lower)
+{
+    return mwc_select_nonzero(mwc_lower_reduce(mwc_lower),
+                              mwc_lower_reduce(mwc_lower ^ UINT32_C(0xFFFFFFFF)));
+}
+
+/* Seed the 'count' generators in the array 'p_mwc'. 'p_seeds' holds two seed values for
+ * each generator, in the order of the arguments of simplerandom_mwc2_seed(). This gives
+ * the same states as calling simplerandom_mwc2_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_mwc2_seed_batch(SimpleRandomMWC2_t * restrict p_mwc, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_mwc[n].mwc_upper = mwc_upper_sanitized(p_seeds[2u * n]);
+            p_mwc[n].mwc_lower = mwc_lower_sanitized(p_seeds[2u * n + 1u]);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_mwc[n].mwc_upper = mwc_upper_sanitized(p_seeds[2u * n]);
+        p_mwc[n].mwc_lower = mwc_lower_sanitized(p_seeds[2u * n + 1u]);
+    }
+}
+
 static inline void mwc2_next_upper(SimpleRandomMWC2_t * p_mwc)
 {
     p_mwc->mwc_upper = 36969u * (p_mwc->mwc_upper & 0xFFFFu) + (p_mwc->mwc_upper >> 16u);
@@ -291,20 +939,122 @@ static inline void mwc2_next_lower(SimpleRandomMWC2_t * p_mwc)
  * combining the upper and lower values in the last step, the upper 16 bits of
  * mwc_upper are added in too, instead of just being discarded.
  */
-uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc)
+static inline uint32_t mwc2_next(SimpleRandomMWC2_t * p_mwc)
 {
     mwc2_next_upper(p_mwc);
     mwc2_next_lower(p_mwc);
     return mwc2_current(p_mwc);
 }
 
-void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data)
+uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc)
 {
-    uint32_t    current;
+    return mwc2_next(p_mwc);
+}
 
-    if (p_data != NULL)
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc2_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop.
+ */
+void simplerandom_mwc2_fill(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC2_t    mwc = *p_mwc;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
     {
-        while (num_data)
+        p_out[i] = mwc2_next(&mwc);
+    }
+    *p_mwc = mwc;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_mwc', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1]. This gives the same
+ * values as calling simplerandom_mwc2_fill() for each generator, but
+ * FILL_MULTI_WAYS generators are stepped together, to hide the latency of
+ * each step.
+ */
+void simplerandom_mwc2_fill_multi(SimpleRandomMWC2_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC2_t    state0;
+    SimpleRandomMWC2_t    state1;
+    SimpleRandomMWC2_t    state2;
+    SimpleRandomMWC2_t    state3;
+    uint32_t            * p_out0;
+    uint32_t            * p_out1;
+    uint32_t            * p_out2;
+    uint32_t            * p_out3;
+    size_t                i;
+    size_t                k = 0;
+
+    for ( ; k + FILL_MULTI_WAYS <= num_states; k += FILL_MULTI_WAYS)
+    {
+        state0 = p_mwc[k];
+        state1 = p_mwc[k + 1u];
+        state2 = p_mwc[k + 2u];
+        state3 = p_mwc[k + 3u];
+        p_out0 = p_out + k * num_out;
+        p_out1 = p_out0 + num_out;
+        p_out2 = p_out1 + num_out;
+        p_out3 = p_out2 + num_out;
+        for (i = 0; i < num_out; i++)
+        {
+            p_out0[i] = mwc2_next(&state0);
+            p_out1[i] = mwc2_next(&state1);
+            p_out2[i] = mwc2_next(&state2);
+            p_out3[i] = mwc2_next(&state3);
+        }
+        p_mwc[k] = state0;
+        p_mwc[k + 1u] = state1;
+        p_mwc[k + 2u] = state2;
+        p_mwc[k + 3u] = state3;
+    }
+    for ( ; k < num_states; k++)
+    {
+        simplerandom_mwc2_fill(&p_mwc[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_mwc2_next(), as one 64-bit value. See value64(). */
+static inline uint64_t mwc2_next64(SimpleRandomMWC2_t * p_mwc)
+{
+    uint32_t    first;
+
+    first = mwc2_next(p_mwc);
+    return value64(first, mwc2_next(p_mwc));
+}
+
+uint64_t simplerandom_mwc2_next64(SimpleRandomMWC2_t * p_mwc)
+{
+    return mwc2_next64(p_mwc);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc2_next64() 'num_out' times.
+ */
+void simplerandom_mwc2_fill64(SimpleRandomMWC2_t * p_mwc, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC2_t    mwc2 = *p_mwc;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = mwc2_next64(&mwc2);
+    }
+    *p_mwc = mwc2;
+}
+
+#endif /* defined(UINT64_C) */
+
+void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data)
+{
+    uint32_t    current;
+
+    if (p_data != NULL)
+    {
+        while (num_data)
         {
             --num_data;
             current = mwc2_current(p_mwc);
@@ -336,7 +1086,7 @@ size_t simplerandom_mwc1_num_seeds(const SimpleRandomMWC1_t * p_mwc)
 {
     (void)p_mwc;    /* We only use this parameter for type checking. */
 
-    return 2u;
+    return SIMPLERANDOM_MWC1_NUM_SEEDS;
 }
 
 /* This is almost identical to simplerandom_mwc2_seed_array(), except the mix
@@ -381,13 +1131,123 @@ void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc)
     simplerandom_mwc2_sanitize(p_mwc);
 }
 
-uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc)
+/*
+ * See notes for simplerandom_mwc2_seed_batch().
+ */
+void simplerandom_mwc1_seed_batch(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_seeds, size_t count)
+{
+    simplerandom_mwc2_seed_batch(p_mwc, p_seeds, count);
+}
+
+static inline uint32_t mwc1_next(SimpleRandomMWC1_t * p_mwc)
 {
     mwc2_next_upper(p_mwc);
     mwc2_next_lower(p_mwc);
     return mwc1_current(p_mwc);
 }
 
+uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc)
+{
+    return mwc1_next(p_mwc);
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc1_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop.
+ */
+void simplerandom_mwc1_fill(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC1_t    mwc = *p_mwc;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = mwc1_next(&mwc);
+    }
+    *p_mwc = mwc;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_mwc', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1]. This gives the same
+ * values as calling simplerandom_mwc1_fill() for each generator, but
+ * FILL_MULTI_WAYS generators are stepped together, to hide the latency of
+ * each step.
+ */
+void simplerandom_mwc1_fill_multi(SimpleRandomMWC1_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC1_t    state0;
+    SimpleRandomMWC1_t    state1;
+    SimpleRandomMWC1_t    state2;
+    SimpleRandomMWC1_t    state3;
+    uint32_t            * p_out0;
+    uint32_t            * p_out1;
+    uint32_t            * p_out2;
+    uint32_t            * p_out3;
+    size_t                i;
+    size_t                k = 0;
+
+    for ( ; k + FILL_MULTI_WAYS <= num_states; k += FILL_MULTI_WAYS)
+    {
+        state0 = p_mwc[k];
+        state1 = p_mwc[k + 1u];
+        state2 = p_mwc[k + 2u];
+        state3 = p_mwc[k + 3u];
+        p_out0 = p_out + k * num_out;
+        p_out1 = p_out0 + num_out;
+        p_out2 = p_out1 + num_out;
+        p_out3 = p_out2 + num_out;
+        for (i = 0; i < num_out; i++)
+        {
+            p_out0[i] = mwc1_next(&state0);
+            p_out1[i] = mwc1_next(&state1);
+            p_out2[i] = mwc1_next(&state2);
+            p_out3[i] = mwc1_next(&state3);
+        }
+        p_mwc[k] = state0;
+        p_mwc[k + 1u] = state1;
+        p_mwc[k + 2u] = state2;
+        p_mwc[k + 3u] = state3;
+    }
+    for ( ; k < num_states; k++)
+    {
+        simplerandom_mwc1_fill(&p_mwc[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_mwc1_next(), as one 64-bit value. See value64(). */
+static inline uint64_t mwc1_next64(SimpleRandomMWC1_t * p_mwc)
+{
+    uint32_t    first;
+
+    first = mwc1_next(p_mwc);
+    return value64(first, mwc1_next(p_mwc));
+}
+
+uint64_t simplerandom_mwc1_next64(SimpleRandomMWC1_t * p_mwc)
+{
+    return mwc1_next64(p_mwc);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc1_next64() 'num_out' times.
+ */
+void simplerandom_mwc1_fill64(SimpleRandomMWC1_t * p_mwc, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC1_t    mwc1 = *p_mwc;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = mwc1_next64(&mwc1);
+    }
+    *p_mwc = mwc1;
+}
+
+#endif /* defined(UINT64_C) */
+
 /* This is nearly identical to the MWC2 mix function, except for the call to
  * mwc1_current() which is the essence of the difference between MWC1 and MWC2.
  */
@@ -427,7 +1287,7 @@ size_t simplerandom_kiss_num_seeds(const SimpleRandomKISS_t * p_kiss)
 {
     (void)p_kiss;   /* We only use this parameter for type checking. */
 
-    return 4u;
+    return SIMPLERANDOM_KISS_NUM_SEEDS;
 }
 
 size_t simplerandom_kiss_seed_array(SimpleRandomKISS_t * p_kiss, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -540,6 +1400,37 @@ void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss)
     kiss_sanitize_shr3(p_kiss);
 }
 
+/* Seed the 'count' generators in the array 'p_kiss'. 'p_seeds' holds four seed values for
+ * each generator, in the order of the arguments of simplerandom_kiss_seed(). This gives
+ * the same states as calling simplerandom_kiss_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_kiss_seed_batch(SimpleRandomKISS_t * restrict p_kiss, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_kiss[n].mwc_upper = mwc_upper_sanitized(p_seeds[4u * n]);
+            p_kiss[n].mwc_lower = mwc_lower_sanitized(p_seeds[4u * n + 1u]);
+            p_kiss[n].cong = p_seeds[4u * n + 2u];
+            p_kiss[n].shr3 = shr3_sanitized(p_seeds[4u * n + 3u]);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_kiss[n].mwc_upper = mwc_upper_sanitized(p_seeds[4u * n]);
+        p_kiss[n].mwc_lower = mwc_lower_sanitized(p_seeds[4u * n + 1u]);
+        p_kiss[n].cong = p_seeds[4u * n + 2u];
+        p_kiss[n].shr3 = shr3_sanitized(p_seeds[4u * n + 3u]);
+    }
+}
+
 static inline void kiss_next_mwc_upper(SimpleRandomKISS_t * p_kiss)
 {
     p_kiss->mwc_upper = 36969u * (p_kiss->mwc_upper & 0xFFFFu) + (p_kiss->mwc_upper >> 16u);
@@ -566,7 +1457,7 @@ static inline void kiss_next_shr3(SimpleRandomKISS_t * p_kiss)
     p_kiss->shr3 = shr3;
 }
 
-uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss)
+static inline uint32_t kiss_next(SimpleRandomKISS_t * p_kiss)
 {
     kiss_next_mwc_upper(p_kiss);
     kiss_next_mwc_lower(p_kiss);
@@ -575,6 +1466,78 @@ uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss)
     return kiss_current(p_kiss);
 }
 
+uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss)
+{
+    return kiss_next(p_kiss);
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_kiss_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop.
+ */
+void simplerandom_kiss_fill(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS_t    kiss = *p_kiss;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = kiss_next(&kiss);
+    }
+    *p_kiss = kiss;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_kiss', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1].
+ *
+ * KISS combines 4 independent generators, whose steps already run in
+ * parallel, so there is nothing to gain by stepping several generators
+ * together. This just calls simplerandom_kiss_fill() for each generator.
+ */
+void simplerandom_kiss_fill_multi(SimpleRandomKISS_t * p_kiss, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    size_t      k;
+
+    for (k = 0; k < num_states; k++)
+    {
+        simplerandom_kiss_fill(&p_kiss[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_kiss_next(), as one 64-bit value. See value64(). */
+static inline uint64_t kiss_next64(SimpleRandomKISS_t * p_kiss)
+{
+    uint32_t    first;
+
+    first = kiss_next(p_kiss);
+    return value64(first, kiss_next(p_kiss));
+}
+
+uint64_t simplerandom_kiss_next64(SimpleRandomKISS_t * p_kiss)
+{
+    return kiss_next64(p_kiss);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_kiss_next64() 'num_out' times.
+ */
+void simplerandom_kiss_fill64(SimpleRandomKISS_t * p_kiss, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS_t    kiss = *p_kiss;
+    size_t                i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = kiss_next64(&kiss);
+    }
+    *p_kiss = kiss;
+}
+
+#endif /* defined(UINT64_C) */
+
 void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data, size_t num_data)
 {
     uint32_t    current;
@@ -623,7 +1586,7 @@ size_t simplerandom_mwc64_num_seeds(const SimpleRandomMWC64_t * p_mwc)
 {
     (void)p_mwc;    /* We only use this parameter for type checking. */
 
-    return 2u;
+    return SIMPLERANDOM_MWC64_NUM_SEEDS;
 }
 
 size_t simplerandom_mwc64_seed_array(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -693,16 +1656,59 @@ void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc)
     }
 }
 
+/* Branchless equivalent of simplerandom_mwc64_sanitize(), for seeding arrays
+ * of generators. The modulo by a constant is done by the compiler with
+ * multiplication rather than division.
+ */
+static inline uint64_t mwc64_sanitized(uint64_t state64)
+{
+    uint64_t    temp64;
+    uint64_t    temp64_alt;
+
+    temp64 = state64 % UINT64_C(0x29A65EACFFFFFFFF);
+    temp64_alt = (state64 ^ UINT64_C(0xFFFFFFFFFFFFFFFF)) % UINT64_C(0x29A65EACFFFFFFFF);
+    return (temp64 == 0) ? temp64_alt : temp64;
+}
+
+/* Seed the 'count' generators in the array 'p_mwc'. 'p_seeds' holds two seed values for
+ * each generator, in the order of the arguments of simplerandom_mwc64_seed(). This gives
+ * the same states as calling simplerandom_mwc64_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_mwc64_seed_batch(SimpleRandomMWC64_t * restrict p_mwc, const uint32_t * restrict p_seeds, size_t count)
+{
+    uint64_t    temp64;
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            temp64 = mwc64_sanitized(((uint64_t)p_seeds[2u * n] << 32u) + p_seeds[2u * n + 1u]);
+            p_mwc[n].mwc_upper = (uint32_t)(temp64 >> 32u);
+            p_mwc[n].mwc_lower = (uint32_t)temp64;
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        temp64 = mwc64_sanitized(((uint64_t)p_seeds[2u * n] << 32u) + p_seeds[2u * n + 1u]);
+        p_mwc[n].mwc_upper = (uint32_t)(temp64 >> 32u);
+        p_mwc[n].mwc_lower = (uint32_t)temp64;
+    }
+}
+
 static inline uint32_t mwc64_current(SimpleRandomMWC64_t * p_mwc)
 {
     return p_mwc->mwc_lower;
 }
 
-uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc)
+static inline uint32_t mwc64_next(SimpleRandomMWC64_t * p_mwc)
 {
     uint64_t    mwc64;
 
-
     mwc64 = UINT64_C(698769069) * p_mwc->mwc_lower + p_mwc->mwc_upper;
     p_mwc->mwc_upper = (mwc64 >> 32u);
     p_mwc->mwc_lower = (uint32_t)mwc64;
@@ -710,6 +1716,206 @@ uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc)
     return (uint32_t)mwc64;
 }
 
+uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc)
+{
+    return mwc64_next(p_mwc);
+}
+
+/* Multiply 'x' by 2^32, modulo MWC64_MODULO, for 'x' < MWC64_MODULO.
+ *
+ * Since MWC64_MULT * 2^32 is 1 modulo MWC64_MODULO, this is the inverse of an
+ * MWC64 step: the 64-bit state whose next state is 'x'.
+ */
+static inline uint64_t mwc64_mul_2_32_mod(uint64_t x)
+{
+    return ((x % MWC64_MULT) << 32u) + x / MWC64_MULT;
+}
+
+/* Multiply 'a' and 'b', modulo MWC64_MODULO, for 'a' and 'b' both less than
+ * MWC64_MODULO.
+ *
+ * This is the same as mul_mod_uint64(a, b, MWC64_MODULO), but much faster. It
+ * multiplies 32-bit halves, and shifts the partial sums up by 2^32 with
+ * mwc64_mul_2_32_mod(). All the intermediate values fit in 64 bits. The
+ * modulo by a constant is done by the compiler with multiplication rather
+ * than division.
+ */
+static uint64_t mwc64_mul_mod(uint64_t a, uint64_t b)
+{
+    uint64_t    a_upper = a >> 32u;
+    uint64_t    a_lower = (uint32_t)a;
+    uint64_t    b_upper = b >> 32u;
+    uint64_t    b_lower = (uint32_t)b;
+    uint64_t    result;
+
+    result = mwc64_mul_2_32_mod(a_upper * b_upper);
+    result = (result + (a_upper * b_lower) % MWC64_MODULO + (a_lower * b_upper) % MWC64_MODULO) % MWC64_MODULO;
+    result = mwc64_mul_2_32_mod(result);
+    result = (result + (a_lower * b_lower) % MWC64_MODULO) % MWC64_MODULO;
+    return result;
+}
+
+/* Find the start states of the FILL_LANES segments of a fill chunk, for the
+ * MWC64 generator whose 64-bit state is 'mwc64'. Each lane starts
+ * FILL_SEGMENT values ahead of the previous lane.
+ *
+ * The state must be less than MWC64_MODULO, which is true for any state that
+ * has been sanitized, and stays true as the generator runs.
+ */
+static void mwc64_segment_starts(uint32_t * p_upper, uint32_t * p_lower, uint64_t mwc64)
+{
+    size_t      j;
+
+    p_upper[0] = (uint32_t)(mwc64 >> 32u);
+    p_lower[0] = (uint32_t)mwc64;
+    for (j = 1; j < FILL_LANES; j++)
+    {
+        mwc64 = mwc64_mul_mod(MWC64_SEGMENT_MULT, mwc64);
+        p_upper[j] = (uint32_t)(mwc64 >> 32u);
+        p_lower[j] = (uint32_t)mwc64;
+    }
+}
+
+/* Generate FILL_CHUNK values into 'p_out', and update the generator state.
+ * As for shr3_fill_chunk(), but the MWC64 lanes are jumped ahead by
+ * modular multiplication.
+ */
+static void mwc64_fill_chunk(SimpleRandomMWC64_t * p_mwc, uint32_t * restrict p_out)
+{
+    uint32_t    mwc_upper[FILL_LANES];
+    uint32_t    mwc_lower[FILL_LANES];
+    uint64_t    mwc64;
+    size_t      i;
+    size_t      j;
+
+    mwc64 = ((uint64_t)p_mwc->mwc_upper << 32u) + p_mwc->mwc_lower;
+    mwc64_segment_starts(mwc_upper, mwc_lower, mwc64);
+    for (i = 0; i < FILL_SEGMENT; i++)
+    {
+        for (j = 0; j < FILL_LANES; j++)
+        {
+            mwc64 = MWC64_MULT * mwc_lower[j] + mwc_upper[j];
+            mwc_upper[j] = (uint32_t)(mwc64 >> 32u);
+            mwc_lower[j] = (uint32_t)mwc64;
+            p_out[j * FILL_SEGMENT + i] = (uint32_t)mwc64;
+        }
+    }
+    p_mwc->mwc_upper = mwc_upper[FILL_LANES - 1u];
+    p_mwc->mwc_lower = mwc_lower[FILL_LANES - 1u];
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc64_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. Longer fills are done in
+ * chunks of FILL_CHUNK values, by mwc64_fill_chunk().
+ */
+void simplerandom_mwc64_fill(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC64_t    mwc = *p_mwc;
+    size_t                 i;
+
+    for ( ; num_out >= FILL_CHUNK; num_out -= FILL_CHUNK)
+    {
+        mwc64_fill_chunk(&mwc, p_out);
+        p_out += FILL_CHUNK;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = mwc64_next(&mwc);
+    }
+    *p_mwc = mwc;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_mwc', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1]. This gives the same
+ * values as calling simplerandom_mwc64_fill() for each generator, but
+ * FILL_MULTI_WAYS generators are stepped together, to hide the latency of
+ * each step.
+ * Long fills are already faster with simplerandom_mwc64_fill(), so those are
+ * done one generator at a time.
+ */
+void simplerandom_mwc64_fill_multi(SimpleRandomMWC64_t * p_mwc, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC64_t    state0;
+    SimpleRandomMWC64_t    state1;
+    SimpleRandomMWC64_t    state2;
+    SimpleRandomMWC64_t    state3;
+    uint32_t             * p_out0;
+    uint32_t             * p_out1;
+    uint32_t             * p_out2;
+    uint32_t             * p_out3;
+    size_t                 i;
+    size_t                 k = 0;
+
+    if (num_out < FILL_CHUNK)
+    {
+        for ( ; k + FILL_MULTI_WAYS <= num_states; k += FILL_MULTI_WAYS)
+        {
+            state0 = p_mwc[k];
+            state1 = p_mwc[k + 1u];
+            state2 = p_mwc[k + 2u];
+            state3 = p_mwc[k + 3u];
+            p_out0 = p_out + k * num_out;
+            p_out1 = p_out0 + num_out;
+            p_out2 = p_out1 + num_out;
+            p_out3 = p_out2 + num_out;
+            for (i = 0; i < num_out; i++)
+            {
+                p_out0[i] = mwc64_next(&state0);
+                p_out1[i] = mwc64_next(&state1);
+                p_out2[i] = mwc64_next(&state2);
+                p_out3[i] = mwc64_next(&state3);
+            }
+            p_mwc[k] = state0;
+            p_mwc[k + 1u] = state1;
+            p_mwc[k + 2u] = state2;
+            p_mwc[k + 3u] = state3;
+        }
+    }
+    for ( ; k < num_states; k++)
+    {
+        simplerandom_mwc64_fill(&p_mwc[k], p_out + k * num_out, num_out);
+    }
+}
+
+/* Two values of simplerandom_mwc64_next(), as one 64-bit value. See value64(). */
+static inline uint64_t mwc64_next64(SimpleRandomMWC64_t * p_mwc)
+{
+    uint32_t    first;
+
+    first = mwc64_next(p_mwc);
+    return value64(first, mwc64_next(p_mwc));
+}
+
+uint64_t simplerandom_mwc64_next64(SimpleRandomMWC64_t * p_mwc)
+{
+    return mwc64_next64(p_mwc);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_mwc64_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_mwc64_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_mwc64_fill64(SimpleRandomMWC64_t * p_mwc, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC64_t    mwc64 = *p_mwc;
+    uint32_t               buf[FILL_CHUNK];
+    size_t                 i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_mwc64_fill(&mwc64, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = mwc64_next64(&mwc64);
+    }
+    *p_mwc = mwc64;
+}
+
 void simplerandom_mwc64_mix(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data, size_t num_data)
 {
     uint32_t    current;
@@ -744,7 +1950,7 @@ size_t simplerandom_kiss2_num_seeds(const SimpleRandomKISS2_t * p_kiss2)
 {
     (void)p_kiss2;  /* We only use this parameter for type checking. */
 
-    return 4u;
+    return SIMPLERANDOM_KISS2_NUM_SEEDS;
 }
 
 size_t simplerandom_kiss2_seed_array(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -829,6 +2035,40 @@ void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2)
     kiss2_sanitize_shr3(p_kiss2);
 }
 
+/* Seed the 'count' generators in the array 'p_kiss2'. 'p_seeds' holds four seed values for
+ * each generator, in the order of the arguments of simplerandom_kiss2_seed(). This gives
+ * the same states as calling simplerandom_kiss2_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_kiss2_seed_batch(SimpleRandomKISS2_t * restrict p_kiss2, const uint32_t * restrict p_seeds, size_t count)
+{
+    uint64_t    temp64;
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            temp64 = mwc64_sanitized(((uint64_t)p_seeds[4u * n] << 32u) + p_seeds[4u * n + 1u]);
+            p_kiss2[n].mwc_upper = (uint32_t)(temp64 >> 32u);
+            p_kiss2[n].mwc_lower = (uint32_t)temp64;
+            p_kiss2[n].cong = p_seeds[4u * n + 2u];
+            p_kiss2[n].shr3 = shr3_sanitized(p_seeds[4u * n + 3u]);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        temp64 = mwc64_sanitized(((uint64_t)p_seeds[4u * n] << 32u) + p_seeds[4u * n + 1u]);
+        p_kiss2[n].mwc_upper = (uint32_t)(temp64 >> 32u);
+        p_kiss2[n].mwc_lower = (uint32_t)temp64;
+        p_kiss2[n].cong = p_seeds[4u * n + 2u];
+        p_kiss2[n].shr3 = shr3_sanitized(p_seeds[4u * n + 3u]);
+    }
+}
+
 static inline void kiss2_next_mwc64(SimpleRandomKISS2_t * p_kiss2)
 {
     uint64_t    mwc64;
@@ -854,7 +2094,7 @@ static inline void kiss2_next_shr3(SimpleRandomKISS2_t * p_kiss2)
     p_kiss2->shr3 = shr3;
 }
 
-uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2)
+static inline uint32_t kiss2_next(SimpleRandomKISS2_t * p_kiss2)
 {
     kiss2_next_mwc64(p_kiss2);
     kiss2_next_cong(p_kiss2);
@@ -862,27 +2102,159 @@ uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2)
     return kiss2_current(p_kiss2);
 }
 
-void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data)
+uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2)
 {
-    uint32_t    current;
+    return kiss2_next(p_kiss2);
+}
 
-    if (p_data != NULL)
+/* Generate FILL_CHUNK values into 'p_out', and update the generator state.
+ * Each of the 3 component generators is jumped ahead to the start of each
+ * segment, as in mwc64_fill_chunk() and shr3_fill_chunk(). The Cong jump is
+ * an affine step, as in cong_fill_leapfrog().
+ */
+static void kiss2_fill_chunk(SimpleRandomKISS2_t * p_kiss2, uint32_t * restrict p_out)
+{
+    uint32_t    mwc_upper[FILL_LANES];
+    uint32_t    mwc_lower[FILL_LANES];
+    uint32_t    cong[FILL_LANES];
+    uint32_t    shr3[FILL_LANES];
+    uint64_t    mwc64;
+    uint32_t    x;
+    size_t      i;
+    size_t      j;
+
+    mwc64 = ((uint64_t)p_kiss2->mwc_upper << 32u) + p_kiss2->mwc_lower;
+    mwc64_segment_starts(mwc_upper, mwc_lower, mwc64);
+    cong[0] = p_kiss2->cong;
+    shr3[0] = p_kiss2->shr3;
+    for (j = 1; j < FILL_LANES; j++)
     {
-        while (num_data)
+        cong[j] = CONG_SEGMENT_MULT * cong[j - 1u] + CONG_SEGMENT_CONST;
+        shr3[j] = bitcolumnmatrix32_mul_uint32(&shr3_segment_matrix, shr3[j - 1u]);
+    }
+    for (i = 0; i < FILL_SEGMENT; i++)
+    {
+        for (j = 0; j < FILL_LANES; j++)
         {
-            --num_data;
-            current = kiss2_current(p_kiss2);
-            switch ((current >> 24u) & 0x3u)    /* Switch on 2 high bits */
-            {
-                case 0:
-                    p_kiss2->mwc_upper ^= *p_data;
-                    kiss2_sanitize_mwc64(p_kiss2);
-                    kiss2_next_mwc64(p_kiss2);
-                    break;
-                case 1:
-                    p_kiss2->mwc_lower ^= *p_data;
-                    kiss2_sanitize_mwc64(p_kiss2);
-                    kiss2_next_mwc64(p_kiss2);
+            mwc64 = MWC64_MULT * mwc_lower[j] + mwc_upper[j];
+            mwc_upper[j] = (uint32_t)(mwc64 >> 32u);
+            mwc_lower[j] = (uint32_t)mwc64;
+
+            cong[j] = UINT32_C(69069) * cong[j] + 12345u;
+
+            x = shr3[j];
+            x ^= (x << 13);
+            x ^= (x >> 17);
+            x ^= (x << 5);
+            shr3[j] = x;
+
+            p_out[j * FILL_SEGMENT + i] = mwc_lower[j] + cong[j] + shr3[j];
+        }
+    }
+    p_kiss2->mwc_upper = mwc_upper[FILL_LANES - 1u];
+    p_kiss2->mwc_lower = mwc_lower[FILL_LANES - 1u];
+    p_kiss2->cong = cong[FILL_LANES - 1u];
+    p_kiss2->shr3 = shr3[FILL_LANES - 1u];
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_kiss2_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. Longer fills are done in
+ * chunks of FILL_CHUNK values, by kiss2_fill_chunk().
+ */
+void simplerandom_kiss2_fill(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS2_t    kiss2 = *p_kiss2;
+    size_t                 i;
+
+    for ( ; num_out >= FILL_CHUNK; num_out -= FILL_CHUNK)
+    {
+        kiss2_fill_chunk(&kiss2, p_out);
+        p_out += FILL_CHUNK;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = kiss2_next(&kiss2);
+    }
+    *p_kiss2 = kiss2;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_kiss2', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1].
+ *
+ * KISS2 combines 3 independent generators, whose steps already run in
+ * parallel, so there is nothing to gain by stepping several generators
+ * together. This just calls simplerandom_kiss2_fill() for each generator.
+ */
+void simplerandom_kiss2_fill_multi(SimpleRandomKISS2_t * p_kiss2, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    size_t      k;
+
+    for (k = 0; k < num_states; k++)
+    {
+        simplerandom_kiss2_fill(&p_kiss2[k], p_out + k * num_out, num_out);
+    }
+}
+
+/* Two values of simplerandom_kiss2_next(), as one 64-bit value. See value64(). */
+static inline uint64_t kiss2_next64(SimpleRandomKISS2_t * p_kiss2)
+{
+    uint32_t    first;
+
+    first = kiss2_next(p_kiss2);
+    return value64(first, kiss2_next(p_kiss2));
+}
+
+uint64_t simplerandom_kiss2_next64(SimpleRandomKISS2_t * p_kiss2)
+{
+    return kiss2_next64(p_kiss2);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_kiss2_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_kiss2_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_kiss2_fill64(SimpleRandomKISS2_t * p_kiss2, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS2_t    kiss2 = *p_kiss2;
+    uint32_t               buf[FILL_CHUNK];
+    size_t                 i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_kiss2_fill(&kiss2, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = kiss2_next64(&kiss2);
+    }
+    *p_kiss2 = kiss2;
+}
+
+void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data)
+{
+    uint32_t    current;
+
+    if (p_data != NULL)
+    {
+        while (num_data)
+        {
+            --num_data;
+            current = kiss2_current(p_kiss2);
+            switch ((current >> 24u) & 0x3u)    /* Switch on 2 high bits */
+            {
+                case 0:
+                    p_kiss2->mwc_upper ^= *p_data;
+                    kiss2_sanitize_mwc64(p_kiss2);
+                    kiss2_next_mwc64(p_kiss2);
+                    break;
+                case 1:
+                    p_kiss2->mwc_lower ^= *p_data;
+                    kiss2_sanitize_mwc64(p_kiss2);
+                    kiss2_next_mwc64(p_kiss2);
                     break;
                 case 2:
                     p_kiss2->cong ^= *p_data;
@@ -900,6 +2272,431 @@ void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_da
     }
 }
 
+/*********
+ * KISS64
+ ********/
+
+size_t simplerandom_kiss64_num_seeds(const SimpleRandomKISS64_t * p_kiss64)
+{
+    (void)p_kiss64; /* We only use this parameter for type checking. */
+
+    return SIMPLERANDOM_KISS64_NUM_SEEDS;
+}
+
+size_t simplerandom_kiss64_seed_array(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
+{
+    uint32_t    seeds[8u] = { 0 };
+    size_t      num_seeds_used = 0;
+    size_t      i;
+
+    if (p_seeds != NULL)
+    {
+        if (num_seeds > 8u)
+            num_seeds_used = 8u;
+        else
+            num_seeds_used = num_seeds;
+        for (i = 0; i < 8u; i++)
+        {
+            if (i < num_seeds)
+                seeds[i] = p_seeds[i];
+            else if (i > 0)
+                seeds[i] = seeds[i - 1u];
+        }
+    }
+    simplerandom_kiss64_seed(p_kiss64,
+                             value64(seeds[0], seeds[1]), value64(seeds[2], seeds[3]),
+                             value64(seeds[4], seeds[5]), value64(seeds[6], seeds[7]));
+
+    if (mix_extras && p_seeds != NULL)
+    {
+        simplerandom_kiss64_mix(p_kiss64, p_seeds + num_seeds_used, num_seeds - num_seeds_used);
+        num_seeds_used = num_seeds;
+    }
+    return num_seeds_used;
+}
+
+void simplerandom_kiss64_seed(SimpleRandomKISS64_t * p_kiss64, uint64_t seed_mwc_upper, uint64_t seed_mwc_lower, uint64_t seed_cong, uint64_t seed_shr3)
+{
+    p_kiss64->mwc_upper = seed_mwc_upper;
+    p_kiss64->mwc_lower = seed_mwc_lower;
+    p_kiss64->cong = seed_cong;
+    p_kiss64->shr3 = seed_shr3;
+    simplerandom_kiss64_sanitize(p_kiss64);
+}
+
+/* Reduce the 128-bit MWC state upper:lower modulo KISS64_MWC_MULT * 2^64 - 1.
+ *
+ * KISS64_MWC_MULT * 2^64 is 1 modulo the modulus. So if upper is
+ * q * KISS64_MWC_MULT + r, then upper:lower is the same as r:lower + q.
+ */
+static inline void kiss64_mwc_reduce(uint64_t * p_upper, uint64_t * p_lower)
+{
+    uint64_t    upper = *p_upper;
+    uint64_t    lower = *p_lower;
+    uint64_t    q;
+
+    if (upper >= KISS64_MWC_MULT)
+    {
+        q = upper / KISS64_MWC_MULT;
+        upper %= KISS64_MWC_MULT;
+        lower += q;
+        if (lower < q)
+            upper++;
+    }
+    if (upper == KISS64_MWC_MULT)
+    {
+        /* Carry from the add above, so 'lower' is small. */
+        upper = 0;
+        lower++;
+    }
+    else if (upper == KISS64_MWC_MULT - 1u && lower == UINT64_C(0xFFFFFFFFFFFFFFFF))
+    {
+        /* Equal to the modulus. */
+        upper = 0;
+        lower = 0;
+    }
+    *p_upper = upper;
+    *p_lower = lower;
+}
+
+/* As for MWC64, any multiple of the modulus, including 0, is a bad state. */
+static inline void kiss64_sanitize_mwc(SimpleRandomKISS64_t * p_kiss64)
+{
+    uint64_t    upper = p_kiss64->mwc_upper;
+    uint64_t    lower = p_kiss64->mwc_lower;
+
+    kiss64_mwc_reduce(&upper, &lower);
+    if (upper == 0 && lower == 0)
+    {
+        /* Invert both upper and lower to get a good seed. */
+        upper = p_kiss64->mwc_upper ^ UINT64_C(0xFFFFFFFFFFFFFFFF);
+        lower = p_kiss64->mwc_lower ^ UINT64_C(0xFFFFFFFFFFFFFFFF);
+        kiss64_mwc_reduce(&upper, &lower);
+    }
+    p_kiss64->mwc_upper = upper;
+    p_kiss64->mwc_lower = lower;
+}
+
+static inline void kiss64_sanitize_shr3(SimpleRandomKISS64_t * p_kiss64)
+{
+    /* Zero is a bad state value for SHR3. */
+    if (p_kiss64->shr3 == 0)
+    {
+        p_kiss64->shr3 = UINT64_C(0xFFFFFFFFFFFFFFFF);
+    }
+}
+
+void simplerandom_kiss64_sanitize(SimpleRandomKISS64_t * p_kiss64)
+{
+    kiss64_sanitize_mwc(p_kiss64);
+    /* No sanitize needed for Cong, because all state values are valid. */
+    kiss64_sanitize_shr3(p_kiss64);
+}
+
+/* Seed the 'count' generators in the array 'p_kiss64'. 'p_seeds' holds eight seed values for
+ * each generator, as for simplerandom_kiss64_seed_array(). The MWC sanitize isn't simple
+ * enough to vectorize, so this just seeds each generator in turn.
+ */
+void simplerandom_kiss64_seed_batch(SimpleRandomKISS64_t * restrict p_kiss64, const uint32_t * restrict p_seeds, size_t count)
+{
+    const uint32_t    * p;
+    size_t              n;
+
+    for (n = 0; n < count; n++)
+    {
+        p = &p_seeds[8u * n];
+        simplerandom_kiss64_seed(&p_kiss64[n],
+                                 value64(p[0], p[1]), value64(p[2], p[3]),
+                                 value64(p[4], p[5]), value64(p[6], p[7]));
+    }
+}
+
+/* KISS64_MWC_MULT * mwc_lower + mwc_upper, as in Marsaglia's code, with shift
+ * and add. His code doesn't carry out of (x << 58) + c. That can only happen
+ * when mwc_upper is KISS64_MWC_MULT - 1, and the carry is kept here so that
+ * the step is always the same as the multiply in simplerandom_kiss64_discard().
+ */
+static inline void kiss64_next_mwc(SimpleRandomKISS64_t * p_kiss64)
+{
+    uint64_t    mwc_lower;
+    uint64_t    mwc_upper;
+    uint64_t    temp;
+
+    mwc_lower = p_kiss64->mwc_lower;
+    temp = (mwc_lower << 58u) + p_kiss64->mwc_upper;
+    mwc_upper = (mwc_lower >> 6u) + (temp < p_kiss64->mwc_upper);
+    mwc_lower += temp;
+    mwc_upper += (mwc_lower < temp);
+    p_kiss64->mwc_upper = mwc_upper;
+    p_kiss64->mwc_lower = mwc_lower;
+}
+
+static inline void kiss64_next_cong(SimpleRandomKISS64_t * p_kiss64)
+{
+    p_kiss64->cong = KISS64_CONG_MULT * p_kiss64->cong + KISS64_CONG_CONST;
+}
+
+static inline void kiss64_next_shr3(SimpleRandomKISS64_t * p_kiss64)
+{
+    uint64_t    shr3;
+
+    shr3 = p_kiss64->shr3;
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 43);
+    p_kiss64->shr3 = shr3;
+}
+
+static inline uint64_t kiss64_next(SimpleRandomKISS64_t * p_kiss64)
+{
+    kiss64_next_mwc(p_kiss64);
+    kiss64_next_shr3(p_kiss64);
+    kiss64_next_cong(p_kiss64);
+    return kiss64_current(p_kiss64);
+}
+
+uint64_t simplerandom_kiss64_next(SimpleRandomKISS64_t * p_kiss64)
+{
+    return kiss64_next(p_kiss64);
+}
+
+void simplerandom_kiss64_fill(SimpleRandomKISS64_t * p_kiss64, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS64_t    kiss64 = *p_kiss64;
+    size_t                  i;
+
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = kiss64_next(&kiss64);
+    }
+    *p_kiss64 = kiss64;
+}
+
+/* Each data word is mixed into one 32-bit half of one of the 64-bit state
+ * values, chosen by the 3 high bits of the current output.
+ */
+void simplerandom_kiss64_mix(SimpleRandomKISS64_t * p_kiss64, const uint32_t * p_data, size_t num_data)
+{
+    uint64_t    current;
+
+    if (p_data != NULL)
+    {
+        while (num_data)
+        {
+            --num_data;
+            current = kiss64_current(p_kiss64);
+            switch ((current >> 61u) & 0x7u)    /* Switch on 3 high bits */
+            {
+                case 0:
+                    p_kiss64->mwc_upper ^= *p_data;
+                    kiss64_sanitize_mwc(p_kiss64);
+                    kiss64_next_mwc(p_kiss64);
+                    break;
+                case 1:
+                    p_kiss64->mwc_upper ^= (uint64_t)*p_data << 32u;
+                    kiss64_sanitize_mwc(p_kiss64);
+                    kiss64_next_mwc(p_kiss64);
+                    break;
+                case 2:
+                    p_kiss64->mwc_lower ^= *p_data;
+                    kiss64_sanitize_mwc(p_kiss64);
+                    kiss64_next_mwc(p_kiss64);
+                    break;
+                case 3:
+                    p_kiss64->mwc_lower ^= (uint64_t)*p_data << 32u;
+                    kiss64_sanitize_mwc(p_kiss64);
+                    kiss64_next_mwc(p_kiss64);
+                    break;
+                case 4:
+                    p_kiss64->cong ^= *p_data;
+                    /* Cong doesn't need sanitise; all states are valid. */
+                    kiss64_next_cong(p_kiss64);
+                    break;
+                case 5:
+                    p_kiss64->cong ^= (uint64_t)*p_data << 32u;
+                    kiss64_next_cong(p_kiss64);
+                    break;
+                case 6:
+                    p_kiss64->shr3 ^= *p_data;
+                    kiss64_sanitize_shr3(p_kiss64);
+                    kiss64_next_shr3(p_kiss64);
+                    break;
+                case 7:
+                    p_kiss64->shr3 ^= (uint64_t)*p_data << 32u;
+                    kiss64_sanitize_shr3(p_kiss64);
+                    kiss64_next_shr3(p_kiss64);
+                    break;
+            }
+            ++p_data;
+        }
+    }
+}
+
+/*********
+ * CMWC4096
+ ********/
+
+size_t simplerandom_cmwc4096_num_seeds(const SimpleRandomCMWC4096_t * p_cmwc)
+{
+    (void)p_cmwc;       /* We only use this parameter for type checking. */
+
+    return SIMPLERANDOM_CMWC4096_NUM_SEEDS;
+}
+
+size_t simplerandom_cmwc4096_seed_array(SimpleRandomCMWC4096_t * p_cmwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
+{
+    uint32_t    seed_mwc_upper = 0;
+    uint32_t    seed_mwc_lower = 0;
+    uint32_t    seed_cong = 0;
+    uint32_t    seed_shr3 = 0;
+    size_t      num_seeds_used = 0;
+
+    if (p_seeds != NULL)
+    {
+        if (num_seeds > 4u)
+            num_seeds_used = 4u;
+        else
+            num_seeds_used = num_seeds;
+        seed_mwc_upper  = (num_seeds >= 1) ? p_seeds[0] : 0;
+        seed_mwc_lower  = (num_seeds >= 2) ? p_seeds[1] : seed_mwc_upper;
+        seed_cong       = (num_seeds >= 3) ? p_seeds[2] : seed_mwc_lower;
+        seed_shr3       = (num_seeds >= 4) ? p_seeds[3] : seed_cong;
+    }
+    simplerandom_cmwc4096_seed(p_cmwc, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+
+    if (mix_extras && p_seeds != NULL)
+    {
+        simplerandom_cmwc4096_mix(p_cmwc, p_seeds + num_seeds_used, num_seeds - num_seeds_used);
+        num_seeds_used = num_seeds;
+    }
+    return num_seeds_used;
+}
+
+/* The table is filled with KISS values, as suggested by Marsaglia. The carry
+ * is a KISS value scaled down to the valid range, as in
+ * simplerandom_cmwc4096_sanitize(). The first step uses q[0].
+ */
+void simplerandom_cmwc4096_seed(SimpleRandomCMWC4096_t * p_cmwc, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3)
+{
+    SimpleRandomKISS_t  kiss;
+    size_t              i;
+
+    simplerandom_kiss_seed(&kiss, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+    for (i = 0; i < SIMPLERANDOM_CMWC4096_LAG; i++)
+    {
+        p_cmwc->q[i] = kiss_next(&kiss);
+    }
+    p_cmwc->c = kiss_next(&kiss);
+    p_cmwc->index = SIMPLERANDOM_CMWC4096_LAG - 1u;
+    simplerandom_cmwc4096_sanitize(p_cmwc);
+}
+
+/* The carry is at most CMWC4096_MULT. If it is larger, scale it down into
+ * that range with a multiply and shift.
+ *
+ * The only bad states are the two that correspond to a constant sequence,
+ * which are very unlikely to come from seeding or mixing. So the table
+ * isn't checked.
+ */
+void simplerandom_cmwc4096_sanitize(SimpleRandomCMWC4096_t * p_cmwc)
+{
+    p_cmwc->index &= CMWC4096_MASK;
+    if (p_cmwc->c > CMWC4096_MULT)
+    {
+        p_cmwc->c = (uint32_t)(((CMWC4096_MULT + 1u) * p_cmwc->c) >> 32u);
+    }
+}
+
+/* One step of CMWC4096, from the value 4096 steps before, 'q', and the carry.
+ * Dividing t by b is done as division by 2^32, plus a correction.
+ */
+static inline uint32_t cmwc4096_step(uint32_t q, uint32_t * p_c)
+{
+    uint64_t    t;
+    uint32_t    c;
+    uint32_t    x;
+
+    t = CMWC4096_MULT * q + *p_c;
+    c = (uint32_t)(t >> 32u);
+    x = (uint32_t)t + c;
+    if (x < c)
+    {
+        x++;
+        c++;
+    }
+    *p_c = c;
+    return CMWC4096_R - x;
+}
+
+static inline uint32_t cmwc4096_next(SimpleRandomCMWC4096_t * p_cmwc)
+{
+    uint32_t    i;
+
+    i = (p_cmwc->index + 1u) & CMWC4096_MASK;
+    p_cmwc->q[i] = cmwc4096_step(p_cmwc->q[i], &p_cmwc->c);
+    p_cmwc->index = i;
+    return p_cmwc->q[i];
+}
+
+uint32_t simplerandom_cmwc4096_next(SimpleRandomCMWC4096_t * p_cmwc)
+{
+    return cmwc4096_next(p_cmwc);
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_cmwc4096_next() 'num_out' times.
+ *
+ * Each step replaces the table value that it reads, so the values are
+ * calculated along runs of the table up to its end, without the index
+ * arithmetic of cmwc4096_next(), and with the carry in a local variable. The
+ * carry is the only serial dependency between steps. The multiplies don't
+ * depend on it, so the CPU can run them ahead.
+ */
+void simplerandom_cmwc4096_fill(SimpleRandomCMWC4096_t * p_cmwc, uint32_t * p_out, size_t num_out)
+{
+    uint32_t  * p_q;
+    uint32_t    c = p_cmwc->c;
+    uint32_t    i = p_cmwc->index;
+    size_t      run;
+    size_t      j;
+
+    while (num_out)
+    {
+        i = (i + 1u) & CMWC4096_MASK;
+        run = SIMPLERANDOM_CMWC4096_LAG - i;
+        if (run > num_out)
+            run = num_out;
+        p_q = &p_cmwc->q[i];
+        for (j = 0; j < run; j++)
+        {
+            p_q[j] = cmwc4096_step(p_q[j], &c);
+            p_out[j] = p_q[j];
+        }
+        i += (uint32_t)run - 1u;
+        p_out += run;
+        num_out -= run;
+    }
+    p_cmwc->c = c;
+    p_cmwc->index = i;
+}
+
+/* Each data word is XORed into the table value that is used by the next
+ * step. Any table value is valid, so there is nothing to sanitize.
+ */
+void simplerandom_cmwc4096_mix(SimpleRandomCMWC4096_t * p_cmwc, const uint32_t * p_data, size_t num_data)
+{
+    if (p_data != NULL)
+    {
+        while (num_data)
+        {
+            --num_data;
+            p_cmwc->q[(p_cmwc->index + 1u) & CMWC4096_MASK] ^= *p_data;
+            cmwc4096_next(p_cmwc);
+            ++p_data;
+        }
+    }
+}
+
 #endif /* defined(UINT64_C) */
 
 
@@ -921,7 +2718,7 @@ size_t simplerandom_lfsr113_num_seeds(const SimpleRandomLFSR113_t * p_lfsr113)
 {
     (void)p_lfsr113;    /* We only use this parameter for type checking. */
 
-    return 4u;
+    return SIMPLERANDOM_LFSR113_NUM_SEEDS;
 }
 
 size_t simplerandom_lfsr113_seed_array(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -1013,6 +2810,54 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
     p_lfsr113->z4 = working_seed;
 }
 
+/* Branchless equivalent of the seeding of one LFSR component in
+ * simplerandom_lfsr113_seed(), for seeding arrays of generators. Both the
+ * normal and alternative seed values are calculated, and the conditional
+ * expressions become SIMD compare and select operations when the compiler
+ * vectorizes the loop.
+ */
+static inline uint32_t lfsr_seeded(uint32_t seed, uint32_t min_value)
+{
+    uint32_t    working_seed;
+    uint32_t    working_seed_alt;
+
+    working_seed = LFSR_SEED(seed);
+    working_seed_alt = LFSR_ALT_SEED(seed);
+    working_seed_alt = (working_seed_alt < min_value) ? ~working_seed_alt : working_seed_alt;
+    return (working_seed < min_value) ? working_seed_alt : working_seed;
+}
+
+/* Seed the 'count' generators in the array 'p_lfsr113'. 'p_seeds' holds four seed values for
+ * each generator, in the order of the arguments of simplerandom_lfsr113_seed(). This gives
+ * the same states as calling simplerandom_lfsr113_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_lfsr113_seed_batch(SimpleRandomLFSR113_t * restrict p_lfsr113, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_lfsr113[n].z1 = lfsr_seeded(p_seeds[4u * n], LFSR_SEED_Z1_MIN_VALUE);
+            p_lfsr113[n].z2 = lfsr_seeded(p_seeds[4u * n + 1u], LFSR_SEED_Z2_MIN_VALUE);
+            p_lfsr113[n].z3 = lfsr_seeded(p_seeds[4u * n + 2u], LFSR_SEED_Z3_MIN_VALUE);
+            p_lfsr113[n].z4 = lfsr_seeded(p_seeds[4u * n + 3u], LFSR_SEED_Z4_MIN_VALUE);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_lfsr113[n].z1 = lfsr_seeded(p_seeds[4u * n], LFSR_SEED_Z1_MIN_VALUE);
+        p_lfsr113[n].z2 = lfsr_seeded(p_seeds[4u * n + 1u], LFSR_SEED_Z2_MIN_VALUE);
+        p_lfsr113[n].z3 = lfsr_seeded(p_seeds[4u * n + 2u], LFSR_SEED_Z3_MIN_VALUE);
+        p_lfsr113[n].z4 = lfsr_seeded(p_seeds[4u * n + 3u], LFSR_SEED_Z4_MIN_VALUE);
+    }
+}
+
 /* For most simplerandom generators, sanitise functions are used for both
  * seeding and for sanitising the mix function results. But for LFSR generators
  * with a more complex seeding function, the sanitise functions are specified
@@ -1119,7 +2964,7 @@ static inline uint32_t lfsr113_current(SimpleRandomLFSR113_t * p_lfsr113)
     return (p_lfsr113->z1 ^ p_lfsr113->z2 ^ p_lfsr113->z3 ^ p_lfsr113->z4);
 }
 
-uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
+static inline uint32_t lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
 {
     lfsr113_next_z1(p_lfsr113);
     lfsr113_next_z2(p_lfsr113);
@@ -1128,6 +2973,139 @@ uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
     return lfsr113_current(p_lfsr113);
 }
 
+uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    return lfsr113_next(p_lfsr113);
+}
+
+/* Generate FILL_CHUNK values into 'p_out', and update the generator state.
+ * As for shr3_fill_chunk(), but each of the 4 LFSR components is jumped ahead
+ * by its own segment matrix. The components are kept in separate arrays, and
+ * the step calculations are the same as lfsr113_next_z1() etc.
+ */
+static void lfsr113_fill_chunk(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * restrict p_out)
+{
+    uint32_t    z1[FILL_LANES];
+    uint32_t    z2[FILL_LANES];
+    uint32_t    z3[FILL_LANES];
+    uint32_t    z4[FILL_LANES];
+    uint32_t    b;
+    size_t      i;
+    size_t      j;
+
+    z1[0] = p_lfsr113->z1;
+    z2[0] = p_lfsr113->z2;
+    z3[0] = p_lfsr113->z3;
+    z4[0] = p_lfsr113->z4;
+    for (j = 1; j < FILL_LANES; j++)
+    {
+        z1[j] = bitcolumnmatrix32_mul_uint32(&lfsr113_1_segment_matrix, z1[j - 1u]);
+        z2[j] = bitcolumnmatrix32_mul_uint32(&lfsr113_2_segment_matrix, z2[j - 1u]);
+        z3[j] = bitcolumnmatrix32_mul_uint32(&lfsr113_3_segment_matrix, z3[j - 1u]);
+        z4[j] = bitcolumnmatrix32_mul_uint32(&lfsr113_4_segment_matrix, z4[j - 1u]);
+    }
+    for (i = 0; i < FILL_SEGMENT; i++)
+    {
+        for (j = 0; j < FILL_LANES; j++)
+        {
+            b     = ((z1[j] << 6) ^ z1[j]) >> 13;
+            z1[j] = ((z1[j] & UINT32_C(0xFFFFFFFE)) << 18) ^ b;
+            b     = ((z2[j] << 2) ^ z2[j]) >> 27;
+            z2[j] = ((z2[j] & UINT32_C(0xFFFFFFF8)) << 2) ^ b;
+            b     = ((z3[j] << 13) ^ z3[j]) >> 21;
+            z3[j] = ((z3[j] & UINT32_C(0xFFFFFFF0)) << 7) ^ b;
+            b     = ((z4[j] << 3) ^ z4[j]) >> 12;
+            z4[j] = ((z4[j] & UINT32_C(0xFFFFFF80)) << 13) ^ b;
+            p_out[j * FILL_SEGMENT + i] = z1[j] ^ z2[j] ^ z3[j] ^ z4[j];
+        }
+    }
+    p_lfsr113->z1 = z1[FILL_LANES - 1u];
+    p_lfsr113->z2 = z2[FILL_LANES - 1u];
+    p_lfsr113->z3 = z3[FILL_LANES - 1u];
+    p_lfsr113->z4 = z4[FILL_LANES - 1u];
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_lfsr113_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. Longer fills are done in
+ * chunks of FILL_CHUNK values, by lfsr113_fill_chunk().
+ */
+void simplerandom_lfsr113_fill(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR113_t    lfsr113 = *p_lfsr113;
+    size_t                   i;
+
+    for ( ; num_out >= FILL_CHUNK; num_out -= FILL_CHUNK)
+    {
+        lfsr113_fill_chunk(&lfsr113, p_out);
+        p_out += FILL_CHUNK;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = lfsr113_next(&lfsr113);
+    }
+    *p_lfsr113 = lfsr113;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_lfsr113', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1].
+ *
+ * LFSR113 combines 4 independent LFSRs, whose steps already run in
+ * parallel, so there is nothing to gain by stepping several generators
+ * together. This just calls simplerandom_lfsr113_fill() for each generator.
+ */
+void simplerandom_lfsr113_fill_multi(SimpleRandomLFSR113_t * p_lfsr113, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    size_t      k;
+
+    for (k = 0; k < num_states; k++)
+    {
+        simplerandom_lfsr113_fill(&p_lfsr113[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_lfsr113_next(), as one 64-bit value. See value64(). */
+static inline uint64_t lfsr113_next64(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    first;
+
+    first = lfsr113_next(p_lfsr113);
+    return value64(first, lfsr113_next(p_lfsr113));
+}
+
+uint64_t simplerandom_lfsr113_next64(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    return lfsr113_next64(p_lfsr113);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_lfsr113_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_lfsr113_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_lfsr113_fill64(SimpleRandomLFSR113_t * p_lfsr113, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR113_t    lfsr113 = *p_lfsr113;
+    uint32_t                 buf[FILL_CHUNK];
+    size_t                   i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_lfsr113_fill(&lfsr113, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = lfsr113_next64(&lfsr113);
+    }
+    *p_lfsr113 = lfsr113;
+}
+
+#endif /* defined(UINT64_C) */
+
 void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_data, size_t num_data)
 {
     uint32_t    current;
@@ -1174,7 +3152,7 @@ size_t simplerandom_lfsr88_num_seeds(const SimpleRandomLFSR88_t * p_lfsr88)
 {
     (void)p_lfsr88; /* We only use this parameter for type checking. */
 
-    return 3u;
+    return SIMPLERANDOM_LFSR88_NUM_SEEDS;
 }
 
 size_t simplerandom_lfsr88_seed_array(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
@@ -1245,6 +3223,35 @@ void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1,
     p_lfsr88->z3 = working_seed;
 }
 
+/* Seed the 'count' generators in the array 'p_lfsr88'. 'p_seeds' holds three seed values for
+ * each generator, in the order of the arguments of simplerandom_lfsr88_seed(). This gives
+ * the same states as calling simplerandom_lfsr88_seed() for each generator, but the loop
+ * is branchless so that the compiler can vectorize it.
+ */
+void simplerandom_lfsr88_seed_batch(SimpleRandomLFSR88_t * restrict p_lfsr88, const uint32_t * restrict p_seeds, size_t count)
+{
+    size_t      i;
+    size_t      j;
+    size_t      n;
+
+    for (i = 0; i + SEED_BATCH_BLOCK <= count; i += SEED_BATCH_BLOCK)
+    {
+        for (j = 0; j < SEED_BATCH_BLOCK; j++)
+        {
+            n = i + j;
+            p_lfsr88[n].z1 = lfsr_seeded(p_seeds[3u * n], LFSR_SEED_Z1_MIN_VALUE);
+            p_lfsr88[n].z2 = lfsr_seeded(p_seeds[3u * n + 1u], LFSR_SEED_Z2_MIN_VALUE);
+            p_lfsr88[n].z3 = lfsr_seeded(p_seeds[3u * n + 2u], LFSR_SEED_Z3_MIN_VALUE);
+        }
+    }
+    for (n = i; n < count; n++)
+    {
+        p_lfsr88[n].z1 = lfsr_seeded(p_seeds[3u * n], LFSR_SEED_Z1_MIN_VALUE);
+        p_lfsr88[n].z2 = lfsr_seeded(p_seeds[3u * n + 1u], LFSR_SEED_Z2_MIN_VALUE);
+        p_lfsr88[n].z3 = lfsr_seeded(p_seeds[3u * n + 2u], LFSR_SEED_Z3_MIN_VALUE);
+    }
+}
+
 static inline void lfsr88_sanitize_z1(SimpleRandomLFSR88_t * p_lfsr88)
 {
     uint32_t    working_seed;
@@ -1323,7 +3330,7 @@ static inline uint32_t lfsr88_current(SimpleRandomLFSR88_t * p_lfsr88)
     return (p_lfsr88->z1 ^ p_lfsr88->z2 ^ p_lfsr88->z3);
 }
 
-uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
+static inline uint32_t lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
 {
     lfsr88_next_z1(p_lfsr88);
     lfsr88_next_z2(p_lfsr88);
@@ -1331,6 +3338,131 @@ uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
     return lfsr88_current(p_lfsr88);
 }
 
+uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    return lfsr88_next(p_lfsr88);
+}
+
+/* Generate FILL_CHUNK values into 'p_out', and update the generator state.
+ * As for lfsr113_fill_chunk(), with the 3 LFSR components of LFSR88.
+ */
+static void lfsr88_fill_chunk(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * restrict p_out)
+{
+    uint32_t    z1[FILL_LANES];
+    uint32_t    z2[FILL_LANES];
+    uint32_t    z3[FILL_LANES];
+    uint32_t    b;
+    size_t      i;
+    size_t      j;
+
+    z1[0] = p_lfsr88->z1;
+    z2[0] = p_lfsr88->z2;
+    z3[0] = p_lfsr88->z3;
+    for (j = 1; j < FILL_LANES; j++)
+    {
+        z1[j] = bitcolumnmatrix32_mul_uint32(&lfsr88_1_segment_matrix, z1[j - 1u]);
+        z2[j] = bitcolumnmatrix32_mul_uint32(&lfsr88_2_segment_matrix, z2[j - 1u]);
+        z3[j] = bitcolumnmatrix32_mul_uint32(&lfsr88_3_segment_matrix, z3[j - 1u]);
+    }
+    for (i = 0; i < FILL_SEGMENT; i++)
+    {
+        for (j = 0; j < FILL_LANES; j++)
+        {
+            b     = ((z1[j] << 13) ^ z1[j]) >> 19;
+            z1[j] = ((z1[j] & UINT32_C(0xFFFFFFFE)) << 12) ^ b;
+            b     = ((z2[j] << 2) ^ z2[j]) >> 25;
+            z2[j] = ((z2[j] & UINT32_C(0xFFFFFFF8)) << 4) ^ b;
+            b     = ((z3[j] << 3) ^ z3[j]) >> 11;
+            z3[j] = ((z3[j] & UINT32_C(0xFFFFFFF0)) << 17) ^ b;
+            p_out[j * FILL_SEGMENT + i] = z1[j] ^ z2[j] ^ z3[j];
+        }
+    }
+    p_lfsr88->z1 = z1[FILL_LANES - 1u];
+    p_lfsr88->z2 = z2[FILL_LANES - 1u];
+    p_lfsr88->z3 = z3[FILL_LANES - 1u];
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_lfsr88_next() 'num_out' times, but is faster because the
+ * state is kept in local variables during the loop. Longer fills are done in
+ * chunks of FILL_CHUNK values, by lfsr88_fill_chunk().
+ */
+void simplerandom_lfsr88_fill(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR88_t    lfsr88 = *p_lfsr88;
+    size_t                  i;
+
+    for ( ; num_out >= FILL_CHUNK; num_out -= FILL_CHUNK)
+    {
+        lfsr88_fill_chunk(&lfsr88, p_out);
+        p_out += FILL_CHUNK;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = lfsr88_next(&lfsr88);
+    }
+    *p_lfsr88 = lfsr88;
+}
+
+/* Generate 'num_out' values from each of the 'num_states' generators in the
+ * array 'p_lfsr88', into 'p_out'. The values of generator k are at
+ * p_out[k * num_out] to p_out[k * num_out + num_out - 1].
+ *
+ * LFSR88 combines 3 independent LFSRs, whose steps already run in
+ * parallel, so there is nothing to gain by stepping several generators
+ * together. This just calls simplerandom_lfsr88_fill() for each generator.
+ */
+void simplerandom_lfsr88_fill_multi(SimpleRandomLFSR88_t * p_lfsr88, size_t num_states, uint32_t * p_out, size_t num_out)
+{
+    size_t      k;
+
+    for (k = 0; k < num_states; k++)
+    {
+        simplerandom_lfsr88_fill(&p_lfsr88[k], p_out + k * num_out, num_out);
+    }
+}
+
+#ifdef UINT64_C
+
+/* Two values of simplerandom_lfsr88_next(), as one 64-bit value. See value64(). */
+static inline uint64_t lfsr88_next64(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    first;
+
+    first = lfsr88_next(p_lfsr88);
+    return value64(first, lfsr88_next(p_lfsr88));
+}
+
+uint64_t simplerandom_lfsr88_next64(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    return lfsr88_next64(p_lfsr88);
+}
+
+/* Generate 'num_out' 64-bit values into 'p_out'. This gives the same values as
+ * calling simplerandom_lfsr88_next64() 'num_out' times. Longer fills are done
+ * through simplerandom_lfsr88_fill(), FILL_CHUNK values at a time.
+ */
+void simplerandom_lfsr88_fill64(SimpleRandomLFSR88_t * p_lfsr88, uint64_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR88_t    lfsr88 = *p_lfsr88;
+    uint32_t                buf[FILL_CHUNK];
+    size_t                  i;
+
+    for ( ; num_out >= FILL_CHUNK / 2u; num_out -= FILL_CHUNK / 2u)
+    {
+        simplerandom_lfsr88_fill(&lfsr88, buf, FILL_CHUNK);
+        fill64_combine(p_out, buf, FILL_CHUNK / 2u);
+        p_out += FILL_CHUNK / 2u;
+    }
+    for (i = 0; i < num_out; i++)
+    {
+        p_out[i] = lfsr88_next64(&lfsr88);
+    }
+    *p_lfsr88 = lfsr88;
+}
+
+#endif /* defined(UINT64_C) */
+
 void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_data, size_t num_data)
 {
     uint32_t    current;
@@ -1369,3 +3501,385 @@ void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p
     }
 }
 
+/*********
+ * Lagged-Fibonacci table
+ ********/
+
+/* Fill the table of LFIB4 or SWB with values of Marsaglia's 1999 KISS,
+ * ((MWC1 ^ Cong) + SHR3), as done by settable() and init_t() in his test
+ * program.
+ */
+static void lag_table_seed(uint32_t * p_table, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3)
+{
+    SimpleRandomMWC1_t  mwc;
+    SimpleRandomCong_t  cong;
+    SimpleRandomSHR3_t  shr3;
+    size_t              i;
+
+    simplerandom_mwc1_seed(&mwc, seed_mwc_upper, seed_mwc_lower);
+    simplerandom_cong_seed(&cong, seed_cong);
+    simplerandom_shr3_seed(&shr3, seed_shr3);
+    for (i = 0; i < SIMPLERANDOM_LAG_TABLE_SIZE; i++)
+    {
+        p_table[i] = (mwc1_next(&mwc) ^ cong_next(&cong)) + shr3_next(&shr3);
+    }
+}
+
+/* Copy the table into 'p_history', oldest value first. The oldest value is
+ * the one after t[index], so this is two contiguous copies.
+ */
+static void lag_table_get_history(const uint32_t * restrict p_table, uint32_t index, uint32_t * restrict p_history)
+{
+    size_t      split = SIMPLERANDOM_LAG_TABLE_SIZE - 1u - index;
+    size_t      i;
+
+    for (i = 0; i < split; i++)
+    {
+        p_history[i] = p_table[index + 1u + i];
+    }
+    for (i = 0; i <= index; i++)
+    {
+        p_history[split + i] = p_table[i];
+    }
+}
+
+/* Reverse of lag_table_get_history(). */
+static void lag_table_set_history(uint32_t * restrict p_table, uint32_t index, const uint32_t * restrict p_history)
+{
+    size_t      split = SIMPLERANDOM_LAG_TABLE_SIZE - 1u - index;
+    size_t      i;
+
+    for (i = 0; i < split; i++)
+    {
+        p_table[index + 1u + i] = p_history[i];
+    }
+    for (i = 0; i <= index; i++)
+    {
+        p_table[i] = p_history[split + i];
+    }
+}
+
+/*********
+ * LFIB4
+ ********/
+
+size_t simplerandom_lfib4_num_seeds(const SimpleRandomLFIB4_t * p_lfib4)
+{
+    (void)p_lfib4;      /* We only use this parameter for type checking. */
+
+    return SIMPLERANDOM_LFIB4_NUM_SEEDS;
+}
+
+size_t simplerandom_lfib4_seed_array(SimpleRandomLFIB4_t * p_lfib4, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
+{
+    uint32_t    seed_mwc_upper = 0;
+    uint32_t    seed_mwc_lower = 0;
+    uint32_t    seed_cong = 0;
+    uint32_t    seed_shr3 = 0;
+    size_t      num_seeds_used = 0;
+
+    if (p_seeds != NULL)
+    {
+        if (num_seeds > 4u)
+            num_seeds_used = 4u;
+        else
+            num_seeds_used = num_seeds;
+        seed_mwc_upper  = (num_seeds >= 1) ? p_seeds[0] : 0;
+        seed_mwc_lower  = (num_seeds >= 2) ? p_seeds[1] : seed_mwc_upper;
+        seed_cong       = (num_seeds >= 3) ? p_seeds[2] : seed_mwc_lower;
+        seed_shr3       = (num_seeds >= 4) ? p_seeds[3] : seed_cong;
+    }
+    simplerandom_lfib4_seed(p_lfib4, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+
+    if (mix_extras && p_seeds != NULL)
+    {
+        simplerandom_lfib4_mix(p_lfib4, p_seeds + num_seeds_used, num_seeds - num_seeds_used);
+        num_seeds_used = num_seeds;
+    }
+    return num_seeds_used;
+}
+
+void simplerandom_lfib4_seed(SimpleRandomLFIB4_t * p_lfib4, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3)
+{
+    lag_table_seed(p_lfib4->t, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+    p_lfib4->index = 0;
+    simplerandom_lfib4_sanitize(p_lfib4);
+}
+
+/* The lowest bits of the table values are a linear generator mod 2, which
+ * is stuck at zero if they are all zero. In that case, set one of them.
+ */
+void simplerandom_lfib4_sanitize(SimpleRandomLFIB4_t * p_lfib4)
+{
+    uint32_t    odd = 0;
+    size_t      i;
+
+    p_lfib4->index &= LAG_TABLE_MASK;
+    for (i = 0; i < SIMPLERANDOM_LAG_TABLE_SIZE; i++)
+    {
+        odd |= p_lfib4->t[i];
+    }
+    if ((odd & 1u) == 0)
+    {
+        p_lfib4->t[0] |= 1u;
+    }
+}
+
+static inline uint32_t lfib4_next(SimpleRandomLFIB4_t * p_lfib4)
+{
+    uint32_t    c;
+
+    c = (p_lfib4->index + 1u) & LAG_TABLE_MASK;
+    p_lfib4->t[c] += p_lfib4->t[(c + LFIB4_OFFSET_1) & LAG_TABLE_MASK] +
+                     p_lfib4->t[(c + LFIB4_OFFSET_2) & LAG_TABLE_MASK] +
+                     p_lfib4->t[(c + LFIB4_OFFSET_3) & LAG_TABLE_MASK];
+    p_lfib4->index = c;
+    return p_lfib4->t[c];
+}
+
+uint32_t simplerandom_lfib4_next(SimpleRandomLFIB4_t * p_lfib4)
+{
+    return lfib4_next(p_lfib4);
+}
+
+/* Calculate values p_x[0] to p_x[num - 1], from the values before them:
+ * p_x[-SIMPLERANDOM_LAG_TABLE_SIZE] onwards.
+ *
+ * The shortest lag is 78, so each value doesn't depend on the 77 values
+ * before it. The compiler can vectorize the loop, calculating several
+ * consecutive values at once. As for the loops of simplerandom-batch.c, that
+ * is only done at -O2 if 'num' is a constant, so that there is no scalar
+ * epilogue.
+ */
+static inline void lfib4_fill_lagged(uint32_t * p_x, size_t num)
+{
+    size_t      i;
+
+    for (i = 0; i < num; i++)
+    {
+        p_x[i] = p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(0)] +
+                 p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(LFIB4_OFFSET_1)] +
+                 p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(LFIB4_OFFSET_2)] +
+                 p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(LFIB4_OFFSET_3)];
+    }
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_lfib4_next() 'num_out' times.
+ *
+ * The first SIMPLERANDOM_LAG_TABLE_SIZE values are calculated after a copy
+ * of the table, in time order. After that, each value is calculated from the
+ * earlier values in 'p_out', in blocks of SIMPLERANDOM_LAG_TABLE_SIZE values
+ * and then any remainder. Then the table is updated from the last
+ * SIMPLERANDOM_LAG_TABLE_SIZE values. Short fills aren't worth the copying,
+ * and are done one value at a time.
+ */
+void simplerandom_lfib4_fill(SimpleRandomLFIB4_t * p_lfib4, uint32_t * p_out, size_t num_out)
+{
+    uint32_t    x[2u * SIMPLERANDOM_LAG_TABLE_SIZE];
+    size_t      i;
+
+    if (num_out < SIMPLERANDOM_LAG_TABLE_SIZE)
+    {
+        for (i = 0; i < num_out; i++)
+        {
+            p_out[i] = lfib4_next(p_lfib4);
+        }
+    }
+    else
+    {
+        lag_table_get_history(p_lfib4->t, p_lfib4->index, x);
+        lfib4_fill_lagged(x + SIMPLERANDOM_LAG_TABLE_SIZE, SIMPLERANDOM_LAG_TABLE_SIZE);
+        for (i = 0; i < SIMPLERANDOM_LAG_TABLE_SIZE; i++)
+        {
+            p_out[i] = x[SIMPLERANDOM_LAG_TABLE_SIZE + i];
+        }
+        for ( ; i + SIMPLERANDOM_LAG_TABLE_SIZE <= num_out; i += SIMPLERANDOM_LAG_TABLE_SIZE)
+        {
+            lfib4_fill_lagged(p_out + i, SIMPLERANDOM_LAG_TABLE_SIZE);
+        }
+        lfib4_fill_lagged(p_out + i, num_out - i);
+        p_lfib4->index = (uint32_t)((p_lfib4->index + num_out) & LAG_TABLE_MASK);
+        lag_table_set_history(p_lfib4->t, p_lfib4->index, p_out + num_out - SIMPLERANDOM_LAG_TABLE_SIZE);
+    }
+}
+
+/* Each data word is XORed into the oldest table value, which is then used
+ * by the next step.
+ */
+void simplerandom_lfib4_mix(SimpleRandomLFIB4_t * p_lfib4, const uint32_t * p_data, size_t num_data)
+{
+    if (p_data != NULL)
+    {
+        while (num_data)
+        {
+            --num_data;
+            p_lfib4->t[(p_lfib4->index + 1u) & LAG_TABLE_MASK] ^= *p_data;
+            lfib4_next(p_lfib4);
+            ++p_data;
+        }
+        simplerandom_lfib4_sanitize(p_lfib4);
+    }
+}
+
+/*********
+ * SWB
+ ********/
+
+size_t simplerandom_swb_num_seeds(const SimpleRandomSWB_t * p_swb)
+{
+    (void)p_swb;        /* We only use this parameter for type checking. */
+
+    return SIMPLERANDOM_SWB_NUM_SEEDS;
+}
+
+size_t simplerandom_swb_seed_array(SimpleRandomSWB_t * p_swb, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras)
+{
+    uint32_t    seed_mwc_upper = 0;
+    uint32_t    seed_mwc_lower = 0;
+    uint32_t    seed_cong = 0;
+    uint32_t    seed_shr3 = 0;
+    size_t      num_seeds_used = 0;
+
+    if (p_seeds != NULL)
+    {
+        if (num_seeds > 4u)
+            num_seeds_used = 4u;
+        else
+            num_seeds_used = num_seeds;
+        seed_mwc_upper  = (num_seeds >= 1) ? p_seeds[0] : 0;
+        seed_mwc_lower  = (num_seeds >= 2) ? p_seeds[1] : seed_mwc_upper;
+        seed_cong       = (num_seeds >= 3) ? p_seeds[2] : seed_mwc_lower;
+        seed_shr3       = (num_seeds >= 4) ? p_seeds[3] : seed_cong;
+    }
+    simplerandom_swb_seed(p_swb, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+
+    if (mix_extras && p_seeds != NULL)
+    {
+        simplerandom_swb_mix(p_swb, p_seeds + num_seeds_used, num_seeds - num_seeds_used);
+        num_seeds_used = num_seeds;
+    }
+    return num_seeds_used;
+}
+
+void simplerandom_swb_seed(SimpleRandomSWB_t * p_swb, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3)
+{
+    lag_table_seed(p_swb->t, seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+    p_swb->index = 0;
+    p_swb->borrow = 0;
+    simplerandom_swb_sanitize(p_swb);
+}
+
+/* An all-zero table with no borrow gives constant zero output. In that case,
+ * set one of the table values.
+ */
+void simplerandom_swb_sanitize(SimpleRandomSWB_t * p_swb)
+{
+    uint32_t    any = 0;
+    size_t      i;
+
+    p_swb->index &= LAG_TABLE_MASK;
+    p_swb->borrow = (p_swb->borrow != 0);
+    for (i = 0; i < SIMPLERANDOM_LAG_TABLE_SIZE; i++)
+    {
+        any |= p_swb->t[i];
+    }
+    if (any == 0 && p_swb->borrow == 0)
+    {
+        p_swb->t[0] = UINT32_C(0xFFFFFFFF);
+    }
+}
+
+/* One step of SWB, x = a - b - borrow. The borrow for the next step is
+ * calculated as in Marsaglia's SWB macro, including the 32-bit wrap of
+ * b + borrow.
+ */
+static inline uint32_t swb_step(uint32_t a, uint32_t b, uint32_t * p_borrow)
+{
+    b += *p_borrow;
+    *p_borrow = (a < b);
+    return a - b;
+}
+
+static inline uint32_t swb_next(SimpleRandomSWB_t * p_swb)
+{
+    uint32_t    c;
+
+    c = (p_swb->index + 1u) & LAG_TABLE_MASK;
+    p_swb->t[c] = swb_step(p_swb->t[(c + SWB_OFFSET_X) & LAG_TABLE_MASK],
+                           p_swb->t[(c + SWB_OFFSET_Y) & LAG_TABLE_MASK],
+                           &p_swb->borrow);
+    p_swb->index = c;
+    return p_swb->t[c];
+}
+
+uint32_t simplerandom_swb_next(SimpleRandomSWB_t * p_swb)
+{
+    return swb_next(p_swb);
+}
+
+/* As lfib4_fill_lagged(), for SWB. The borrow makes each value depend on
+ * the one before, so this isn't vectorized, but it avoids the index
+ * calculations of swb_next().
+ */
+static inline uint32_t swb_fill_lagged(uint32_t * p_x, size_t num, uint32_t borrow)
+{
+    size_t      i;
+
+    for (i = 0; i < num; i++)
+    {
+        p_x[i] = swb_step(p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(SWB_OFFSET_X)],
+                          p_x[(ptrdiff_t)i - (ptrdiff_t)LAG(SWB_OFFSET_Y)],
+                          &borrow);
+    }
+    return borrow;
+}
+
+/* Generate 'num_out' values into 'p_out'. This gives the same values as
+ * calling simplerandom_swb_next() 'num_out' times. As for
+ * simplerandom_lfib4_fill().
+ */
+void simplerandom_swb_fill(SimpleRandomSWB_t * p_swb, uint32_t * p_out, size_t num_out)
+{
+    uint32_t    x[2u * SIMPLERANDOM_LAG_TABLE_SIZE];
+    uint32_t    borrow;
+    size_t      i;
+
+    if (num_out < SIMPLERANDOM_LAG_TABLE_SIZE)
+    {
+        for (i = 0; i < num_out; i++)
+        {
+            p_out[i] = swb_next(p_swb);
+        }
+    }
+    else
+    {
+        lag_table_get_history(p_swb->t, p_swb->index, x);
+        borrow = swb_fill_lagged(x + SIMPLERANDOM_LAG_TABLE_SIZE, SIMPLERANDOM_LAG_TABLE_SIZE, p_swb->borrow);
+        for (i = 0; i < SIMPLERANDOM_LAG_TABLE_SIZE; i++)
+        {
+            p_out[i] = x[SIMPLERANDOM_LAG_TABLE_SIZE + i];
+        }
+        p_swb->borrow = swb_fill_lagged(p_out + SIMPLERANDOM_LAG_TABLE_SIZE, num_out - SIMPLERANDOM_LAG_TABLE_SIZE, borrow);
+        p_swb->index = (uint32_t)((p_swb->index + num_out) & LAG_TABLE_MASK);
+        lag_table_set_history(p_swb->t, p_swb->index, p_out + num_out - SIMPLERANDOM_LAG_TABLE_SIZE);
+    }
+}
+
+/* Each data word is XORed into the table value that is used as 'a' by the
+ * next step.
+ */
+void simplerandom_swb_mix(SimpleRandomSWB_t * p_swb, const uint32_t * p_data, size_t num_data)
+{
+    if (p_data != NULL)
+    {
+        while (num_data)
+        {
+            --num_data;
+            p_swb->t[(p_swb->index + 1u + SWB_OFFSET_X) & LAG_TABLE_MASK] ^= *p_data;
+            swb_next(p_swb);
+            ++p_data;
+        }
+        simplerandom_swb_sanitize(p_swb);
+    }
+}
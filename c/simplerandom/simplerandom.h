@@ -34,10 +34,24 @@
  *     Cong
  *     SHR3
  *     KISS2
+ * A later post in 2003 gave the complementary multiply-with-carry generator
+ *     CMWC4096
+ * which has a table of 4096 state values and a very long period.
+ *
+ * The third Marsaglia post was in 2009 [5]. From that newsgroup post, the
+ * following RNG is defined:
+ *     KISS64
+ * It is made of 64-bit MWC, SHR3 and Cong components, and outputs 64-bit
+ * values.
  *
  * The LFSR113 generator by L'Ecuyer is also implemented
  * [4], along with his earlier LFSR88.
  *
+ * Also from the 1999 post are the lagged-Fibonacci generators LFIB4 and SWB,
+ * which have a table of 256 state values. They are fast for bulk generation,
+ * because many values can be calculated at once from the table, but they are
+ * not as good quality as the other generators.
+ *
  * Some generators naturally have "bad" seed values, which if used will
  * not output a good-quality sequence. The most obvious is zero values for the
  * SHR3, MWC and LFSR generators, yielding constant zero output. But there are
@@ -70,6 +84,10 @@
  *     Pierre L'Ecuyer
  *     http://citeseerx.ist.psu.edu/viewdoc/summary?doi=10.1.1.43.3639
  *     http://www.iro.umontreal.ca/~simardr/rng/lfsr113.c
+ *
+ * [5] 64-bit KISS RNGs
+ *     George Marsaglia
+ *     Newsgroup post, sci.math, Feb 2009
  */
 
 
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Benchmark regression check, run by "make check" when configured with
+# --enable-bench-check. Fails if any result is slower than the baseline by
+# more than BENCH_THRESHOLD percent. The baseline is machine-specific, and is
+# made in the build directory by "make bench-baseline". If there is none, the
+# check is skipped.
+
+baseline="${BENCH_BASELINE:-bench_baseline.csv}"
+if [ ! -f "$baseline" ]; then
+    echo "No benchmark baseline '$baseline'; run \"make bench-baseline\" first"
+    exit 77
+fi
+
+exec ./bench_simple ${BENCH_CHECK_FLAGS:---cpu=0 --repeat=7} \
+    --baseline="$baseline" \
+    --threshold="${BENCH_THRESHOLD:-50}"
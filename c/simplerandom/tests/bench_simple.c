@@ -0,0 +1,1344 @@
+/*
+ * bench_simple.c
+ *
+ * Throughput and latency benchmarks for the simplerandom generators.
+ *
+ * For each generator, this times:
+ *     next        Generate values one at a time with simplerandom_zzz_next().
+ *     fill        Generate values into a buffer with simplerandom_zzz_fill().
+ *     next64      Generate 64-bit values one at a time with simplerandom_zzz_next64().
+ *     fill64      Generate 64-bit values into a buffer with simplerandom_zzz_fill64().
+ *     batch       Step a batch of generators with simplerandom_zzz_batch_next_all(),
+ *                 for the generators that have a batch API.
+ *     lanes       Generate lane-interleaved values with simplerandom_zzz_lanes_fill(),
+ *                 for the generators that have a multi-lane API.
+ *     fill_multi  Fill from several generators with simplerandom_zzz_fill_multi().
+ *     double      Generate doubles in [0, 1) from one 32-bit value each.
+ *     double53    Generate doubles in [0, 1) with 53-bit resolution, from two
+ *                 32-bit values each.
+ *     seed        Seed with simplerandom_zzz_seed_array().
+ *     seed_batch  Seed an array of generators with simplerandom_zzz_seed_batch().
+ *     mix         Mix data into the state with simplerandom_zzz_mix().
+ *     mix_bulk    Mix a larger block of data into the state with
+ *                 simplerandom_zzz_mix_bulk().
+ *     discard     Jump ahead with simplerandom_zzz_discard(), for a range of n.
+ *
+ * Results are the median over a number of repeated runs, of the time per
+ * value (or per call, for seed and discard, or per generator, for seed_batch, or
+ * per data word, for mix and mix_bulk). Where
+ * available, CPU cycles per value are also reported, counted by the Linux perf
+ * cycle counter, or failing that, the x86 time-stamp counter (which counts at
+ * a constant reference rate, not the actual CPU clock rate).
+ *
+ * Usage:
+ *     bench_simple [--format=text|csv|json] [--repeat=N] [--min-time-ms=N]
+ *                  [--generator=NAME] [--operation=NAME] [--cpu=N]
+ *                  [--baseline=FILE] [--threshold=PERCENT]
+ *     bench_simple --discard-sweep [--format=text|csv|json] [--repeat=N]
+ *                  [--min-time-ms=N] [--generator=NAME] [--cpu=N]
+ *
+ * Build and run it with "make bench". An unknown option, or an option value
+ * that isn't a valid number in range, prints the usage and exits with
+ * status 2.
+ *
+ * With --baseline, the results are compared against a baseline file, in the
+ * CSV format output by --format=csv. If any result is slower than its
+ * baseline by more than the threshold percentage (default 50%), it is
+ * measured again (up to BENCH_MAX_RETRIES times), and if it is still too
+ * slow, the program exits with status 1. Results with no baseline entry are
+ * not checked. This is run by "make bench-check", and by "make check" if
+ * configured with --enable-bench-check. Timings are machine-specific, so the
+ * baseline file is not part of the source. "make bench-baseline" writes it to
+ * bench_baseline.csv in the build directory, on the machine where the check
+ * is run. --cpu pins the benchmark to one CPU, to reduce noise from migration
+ * between CPUs.
+ *
+ * With --discard-sweep, the cost of simplerandom_zzz_discard(n) is measured
+ * for n = 2^k, for k from 0 to 63, and n = UINTMAX_MAX. This is compared with
+ * the cost of n calls of simplerandom_zzz_next() (the measured time per call,
+ * times n). The crossover point is the smallest n for which discard(n) is
+ * faster. It is found by taking the first power of 2 for which discard(n) is
+ * faster, then bisecting down to the previous power of 2. The cost of discard
+ * doesn't increase smoothly with n (it depends on the bits set in n), so the
+ * crossover point is approximate. Run this with "make bench-discard". The
+ * table generators (CMWC4096, LFIB4, SWB) have no discard(), so they are left
+ * out.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#define _GNU_SOURCE
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SCHED_SETAFFINITY
+#include <sched.h>
+#endif
+
+#if defined(HAVE_X86INTRIN_H) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCH_HAVE_RDTSC
+#endif
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define BENCH_DEFAULT_REPEAT        5u
+#define BENCH_DEFAULT_MIN_TIME_MS   20u
+#define BENCH_MAX_REPEAT            101u
+#define BENCH_DEFAULT_THRESHOLD     50.0
+#define BENCH_MAX_RETRIES           3u
+#define BENCH_MAX_BASELINE          256u
+#define BENCH_MAX_NAME_LEN          16u
+
+#define BENCH_FILL_SIZE             4096u
+#define BENCH_BATCH_NUM             1024u
+#define BENCH_MIX_SIZE              16u
+#define BENCH_SEED_BATCH_NUM        (BENCH_FILL_SIZE / 4u)
+#define BENCH_FILL_MULTI_NUM        4u
+
+/* The discard sweep bisects the crossover point down to this fraction of n. */
+#define BENCH_CROSSOVER_PRECISION   16u
+
+/* 2^-32 and 2^-53 */
+#define BENCH_DOUBLE_32             (1.0 / 4294967296.0)
+#define BENCH_DOUBLE_53             (1.0 / 9007199254740992.0)
+
+typedef enum
+{
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON,
+} BenchFormat_t;
+
+typedef union
+{
+    SimpleRandomCong_t      cong;
+    SimpleRandomSHR3_t      shr3;
+    SimpleRandomMWC1_t      mwc1;
+    SimpleRandomMWC2_t      mwc2;
+    SimpleRandomKISS_t      kiss;
+#ifdef UINT64_C
+    SimpleRandomMWC64_t     mwc64;
+    SimpleRandomKISS2_t     kiss2;
+    SimpleRandomKISS64_t    kiss64;
+    SimpleRandomCMWC4096_t  cmwc4096;
+#endif
+    SimpleRandomLFSR113_t   lfsr113;
+    SimpleRandomLFSR88_t    lfsr88;
+    SimpleRandomLFIB4_t     lfib4;
+    SimpleRandomSWB_t       swb;
+} BenchState_t;
+
+/* Functions to operate on one generator type, given a generic state.
+ * Generators with only 64-bit output (KISS64) have NULL p_next_n, p_fill and
+ * p_fill_multi_n. Table generators (CMWC4096, LFIB4, SWB) have NULL p_seed_batch,
+ * p_next64_n, p_fill64, p_discard and p_fill_multi_n. The operations that
+ * need a NULL function are skipped. */
+typedef struct
+{
+    const char    * p_name;
+    void          (*p_seed)(BenchState_t * p_state, const uint32_t * p_seeds, size_t num_seeds);
+    void          (*p_seed_batch)(void * p_states, const uint32_t * p_seeds, size_t count);
+    uint32_t      (*p_next_n)(BenchState_t * p_state, size_t n);
+    void          (*p_fill)(BenchState_t * p_state, uint32_t * p_out, size_t n);
+    uint64_t      (*p_next64_n)(BenchState_t * p_state, size_t n);
+    void          (*p_fill64)(BenchState_t * p_state, uint64_t * p_out, size_t n);
+    void          (*p_mix)(BenchState_t * p_state, const uint32_t * p_data, size_t num_data);
+    void          (*p_mix_bulk)(BenchState_t * p_state, const uint32_t * p_data, size_t num_data);
+    void          (*p_discard)(BenchState_t * p_state, uintmax_t n);
+    /* Steps a batch of BENCH_BATCH_NUM generators 'n' times. NULL if the
+     * generator has no batch API. */
+    uint32_t      (*p_batch_n)(void * p_buf, size_t n);
+    /* Fills the buffer 'n' times from a multi-lane generator. NULL if the
+     * generator has no multi-lane API. */
+    uint32_t      (*p_lanes_n)(BenchState_t * p_state, size_t n);
+    /* Fills the buffer 'n' times from BENCH_FILL_MULTI_NUM generators. */
+    uint32_t      (*p_fill_multi_n)(BenchState_t * p_state, size_t n);
+} BenchGenerator_t;
+
+/* A benchmark operation. Runs 'iterations' iterations, and returns the number
+ * of values (or calls, or words) processed. */
+typedef uint64_t (*BenchFunction_t)(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations);
+
+typedef struct
+{
+    const char    * p_name;
+    BenchFunction_t p_function;
+    /* Bytes output per value, for reporting throughput. 0 if not meaningful. */
+    unsigned        bytes_per_value;
+} BenchOperation_t;
+
+typedef struct
+{
+    double          ns_per_value;
+    double          cycles_per_value;
+    double          gb_per_s;
+    /* Ratio of ns_per_value to the baseline. 0 if there is no baseline. */
+    double          baseline_ratio;
+} BenchResult_t;
+
+typedef struct
+{
+    char            generator[BENCH_MAX_NAME_LEN];
+    char            operation[BENCH_MAX_NAME_LEN];
+    uintmax_t       n;
+    double          ns_per_value;
+} BenchBaseline_t;
+
+typedef struct
+{
+    BenchFormat_t   format;
+    unsigned        repeat;
+    unsigned        min_time_ms;
+    const char    * p_generator;
+    const char    * p_operation;
+    const char    * p_baseline_file;
+    double          threshold;
+    int             cpu;
+    bool            discard_sweep;
+} BenchOptions_t;
+
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+/* Results are accumulated here so the compiler can't discard the work. */
+static volatile uint32_t    bench_sink;
+static volatile double      bench_sink_double;
+
+static uint32_t             bench_buf[BENCH_FILL_SIZE];
+static double               bench_double_buf[BENCH_FILL_SIZE];
+static uint64_t             bench_buf64[BENCH_FILL_SIZE / 2u];
+static void               * p_bench_batch_buf;
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+static int                  bench_perf_fd = -1;
+#endif
+
+static BenchBaseline_t      bench_baseline[BENCH_MAX_BASELINE];
+static size_t               bench_num_baseline;
+
+/* Jump distances for the discard benchmark. */
+static const uintmax_t      bench_discard_n[] =
+{
+    1u,
+    1000u,
+    1000000u,
+    1000000000u,
+    UINT32_C(0xFFFFFFFF),
+    UINTMAX_MAX,
+};
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*********
+ * Timing
+ ********/
+
+static uint64_t bench_time_ns(void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+    struct timespec     ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#else
+    return (uint64_t)clock() * (1000000000u / CLOCKS_PER_SEC);
+#endif
+}
+
+static void bench_cycles_init(void)
+{
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    struct perf_event_attr  attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    bench_perf_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+static const char * bench_cycles_source(void)
+{
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    if (bench_perf_fd >= 0)
+        return "perf";
+#endif
+#ifdef BENCH_HAVE_RDTSC
+    return "rdtsc";
+#else
+    return "none";
+#endif
+}
+
+static uint64_t bench_cycles(void)
+{
+#ifdef HAVE_LINUX_PERF_EVENT_H
+    uint64_t            count;
+
+    if (bench_perf_fd >= 0 && read(bench_perf_fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        return count;
+#endif
+#ifdef BENCH_HAVE_RDTSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int bench_compare_double(const void * p_a, const void * p_b)
+{
+    double      a = *(const double *)p_a;
+    double      b = *(const double *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static double bench_median(double * p_values, size_t num_values)
+{
+    qsort(p_values, num_values, sizeof(p_values[0]), bench_compare_double);
+    if (num_values % 2u)
+        return p_values[num_values / 2u];
+    return (p_values[num_values / 2u - 1u] + p_values[num_values / 2u]) / 2.0;
+}
+
+/*********
+ * Generators
+ *
+ * Generic wrappers for each generator type. Each wrapper loops over the
+ * generator's own functions, so the cost of the indirect call is amortised.
+ ********/
+
+#define BENCH_GENERATOR_FUNCTIONS(zzz, member) \
+static void zzz##_bench_seed(BenchState_t * p_state, const uint32_t * p_seeds, size_t num_seeds) \
+{ \
+    simplerandom_##zzz##_seed_array(&p_state->member, p_seeds, num_seeds, true); \
+} \
+static void zzz##_bench_seed_batch(void * p_states, const uint32_t * p_seeds, size_t count) \
+{ \
+    simplerandom_##zzz##_seed_batch(p_states, p_seeds, count); \
+} \
+static uint32_t zzz##_bench_next_n(BenchState_t * p_state, size_t n) \
+{ \
+    uint32_t    result = 0; \
+    size_t      i; \
+    for (i = 0; i < n; i++) \
+    { \
+        result ^= simplerandom_##zzz##_next(&p_state->member); \
+    } \
+    return result; \
+} \
+static void zzz##_bench_fill(BenchState_t * p_state, uint32_t * p_out, size_t n) \
+{ \
+    simplerandom_##zzz##_fill(&p_state->member, p_out, n); \
+} \
+static uint64_t zzz##_bench_next64_n(BenchState_t * p_state, size_t n) \
+{ \
+    uint64_t    result = 0; \
+    size_t      i; \
+    for (i = 0; i < n; i++) \
+    { \
+        result ^= simplerandom_##zzz##_next64(&p_state->member); \
+    } \
+    return result; \
+} \
+static void zzz##_bench_fill64(BenchState_t * p_state, uint64_t * p_out, size_t n) \
+{ \
+    simplerandom_##zzz##_fill64(&p_state->member, p_out, n); \
+} \
+static void zzz##_bench_mix(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix(&p_state->member, p_data, num_data); \
+} \
+static void zzz##_bench_mix_bulk(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix_bulk(&p_state->member, p_data, num_data); \
+} \
+static void zzz##_bench_discard(BenchState_t * p_state, uintmax_t n) \
+{ \
+    simplerandom_##zzz##_discard(&p_state->member, n); \
+}
+
+#define BENCH_BATCH_FUNCTION(zzz, Batch) \
+static uint32_t zzz##_bench_batch_n(void * p_buf, size_t n) \
+{ \
+    Batch       batch; \
+    uint32_t    result = 0; \
+    size_t      i; \
+    simplerandom_##zzz##_batch_init(&batch, p_buf, simplerandom_##zzz##_batch_buf_size(BENCH_BATCH_NUM), BENCH_BATCH_NUM); \
+    for (i = 0; i < n; i++) \
+    { \
+        simplerandom_##zzz##_batch_next_all(&batch, bench_buf); \
+        result ^= bench_buf[i % BENCH_BATCH_NUM]; \
+    } \
+    return result; \
+}
+
+#define BENCH_LANES_FUNCTION(zzz, member, Lanes) \
+static uint32_t zzz##_bench_lanes_n(BenchState_t * p_state, size_t n) \
+{ \
+    Lanes       lanes; \
+    size_t      i; \
+    simplerandom_##zzz##_lanes_init(&lanes, &p_state->member); \
+    for (i = 0; i < n; i++) \
+    { \
+        simplerandom_##zzz##_lanes_fill(&lanes, bench_buf, BENCH_FILL_SIZE); \
+    } \
+    return bench_buf[BENCH_FILL_SIZE - 1u]; \
+}
+
+#define BENCH_FILL_MULTI_FUNCTION(zzz, member, State) \
+static uint32_t zzz##_bench_fill_multi_n(BenchState_t * p_state, size_t n) \
+{ \
+    State       states[BENCH_FILL_MULTI_NUM]; \
+    uint32_t    data; \
+    size_t      i; \
+    for (i = 0; i < BENCH_FILL_MULTI_NUM; i++) \
+    { \
+        states[i] = p_state->member; \
+        data = (uint32_t)i; \
+        simplerandom_##zzz##_mix(&states[i], &data, 1u); \
+    } \
+    for (i = 0; i < n; i++) \
+    { \
+        simplerandom_##zzz##_fill_multi(states, BENCH_FILL_MULTI_NUM, bench_buf, BENCH_FILL_SIZE / BENCH_FILL_MULTI_NUM); \
+    } \
+    p_state->member = states[0]; \
+    return bench_buf[BENCH_FILL_SIZE - 1u]; \
+}
+
+/* Wrappers for a generator with only 64-bit output, whose next() and fill()
+ * give 64-bit values. */
+#define BENCH_GENERATOR64_FUNCTIONS(zzz, member) \
+static void zzz##_bench_seed(BenchState_t * p_state, const uint32_t * p_seeds, size_t num_seeds) \
+{ \
+    simplerandom_##zzz##_seed_array(&p_state->member, p_seeds, num_seeds, true); \
+} \
+static uint64_t zzz##_bench_next64_n(BenchState_t * p_state, size_t n) \
+{ \
+    uint64_t    result = 0; \
+    size_t      i; \
+    for (i = 0; i < n; i++) \
+    { \
+        result ^= simplerandom_##zzz##_next(&p_state->member); \
+    } \
+    return result; \
+} \
+static void zzz##_bench_fill64(BenchState_t * p_state, uint64_t * p_out, size_t n) \
+{ \
+    simplerandom_##zzz##_fill(&p_state->member, p_out, n); \
+} \
+static void zzz##_bench_mix(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix(&p_state->member, p_data, num_data); \
+} \
+static void zzz##_bench_mix_bulk(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix_bulk(&p_state->member, p_data, num_data); \
+} \
+static void zzz##_bench_discard(BenchState_t * p_state, uintmax_t n) \
+{ \
+    simplerandom_##zzz##_discard(&p_state->member, n); \
+}
+
+/* Wrappers for a table generator, which has only seeding, mixing, next() and
+ * fill(). */
+#define BENCH_TABLE_GENERATOR_FUNCTIONS(zzz, member) \
+static void zzz##_bench_seed(BenchState_t * p_state, const uint32_t * p_seeds, size_t num_seeds) \
+{ \
+    simplerandom_##zzz##_seed_array(&p_state->member, p_seeds, num_seeds, true); \
+} \
+static uint32_t zzz##_bench_next_n(BenchState_t * p_state, size_t n) \
+{ \
+    uint32_t    result = 0; \
+    size_t      i; \
+    for (i = 0; i < n; i++) \
+    { \
+        result ^= simplerandom_##zzz##_next(&p_state->member); \
+    } \
+    return result; \
+} \
+static void zzz##_bench_fill(BenchState_t * p_state, uint32_t * p_out, size_t n) \
+{ \
+    simplerandom_##zzz##_fill(&p_state->member, p_out, n); \
+} \
+static void zzz##_bench_mix(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix(&p_state->member, p_data, num_data); \
+} \
+static void zzz##_bench_mix_bulk(BenchState_t * p_state, const uint32_t * p_data, size_t num_data) \
+{ \
+    simplerandom_##zzz##_mix_bulk(&p_state->member, p_data, num_data); \
+}
+
+BENCH_GENERATOR_FUNCTIONS(cong, cong)
+BENCH_GENERATOR_FUNCTIONS(shr3, shr3)
+BENCH_GENERATOR_FUNCTIONS(mwc1, mwc1)
+BENCH_GENERATOR_FUNCTIONS(mwc2, mwc2)
+BENCH_GENERATOR_FUNCTIONS(kiss, kiss)
+#ifdef UINT64_C
+BENCH_GENERATOR_FUNCTIONS(mwc64, mwc64)
+BENCH_GENERATOR_FUNCTIONS(kiss2, kiss2)
+BENCH_GENERATOR64_FUNCTIONS(kiss64, kiss64)
+
+/* KISS64 takes 8 seed words per generator, but the seed buffer only has 4 for
+ * each of 'count' generators, so each half of the generators uses the same
+ * seeds. */
+static void kiss64_bench_seed_batch(void * p_states, const uint32_t * p_seeds, size_t count)
+{
+    simplerandom_kiss64_seed_batch(p_states, p_seeds, count / 2u);
+    simplerandom_kiss64_seed_batch((SimpleRandomKISS64_t *)p_states + count / 2u, p_seeds, count - count / 2u);
+}
+BENCH_TABLE_GENERATOR_FUNCTIONS(cmwc4096, cmwc4096)
+#endif
+BENCH_GENERATOR_FUNCTIONS(lfsr113, lfsr113)
+BENCH_GENERATOR_FUNCTIONS(lfsr88, lfsr88)
+BENCH_TABLE_GENERATOR_FUNCTIONS(lfib4, lfib4)
+BENCH_TABLE_GENERATOR_FUNCTIONS(swb, swb)
+
+BENCH_BATCH_FUNCTION(shr3, SimpleRandomSHR3Batch_t)
+BENCH_BATCH_FUNCTION(mwc2, SimpleRandomMWC2Batch_t)
+BENCH_BATCH_FUNCTION(kiss, SimpleRandomKISSBatch_t)
+BENCH_BATCH_FUNCTION(lfsr113, SimpleRandomLFSR113Batch_t)
+
+BENCH_LANES_FUNCTION(cong, cong, SimpleRandomCongLanes_t)
+BENCH_LANES_FUNCTION(mwc1, mwc1, SimpleRandomMWC1Lanes_t)
+BENCH_LANES_FUNCTION(mwc2, mwc2, SimpleRandomMWC2Lanes_t)
+#ifdef UINT64_C
+BENCH_LANES_FUNCTION(mwc64, mwc64, SimpleRandomMWC64Lanes_t)
+#endif
+
+BENCH_FILL_MULTI_FUNCTION(cong, cong, SimpleRandomCong_t)
+BENCH_FILL_MULTI_FUNCTION(shr3, shr3, SimpleRandomSHR3_t)
+BENCH_FILL_MULTI_FUNCTION(mwc1, mwc1, SimpleRandomMWC1_t)
+BENCH_FILL_MULTI_FUNCTION(mwc2, mwc2, SimpleRandomMWC2_t)
+BENCH_FILL_MULTI_FUNCTION(kiss, kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+BENCH_FILL_MULTI_FUNCTION(mwc64, mwc64, SimpleRandomMWC64_t)
+BENCH_FILL_MULTI_FUNCTION(kiss2, kiss2, SimpleRandomKISS2_t)
+#endif
+BENCH_FILL_MULTI_FUNCTION(lfsr113, lfsr113, SimpleRandomLFSR113_t)
+BENCH_FILL_MULTI_FUNCTION(lfsr88, lfsr88, SimpleRandomLFSR88_t)
+
+#define BENCH_GENERATOR(name, zzz, batch_n, lanes_n) \
+    { name, zzz##_bench_seed, zzz##_bench_seed_batch, zzz##_bench_next_n, zzz##_bench_fill, zzz##_bench_next64_n, zzz##_bench_fill64, zzz##_bench_mix, zzz##_bench_mix_bulk, zzz##_bench_discard, batch_n, lanes_n, zzz##_bench_fill_multi_n }
+
+#define BENCH_GENERATOR64(name, zzz) \
+    { name, zzz##_bench_seed, zzz##_bench_seed_batch, NULL, NULL, zzz##_bench_next64_n, zzz##_bench_fill64, zzz##_bench_mix, zzz##_bench_mix_bulk, zzz##_bench_discard, NULL, NULL, NULL }
+
+#define BENCH_TABLE_GENERATOR(name, zzz) \
+    { name, zzz##_bench_seed, NULL, zzz##_bench_next_n, zzz##_bench_fill, NULL, NULL, zzz##_bench_mix, zzz##_bench_mix_bulk, NULL, NULL, NULL, NULL }
+
+static const BenchGenerator_t bench_generators[] =
+{
+    BENCH_GENERATOR("Cong",     cong,       NULL,                   cong_bench_lanes_n),
+    BENCH_GENERATOR("SHR3",     shr3,       shr3_bench_batch_n,     NULL),
+    BENCH_GENERATOR("MWC1",     mwc1,       NULL,                   mwc1_bench_lanes_n),
+    BENCH_GENERATOR("MWC2",     mwc2,       mwc2_bench_batch_n,     mwc2_bench_lanes_n),
+    BENCH_GENERATOR("KISS",     kiss,       kiss_bench_batch_n,     NULL),
+#ifdef UINT64_C
+    BENCH_GENERATOR("MWC64",    mwc64,      NULL,                   mwc64_bench_lanes_n),
+    BENCH_GENERATOR("KISS2",    kiss2,      NULL,                   NULL),
+    BENCH_GENERATOR64("KISS64", kiss64),
+    BENCH_TABLE_GENERATOR("CMWC4096", cmwc4096),
+#endif
+    BENCH_GENERATOR("LFSR113",  lfsr113,    lfsr113_bench_batch_n,  NULL),
+    BENCH_GENERATOR("LFSR88",   lfsr88,     NULL,                   NULL),
+    BENCH_TABLE_GENERATOR("LFIB4",  lfib4),
+    BENCH_TABLE_GENERATOR("SWB",    swb),
+};
+
+/*********
+ * Operations
+ ********/
+
+static uint64_t bench_next(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    (void)param;
+    bench_sink ^= p_gen->p_next_n(p_state, (size_t)iterations);
+    return iterations;
+}
+
+static uint64_t bench_fill(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_fill(p_state, bench_buf, BENCH_FILL_SIZE);
+    }
+    bench_sink ^= bench_buf[BENCH_FILL_SIZE - 1u];
+    return iterations * BENCH_FILL_SIZE;
+}
+
+static uint64_t bench_next64(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    (void)param;
+    bench_sink ^= (uint32_t)p_gen->p_next64_n(p_state, (size_t)iterations);
+    return iterations;
+}
+
+static uint64_t bench_fill64(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_fill64(p_state, bench_buf64, BENCH_FILL_SIZE / 2u);
+    }
+    bench_sink ^= (uint32_t)bench_buf64[BENCH_FILL_SIZE / 2u - 1u];
+    return iterations * (BENCH_FILL_SIZE / 2u);
+}
+
+static uint64_t bench_batch(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    (void)p_state;
+    (void)param;
+    bench_sink ^= p_gen->p_batch_n(p_bench_batch_buf, (size_t)iterations);
+    return iterations * BENCH_BATCH_NUM;
+}
+
+static uint64_t bench_lanes(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    (void)param;
+    bench_sink ^= p_gen->p_lanes_n(p_state, (size_t)iterations);
+    return iterations * BENCH_FILL_SIZE;
+}
+
+static uint64_t bench_fill_multi(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    (void)param;
+    bench_sink ^= p_gen->p_fill_multi_n(p_state, (size_t)iterations);
+    return iterations * BENCH_FILL_SIZE;
+}
+
+static uint64_t bench_double(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+    size_t      j;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_fill(p_state, bench_buf, BENCH_FILL_SIZE);
+        for (j = 0; j < BENCH_FILL_SIZE; j++)
+        {
+            bench_double_buf[j] = (double)bench_buf[j] * BENCH_DOUBLE_32;
+        }
+    }
+    bench_sink_double = bench_double_buf[BENCH_FILL_SIZE - 1u];
+    return iterations * BENCH_FILL_SIZE;
+}
+
+static uint64_t bench_double53(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+    size_t      j;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_fill(p_state, bench_buf, BENCH_FILL_SIZE);
+        for (j = 0; j < BENCH_FILL_SIZE / 2u; j++)
+        {
+            bench_double_buf[j] = ((double)(bench_buf[2u * j] >> 5u) * 67108864.0 + (double)(bench_buf[2u * j + 1u] >> 6u)) * BENCH_DOUBLE_53;
+        }
+    }
+    bench_sink_double = bench_double_buf[BENCH_FILL_SIZE / 2u - 1u];
+    return iterations * (BENCH_FILL_SIZE / 2u);
+}
+
+static uint64_t bench_seed(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint32_t    seeds[4] = { 0 };
+    uint64_t    i;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        seeds[0] = (uint32_t)i;
+        p_gen->p_seed(p_state, seeds, 4u);
+    }
+    return iterations;
+}
+
+/* Seeds BENCH_SEED_BATCH_NUM generators per iteration, from the values in
+ * bench_buf, into the batch buffer (which is big enough for any generator's
+ * state structures). */
+static uint64_t bench_seed_batch(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    (void)p_state;
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_seed_batch(p_bench_batch_buf, bench_buf, BENCH_SEED_BATCH_NUM);
+    }
+    return iterations * BENCH_SEED_BATCH_NUM;
+}
+
+static uint64_t bench_mix(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_mix(p_state, bench_buf, BENCH_MIX_SIZE);
+    }
+    return iterations * BENCH_MIX_SIZE;
+}
+
+static uint64_t bench_mix_bulk(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    (void)param;
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_mix_bulk(p_state, bench_buf, BENCH_FILL_SIZE);
+    }
+    return iterations * BENCH_FILL_SIZE;
+}
+
+static uint64_t bench_discard(const BenchGenerator_t * p_gen, BenchState_t * p_state, uintmax_t param, uint64_t iterations)
+{
+    uint64_t    i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        p_gen->p_discard(p_state, param);
+    }
+    return iterations;
+}
+
+/* Whether the generator has the functions needed for the operation. */
+static bool bench_op_supported(const BenchGenerator_t * p_gen, const BenchOperation_t * p_op)
+{
+    if (p_op->p_function == bench_next)
+        return (p_gen->p_next_n != NULL);
+    if (p_op->p_function == bench_fill || p_op->p_function == bench_double || p_op->p_function == bench_double53)
+        return (p_gen->p_fill != NULL);
+    if (p_op->p_function == bench_next64)
+        return (p_gen->p_next64_n != NULL);
+    if (p_op->p_function == bench_fill64)
+        return (p_gen->p_fill64 != NULL);
+    if (p_op->p_function == bench_seed_batch)
+        return (p_gen->p_seed_batch != NULL);
+    if (p_op->p_function == bench_discard)
+        return (p_gen->p_discard != NULL);
+    if (p_op->p_function == bench_batch)
+        return (p_gen->p_batch_n != NULL);
+    if (p_op->p_function == bench_lanes)
+        return (p_gen->p_lanes_n != NULL);
+    if (p_op->p_function == bench_fill_multi)
+        return (p_gen->p_fill_multi_n != NULL);
+    return true;
+}
+
+static const BenchOperation_t bench_operations[] =
+{
+    { "next",       bench_next,         sizeof(uint32_t) },
+    { "fill",       bench_fill,         sizeof(uint32_t) },
+    { "next64",     bench_next64,       sizeof(uint64_t) },
+    { "fill64",     bench_fill64,       sizeof(uint64_t) },
+    { "batch",      bench_batch,        sizeof(uint32_t) },
+    { "lanes",      bench_lanes,        sizeof(uint32_t) },
+    { "fill_multi", bench_fill_multi,   sizeof(uint32_t) },
+    { "double",     bench_double,       sizeof(double) },
+    { "double53",   bench_double53,     sizeof(double) },
+    { "seed",       bench_seed,         0 },
+    { "seed_batch", bench_seed_batch,   0 },
+    { "mix",        bench_mix,          0 },
+    { "mix_bulk",   bench_mix_bulk,     sizeof(uint32_t) },
+    { "discard",    bench_discard,      0 },
+};
+
+/*********
+ * Measurement
+ ********/
+
+/* Time one operation. The number of iterations is first calibrated so that
+ * each run takes at least the minimum time. Then the median of the repeated
+ * runs is taken, to reduce the effect of noise from other system activity.
+ */
+static void bench_measure(BenchResult_t * p_result, const BenchOptions_t * p_options,
+                          const BenchGenerator_t * p_gen, const BenchOperation_t * p_op, uintmax_t param)
+{
+    BenchState_t        state;
+    static const uint32_t seeds[4] = { UINT32_C(2051391225), UINT32_C(3360276411), UINT32_C(2374144069), UINT32_C(1046675282) };
+    double              ns_per_value[BENCH_MAX_REPEAT];
+    double              cycles_per_value[BENCH_MAX_REPEAT];
+    uint64_t            min_time_ns = (uint64_t)p_options->min_time_ms * 1000000u;
+    uint64_t            iterations;
+    uint64_t            num_values;
+    uint64_t            start_ns;
+    uint64_t            elapsed_ns;
+    uint64_t            start_cycles;
+    uint64_t            elapsed_cycles;
+    unsigned            i;
+
+    p_gen->p_seed(&state, seeds, 4u);
+
+    /* Calibrate. This also warms up caches and the CPU clock. */
+    iterations = 1u;
+    for (;;)
+    {
+        start_ns = bench_time_ns();
+        p_op->p_function(p_gen, &state, param, iterations);
+        elapsed_ns = bench_time_ns() - start_ns;
+        if (elapsed_ns >= min_time_ns || iterations >= (UINT64_MAX / 4u))
+            break;
+        if (elapsed_ns < min_time_ns / 16u)
+            iterations *= 16u;
+        else
+            iterations *= 2u;
+    }
+
+    for (i = 0; i < p_options->repeat; i++)
+    {
+        start_cycles = bench_cycles();
+        start_ns = bench_time_ns();
+        num_values = p_op->p_function(p_gen, &state, param, iterations);
+        elapsed_ns = bench_time_ns() - start_ns;
+        elapsed_cycles = bench_cycles() - start_cycles;
+        ns_per_value[i] = (double)elapsed_ns / (double)num_values;
+        cycles_per_value[i] = (double)elapsed_cycles / (double)num_values;
+    }
+
+    p_result->ns_per_value = bench_median(ns_per_value, p_options->repeat);
+    p_result->cycles_per_value = bench_median(cycles_per_value, p_options->repeat);
+    p_result->gb_per_s = 0;
+    p_result->baseline_ratio = 0;
+    if (p_op->bytes_per_value != 0 && p_result->ns_per_value > 0)
+        p_result->gb_per_s = p_op->bytes_per_value / p_result->ns_per_value;
+}
+
+/*********
+ * Baseline
+ ********/
+
+/* Read a baseline file, in the CSV format output by bench_print_result().
+ * Only the first four fields are used. Lines that can't be parsed, such as
+ * the header line, are skipped.
+ */
+static bool bench_load_baseline(const char * p_filename)
+{
+    FILE              * p_file;
+    char                line[256];
+    BenchBaseline_t   * p_baseline;
+
+    p_file = fopen(p_filename, "r");
+    if (p_file == NULL)
+        return false;
+    bench_num_baseline = 0;
+    while (fgets(line, sizeof(line), p_file) != NULL && bench_num_baseline < BENCH_MAX_BASELINE)
+    {
+        p_baseline = &bench_baseline[bench_num_baseline];
+        if (sscanf(line, "%15[^,],%15[^,],%"SCNuMAX",%lf", p_baseline->generator, p_baseline->operation,
+                   &p_baseline->n, &p_baseline->ns_per_value) == 4 &&
+            p_baseline->ns_per_value > 0)
+        {
+            bench_num_baseline++;
+        }
+    }
+    fclose(p_file);
+    return true;
+}
+
+static const BenchBaseline_t * bench_find_baseline(const char * p_gen_name, const char * p_op_name, uintmax_t param)
+{
+    size_t      i;
+
+    for (i = 0; i < bench_num_baseline; i++)
+    {
+        if (strcmp(bench_baseline[i].generator, p_gen_name) == 0 &&
+            strcmp(bench_baseline[i].operation, p_op_name) == 0 &&
+            bench_baseline[i].n == param)
+        {
+            return &bench_baseline[i];
+        }
+    }
+    return NULL;
+}
+
+static bool bench_pin_cpu(int cpu)
+{
+#ifdef HAVE_SCHED_SETAFFINITY
+    cpu_set_t   cpu_set;
+
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    return (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/*********
+ * Output
+ ********/
+
+static void bench_print_header(const BenchOptions_t * p_options)
+{
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_CSV:
+            printf("generator,operation,n,ns_per_value,cycles_per_value,gb_per_s%s\n",
+                   (p_options->p_baseline_file != NULL) ? ",baseline_ratio" : "");
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("{\n  \"cycle_counter\": \"%s\",\n  \"repeat\": %u,\n  \"results\": [", bench_cycles_source(), p_options->repeat);
+            break;
+        case BENCH_FORMAT_TEXT:
+        default:
+            printf("Cycle counter: %s. Median of %u runs.\n\n", bench_cycles_source(), p_options->repeat);
+            printf("%-10s %-10s %20s %12s %12s %10s", "generator", "operation", "n", "ns/value", "cycles/value", "GB/s");
+            if (p_options->p_baseline_file != NULL)
+                printf(" %10s", "/baseline");
+            printf("\n");
+            break;
+    }
+}
+
+static void bench_print_result(const BenchOptions_t * p_options, const char * p_gen_name, const char * p_op_name,
+                               uintmax_t param, const BenchResult_t * p_result, bool first)
+{
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_CSV:
+            printf("%s,%s,%"PRIuMAX",%.4f,%.4f,%.4f", p_gen_name, p_op_name, param,
+                   p_result->ns_per_value, p_result->cycles_per_value, p_result->gb_per_s);
+            if (p_options->p_baseline_file != NULL)
+                printf(",%.4f", p_result->baseline_ratio);
+            printf("\n");
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("%s\n    {\"generator\": \"%s\", \"operation\": \"%s\", \"n\": %"PRIuMAX", "
+                   "\"ns_per_value\": %.4f, \"cycles_per_value\": %.4f, \"gb_per_s\": %.4f",
+                   first ? "" : ",", p_gen_name, p_op_name, param,
+                   p_result->ns_per_value, p_result->cycles_per_value, p_result->gb_per_s);
+            if (p_options->p_baseline_file != NULL)
+                printf(", \"baseline_ratio\": %.4f", p_result->baseline_ratio);
+            printf("}");
+            break;
+        case BENCH_FORMAT_TEXT:
+        default:
+            printf("%-10s %-10s ", p_gen_name, p_op_name);
+            if (param != 0)
+                printf("%20"PRIuMAX" ", param);
+            else
+                printf("%20s ", "-");
+            printf("%12.3f %12.2f ", p_result->ns_per_value, p_result->cycles_per_value);
+            if (p_result->gb_per_s != 0)
+                printf("%10.3f", p_result->gb_per_s);
+            else
+                printf("%10s", "-");
+            if (p_result->baseline_ratio != 0)
+                printf(" %9.2fx", p_result->baseline_ratio);
+            else if (p_options->p_baseline_file != NULL)
+                printf(" %10s", "-");
+            printf("\n");
+            break;
+    }
+    fflush(stdout);
+}
+
+static void bench_print_footer(const BenchOptions_t * p_options)
+{
+    if (p_options->format == BENCH_FORMAT_JSON)
+        printf("\n  ]\n}\n");
+}
+
+/*********
+ * Discard sweep
+ ********/
+
+static void bench_sweep_print_header(const BenchOptions_t * p_options)
+{
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_CSV:
+            printf("generator,kind,n,discard_ns,next_loop_ns\n");
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("{\n  \"cycle_counter\": \"%s\",\n  \"repeat\": %u,\n  \"generators\": [", bench_cycles_source(), p_options->repeat);
+            break;
+        case BENCH_FORMAT_TEXT:
+        default:
+            printf("Median of %u runs.\n", p_options->repeat);
+            break;
+    }
+}
+
+static void bench_sweep_print_footer(const BenchOptions_t * p_options)
+{
+    if (p_options->format == BENCH_FORMAT_JSON)
+        printf("\n  ]\n}\n");
+}
+
+static void bench_sweep_print_point(const BenchOptions_t * p_options, const char * p_gen_name, const char * p_kind,
+                                    uintmax_t n, double discard_ns, double next_loop_ns, bool first)
+{
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_CSV:
+            printf("%s,%s,%"PRIuMAX",%.4f,%.4f\n", p_gen_name, p_kind, n, discard_ns, next_loop_ns);
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("%s\n        {\"n\": %"PRIuMAX", \"discard_ns\": %.4f, \"next_loop_ns\": %.4f}",
+                   first ? "" : ",", n, discard_ns, next_loop_ns);
+            break;
+        case BENCH_FORMAT_TEXT:
+        default:
+            printf("%20"PRIuMAX" %14.1f %14.4g %10.3g %s\n", n, discard_ns, next_loop_ns, discard_ns / next_loop_ns,
+                   (discard_ns < next_loop_ns) ? "discard" : "next");
+            break;
+    }
+    fflush(stdout);
+}
+
+/* Time discard(n) for a range of n, against n calls of next(), and find the
+ * crossover point.
+ */
+static void bench_discard_sweep(const BenchOptions_t * p_options, const BenchGenerator_t * p_gen, bool first)
+{
+    static const BenchOperation_t   next_op = { "next", bench_next, sizeof(uint32_t) };
+    static const BenchOperation_t   next64_op = { "next64", bench_next64, sizeof(uint64_t) };
+    static const BenchOperation_t   discard_op = { "discard", bench_discard, 0 };
+    BenchResult_t       result;
+    double              next_ns;
+    double              discard_ns;
+    uintmax_t           n;
+    uintmax_t           low;
+    uintmax_t           high;
+    uintmax_t           crossover = 0;
+    double              crossover_discard_ns = 0;
+    unsigned            k;
+
+    /* For a generator with only 64-bit output, one step is next64(). */
+    bench_measure(&result, p_options, p_gen, (p_gen->p_next_n != NULL) ? &next_op : &next64_op, 0);
+    next_ns = result.ns_per_value;
+
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_JSON:
+            printf("%s\n    {\"generator\": \"%s\", \"next_ns\": %.4f, \"sweep\": [", first ? "" : ",", p_gen->p_name, next_ns);
+            break;
+        case BENCH_FORMAT_TEXT:
+            printf("\n%s: next() %.3f ns\n", p_gen->p_name, next_ns);
+            printf("%20s %14s %14s %10s %s\n", "n", "discard ns", "n x next ns", "ratio", "faster");
+            break;
+        default:
+            break;
+    }
+
+    for (k = 0; k <= sizeof(uintmax_t) * 8u; k++)
+    {
+        n = (k < sizeof(uintmax_t) * 8u) ? ((uintmax_t)1u << k) : UINTMAX_MAX;
+        bench_measure(&result, p_options, p_gen, &discard_op, n);
+        discard_ns = result.ns_per_value;
+        bench_sweep_print_point(p_options, p_gen->p_name, "sweep", n, discard_ns, next_ns * (double)n, (k == 0));
+        if (crossover == 0 && discard_ns < next_ns * (double)n)
+        {
+            crossover = n;
+            crossover_discard_ns = discard_ns;
+        }
+    }
+
+    /* Bisect between the previous power of 2 (where next() was faster) and
+     * the first power of 2 where discard() was faster. */
+    if (crossover > 1u)
+    {
+        low = crossover / 2u;
+        high = crossover;
+        while (high - low > 1u && high - low > low / BENCH_CROSSOVER_PRECISION)
+        {
+            n = low + (high - low) / 2u;
+            bench_measure(&result, p_options, p_gen, &discard_op, n);
+            if (result.ns_per_value < next_ns * (double)n)
+            {
+                high = n;
+                crossover_discard_ns = result.ns_per_value;
+            }
+            else
+            {
+                low = n;
+            }
+        }
+        crossover = high;
+    }
+
+    switch (p_options->format)
+    {
+        case BENCH_FORMAT_CSV:
+            bench_sweep_print_point(p_options, p_gen->p_name, "crossover", crossover, crossover_discard_ns, next_ns * (double)crossover, false);
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("\n      ], \"crossover\": %"PRIuMAX"}", crossover);
+            break;
+        case BENCH_FORMAT_TEXT:
+        default:
+            if (crossover != 0)
+                printf("%s: discard(n) is faster than n x next() for n >= %"PRIuMAX" (approx)\n", p_gen->p_name, crossover);
+            else
+                printf("%s: discard(n) is never faster than n x next()\n", p_gen->p_name);
+            break;
+    }
+    fflush(stdout);
+}
+
+/* Parse an option's value as a decimal number from 0 to 'max'. Returns false
+ * if it isn't a valid number in range. */
+static bool bench_parse_unsigned(const char * p_str, unsigned long max, unsigned long * p_value)
+{
+    char          * p_end;
+    unsigned long   value;
+
+    if (*p_str < '0' || *p_str > '9')
+        return false;
+    errno = 0;
+    value = strtoul(p_str, &p_end, 10);
+    if (errno != 0 || *p_end != '\0' || value > max)
+        return false;
+    *p_value = value;
+    return true;
+}
+
+/* Parse an option's value as a finite number greater than 0. */
+static bool bench_parse_positive(const char * p_str, double * p_value)
+{
+    char      * p_end;
+    double      value;
+
+    errno = 0;
+    value = strtod(p_str, &p_end);
+    if (p_end == p_str || errno != 0 || *p_end != '\0' || !isfinite(value) || value <= 0)
+        return false;
+    *p_value = value;
+    return true;
+}
+
+static bool bench_parse_options(BenchOptions_t * p_options, int argc, char * argv[])
+{
+    int         i;
+    const char * p_arg;
+    unsigned long value;
+    bool        ok = true;
+
+    p_options->format = BENCH_FORMAT_TEXT;
+    p_options->repeat = BENCH_DEFAULT_REPEAT;
+    p_options->min_time_ms = BENCH_DEFAULT_MIN_TIME_MS;
+    p_options->p_generator = NULL;
+    p_options->p_operation = NULL;
+    p_options->p_baseline_file = NULL;
+    p_options->threshold = BENCH_DEFAULT_THRESHOLD;
+    p_options->cpu = -1;
+    p_options->discard_sweep = false;
+
+    for (i = 1; i < argc; i++)
+    {
+        p_arg = argv[i];
+        if (strcmp(p_arg, "--format=text") == 0)
+            p_options->format = BENCH_FORMAT_TEXT;
+        else if (strcmp(p_arg, "--format=csv") == 0)
+            p_options->format = BENCH_FORMAT_CSV;
+        else if (strcmp(p_arg, "--format=json") == 0)
+            p_options->format = BENCH_FORMAT_JSON;
+        else if (strncmp(p_arg, "--repeat=", 9u) == 0)
+        {
+            ok = bench_parse_unsigned(p_arg + 9u, BENCH_MAX_REPEAT, &value) && value >= 1u;
+            p_options->repeat = (unsigned)value;
+        }
+        else if (strncmp(p_arg, "--min-time-ms=", 14u) == 0)
+        {
+            ok = bench_parse_unsigned(p_arg + 14u, UINT_MAX, &value);
+            p_options->min_time_ms = (unsigned)value;
+        }
+        else if (strncmp(p_arg, "--generator=", 12u) == 0)
+            p_options->p_generator = p_arg + 12u;
+        else if (strncmp(p_arg, "--operation=", 12u) == 0)
+            p_options->p_operation = p_arg + 12u;
+        else if (strncmp(p_arg, "--baseline=", 11u) == 0)
+            p_options->p_baseline_file = p_arg + 11u;
+        else if (strncmp(p_arg, "--threshold=", 12u) == 0)
+            ok = bench_parse_positive(p_arg + 12u, &p_options->threshold);
+        else if (strcmp(p_arg, "--discard-sweep") == 0)
+            p_options->discard_sweep = true;
+        else if (strncmp(p_arg, "--cpu=", 6u) == 0)
+        {
+            ok = bench_parse_unsigned(p_arg + 6u, INT_MAX, &value);
+            p_options->cpu = (int)value;
+        }
+        else
+            ok = false;
+        if (!ok)
+            return false;
+    }
+    return true;
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    BenchOptions_t          options;
+    BenchResult_t           result;
+    BenchResult_t           retry_result;
+    const BenchGenerator_t * p_gen;
+    const BenchOperation_t * p_op;
+    size_t                  i;
+    size_t                  j;
+    size_t                  k;
+    size_t                  num_params;
+    size_t                  batch_buf_size;
+    uintmax_t               param;
+    const BenchBaseline_t * p_baseline;
+    double                  max_ratio;
+    unsigned                num_slower = 0;
+    unsigned                retry;
+    bool                    first = true;
+
+    if (!bench_parse_options(&options, argc, argv))
+    {
+        fprintf(stderr, "Usage: %s [--format=text|csv|json] [--repeat=N] [--min-time-ms=N] [--generator=NAME] [--operation=NAME]"
+                        " [--cpu=N] [--baseline=FILE] [--threshold=PERCENT] [--discard-sweep]\n", argv[0]);
+        return 2;
+    }
+    if (options.p_baseline_file != NULL && !bench_load_baseline(options.p_baseline_file))
+    {
+        fprintf(stderr, "%s: can't read baseline file '%s'\n", argv[0], options.p_baseline_file);
+        return 2;
+    }
+    if (options.cpu >= 0 && !bench_pin_cpu(options.cpu))
+    {
+        fprintf(stderr, "%s: can't pin to CPU %d, continuing unpinned\n", argv[0], options.cpu);
+    }
+    max_ratio = 1.0 + options.threshold / 100.0;
+
+    /* Big enough for a batch of any of the generators with a batch API, and
+     * for BENCH_SEED_BATCH_NUM of any generator's state structures. */
+    batch_buf_size = simplerandom_kiss_batch_buf_size(BENCH_BATCH_NUM);
+    if (batch_buf_size < BENCH_SEED_BATCH_NUM * sizeof(BenchState_t))
+        batch_buf_size = BENCH_SEED_BATCH_NUM * sizeof(BenchState_t);
+    p_bench_batch_buf = malloc(batch_buf_size);
+    if (p_bench_batch_buf == NULL)
+        return 1;
+    memset(p_bench_batch_buf, 0x5A, batch_buf_size);
+    for (i = 0; i < BENCH_FILL_SIZE; i++)
+    {
+        bench_buf[i] = (uint32_t)i;
+    }
+
+    bench_cycles_init();
+    if (options.discard_sweep)
+    {
+        bench_sweep_print_header(&options);
+        for (i = 0; i < sizeof(bench_generators) / sizeof(bench_generators[0]); i++)
+        {
+            p_gen = &bench_generators[i];
+            if (options.p_generator != NULL && strcmp(options.p_generator, p_gen->p_name) != 0)
+                continue;
+            if (p_gen->p_discard == NULL)
+                continue;
+            bench_discard_sweep(&options, p_gen, first);
+            first = false;
+        }
+        bench_sweep_print_footer(&options);
+        free(p_bench_batch_buf);
+        return 0;
+    }
+
+    bench_print_header(&options);
+    for (i = 0; i < sizeof(bench_generators) / sizeof(bench_generators[0]); i++)
+    {
+        p_gen = &bench_generators[i];
+        if (options.p_generator != NULL && strcmp(options.p_generator, p_gen->p_name) != 0)
+            continue;
+        for (j = 0; j < sizeof(bench_operations) / sizeof(bench_operations[0]); j++)
+        {
+            p_op = &bench_operations[j];
+            if (options.p_operation != NULL && strcmp(options.p_operation, p_op->p_name) != 0)
+                continue;
+            if (!bench_op_supported(p_gen, p_op))
+                continue;
+            num_params = (p_op->p_function == bench_discard) ? sizeof(bench_discard_n) / sizeof(bench_discard_n[0]) : 1u;
+            for (k = 0; k < num_params; k++)
+            {
+                param = (p_op->p_function == bench_discard) ? bench_discard_n[k] : 0;
+                bench_measure(&result, &options, p_gen, p_op, param);
+                p_baseline = bench_find_baseline(p_gen->p_name, p_op->p_name, param);
+                if (p_baseline != NULL)
+                {
+                    result.baseline_ratio = result.ns_per_value / p_baseline->ns_per_value;
+                    /* Measure again, in case it was a transient disturbance.
+                     * Noise only ever makes it slower, so keep the fastest. */
+                    for (retry = 0; retry < BENCH_MAX_RETRIES && result.baseline_ratio > max_ratio; retry++)
+                    {
+                        bench_measure(&retry_result, &options, p_gen, p_op, param);
+                        if (retry_result.ns_per_value < result.ns_per_value)
+                            result = retry_result;
+                        result.baseline_ratio = result.ns_per_value / p_baseline->ns_per_value;
+                    }
+                }
+                bench_print_result(&options, p_gen->p_name, p_op->p_name, param, &result, first);
+                first = false;
+                if (result.baseline_ratio > max_ratio)
+                {
+                    fprintf(stderr, "SLOWER: %s %s %"PRIuMAX": %.3f ns/value, baseline %.3f ns/value (%.2fx)\n",
+                            p_gen->p_name, p_op->p_name, param, result.ns_per_value, p_baseline->ns_per_value, result.baseline_ratio);
+                    num_slower++;
+                }
+            }
+        }
+    }
+    bench_print_footer(&options);
+
+    free(p_bench_batch_buf);
+    if (num_slower != 0)
+    {
+        fprintf(stderr, "%u result(s) slower than baseline by more than %.0f%%\n", num_slower, options.threshold);
+        return 1;
+    }
+    return 0;
+}
@@ -1 +1 @@
-gcc test_testu01.c ../simplerandom.c -I".." -o test_testu01 -ltestu01 -lprobdist -lmylib -lwsock32
\ No newline at end of file
+gcc test_testu01.c ../simplerandom.c ../simplerandom-hash.c ../bitcolumnmatrix.c -I".." -o test_testu01 -ltestu01 -lprobdist -lmylib -lwsock32
\ No newline at end of file
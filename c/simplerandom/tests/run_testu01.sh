@@ -0,0 +1,231 @@
+#!/bin/sh
+#
+# Run the TestU01 batteries for all the generators in parallel, using the
+# test_testu01 program (see build_test_testu01), and make a summary of the
+# results like results/test_testu01_summary.txt.
+#
+# Each generator/battery combination is run as a separate process. BigCrush,
+# which takes hours for each generator, is also split into several processes,
+# each running a subset of its tests. The tests are assigned round-robin, so
+# the long-running tests are spread over the parts. Up to JOBS processes are
+# run at once; BigCrush jobs are started first, since they take the longest.
+# Each part is run with its own seeds, derived from the part number by
+# test_testu01, so the parts don't all test the same start of one sequence.
+# The seeds of each part are listed in the summary.
+#
+# Usage:
+#     run_testu01.sh [-j JOBS] [-g "GENERATORS"] [-b "BATTERIES"]
+#                    [-s BIGCRUSH_PARTS] [-o OUTPUT_DIR] [-p PROGRAM]
+#
+# Defaults:
+#     JOBS              number of CPUs
+#     GENERATORS        "cong shr3 mwc1 mwc2 mwc64 kiss kiss2 lfsr113 lfsr88 lfib4 swb cmwc4096"
+#     BATTERIES         "SmallCrush Crush BigCrush"
+#     BIGCRUSH_PARTS    JOBS
+#     OUTPUT_DIR        testu01_results
+#     PROGRAM           ./test_testu01
+#
+# The full output of each process is written to OUTPUT_DIR, as
+# test_testu01_<battery>_<generator>.txt, or
+# test_testu01_<battery>_<generator>_part<N>.txt for the BigCrush parts. The
+# summary is written to OUTPUT_DIR/test_testu01_summary.txt.
+
+BIGCRUSH_NUM_TESTS=106
+
+# Run one job. This is invoked by xargs, as: run_testu01.sh --run-one
+# PROGRAM OUTPUT_DIR GENERATOR BATTERY PART TESTS
+if [ "$1" = "--run-one" ]; then
+    program=$2
+    output_dir=$3
+    generator=$4
+    battery=$5
+    part=$6
+    tests=$7
+    battery_lower=$(echo "$battery" | tr 'A-Z' 'a-z')
+    if [ "$part" = "0" ]; then
+        output="$output_dir/test_testu01_${battery_lower}_${generator}.txt"
+        "$program" "$generator" "$battery" > "$output" 2>&1
+    else
+        output="$output_dir/test_testu01_${battery_lower}_${generator}_part${part}.txt"
+        "$program" -p "$part" "$generator" "$battery" "$tests" > "$output" 2>&1
+    fi
+    status=$?
+    if [ "$part" = "0" ]; then
+        echo "$generator $battery finished (status $status)" >&2
+    else
+        echo "$generator $battery part $part finished (status $status)" >&2
+    fi
+    exit $status
+fi
+
+JOBS=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+GENERATORS="cong shr3 mwc1 mwc2 mwc64 kiss kiss2 lfsr113 lfsr88 lfib4 swb cmwc4096"
+BATTERIES="SmallCrush Crush BigCrush"
+BIGCRUSH_PARTS=
+OUTPUT_DIR=testu01_results
+PROGRAM=./test_testu01
+
+while getopts "j:g:b:s:o:p:" option; do
+    case $option in
+        j) JOBS=$OPTARG ;;
+        g) GENERATORS=$OPTARG ;;
+        b) BATTERIES=$OPTARG ;;
+        s) BIGCRUSH_PARTS=$OPTARG ;;
+        o) OUTPUT_DIR=$OPTARG ;;
+        p) PROGRAM=$OPTARG ;;
+        *) sed -n '16,18p' "$0" >&2; exit 2 ;;
+    esac
+done
+: "${BIGCRUSH_PARTS:=$JOBS}"
+if [ "$BIGCRUSH_PARTS" -gt "$BIGCRUSH_NUM_TESTS" ]; then
+    BIGCRUSH_PARTS=$BIGCRUSH_NUM_TESTS
+fi
+
+if [ ! -x "$PROGRAM" ]; then
+    echo "$0: $PROGRAM not found. Build it with build_test_testu01." >&2
+    exit 1
+fi
+mkdir -p "$OUTPUT_DIR" || exit 1
+
+# List the jobs, one per line: GENERATOR BATTERY PART TESTS
+# PART is 0 for a whole battery. TESTS is a comma-separated list of test
+# numbers, or "-" for a whole battery.
+list_jobs()
+{
+    for battery in BigCrush Crush SmallCrush; do
+        case " $BATTERIES " in
+            *" $battery "*) ;;
+            *) continue ;;
+        esac
+        for generator in $GENERATORS; do
+            if [ "$battery" = "BigCrush" ] && [ "$BIGCRUSH_PARTS" -gt 1 ]; then
+                part=1
+                while [ "$part" -le "$BIGCRUSH_PARTS" ]; do
+                    tests=$(seq -s, "$part" "$BIGCRUSH_PARTS" "$BIGCRUSH_NUM_TESTS")
+                    echo "$generator $battery $part $tests"
+                    part=$((part + 1))
+                done
+            else
+                echo "$generator $battery 0 -"
+            fi
+        done
+    done
+}
+
+# Remove any outputs of a previous run, which may have been split differently.
+for generator in $GENERATORS; do
+    for battery in $BATTERIES; do
+        battery_lower=$(echo "$battery" | tr 'A-Z' 'a-z')
+        rm -f "$OUTPUT_DIR/test_testu01_${battery_lower}_${generator}.txt" \
+              "$OUTPUT_DIR/test_testu01_${battery_lower}_${generator}"_part*.txt
+    done
+done
+
+list_jobs | xargs -P "$JOBS" -L 1 "$0" --run-one "$PROGRAM" "$OUTPUT_DIR"
+run_status=$?
+
+# Print the summary results of one battery, from the output of a whole
+# battery, or merged from the outputs of its parts. For merged results, the
+# numbers of statistics and the CPU times are added up, and the failed tests
+# are listed in test number order.
+summarise_battery()
+{
+    awk '
+        function parse_time(t,    parts)
+        {
+            split(t, parts, ":")
+            return parts[1] * 3600 + parts[2] * 60 + parts[3]
+        }
+        function format_time(s,    h, m)
+        {
+            h = int(s / 3600)
+            m = int((s - h * 3600) / 60)
+            return sprintf("%02d:%02d:%05.2f", h, m, s - h * 3600 - m * 60)
+        }
+        /^========= Summary results of/ { in_summary = 1; title = $0; next }
+        !in_summary { next }
+        /^ Version:/ { version = $0; next }
+        /^ Generator:/ { generator = $0; next }
+        /^ Number of statistics:/ { num_statistics += $NF; next }
+        /^ Total CPU time:/ { cpu_time += parse_time($NF); next }
+        /^ -----/ { in_table = !in_table; next }
+        in_table {
+            num_failed++
+            failed_key[num_failed] = sprintf("%05d %05d", $1, num_failed)
+            failed[failed_key[num_failed]] = $0
+            next
+        }
+        /^ All/ { in_summary = 0; num_files++ }
+        END {
+            if (num_files == 0)
+            {
+                print "========= No summary results (not finished?) ========="
+                exit
+            }
+            print title
+            print ""
+            print version
+            print generator
+            printf(" Number of statistics:  %d\n", num_statistics)
+            printf(" Total CPU time:   %s\n", format_time(cpu_time))
+            if (num_failed == 0)
+            {
+                print ""
+                print " All tests were passed"
+                exit
+            }
+            print " The following tests gave p-values outside [0.001, 0.9990]:"
+            print " (eps  means a value < 1.0e-300):"
+            print " (eps1 means a value < 1.0e-015):"
+            print ""
+            print "       Test                          p-value"
+            print " ----------------------------------------------"
+            # Sort by test number (insertion sort; the lists are short).
+            for (i = 2; i <= num_failed; i++)
+            {
+                key = failed_key[i]
+                for (j = i - 1; j >= 1 && failed_key[j] > key; j--)
+                    failed_key[j + 1] = failed_key[j]
+                failed_key[j + 1] = key
+            }
+            for (i = 1; i <= num_failed; i++)
+                print failed[failed_key[i]]
+            print " ----------------------------------------------"
+            print " All other tests were passed"
+        }
+    ' "$@"
+}
+
+summary="$OUTPUT_DIR/test_testu01_summary.txt"
+{
+    for generator in $GENERATORS; do
+        case $generator in
+            cong) name=Cong ;;
+            *) name=$(echo "$generator" | tr 'a-z' 'A-Z') ;;
+        esac
+        echo "== $name =="
+        echo
+        for battery in SmallCrush Crush BigCrush; do
+            case " $BATTERIES " in
+                *" $battery "*) ;;
+                *) continue ;;
+            esac
+            battery_lower=$(echo "$battery" | tr 'A-Z' 'a-z')
+            if [ -f "$OUTPUT_DIR/test_testu01_${battery_lower}_${generator}.txt" ]; then
+                set -- "$OUTPUT_DIR/test_testu01_${battery_lower}_${generator}.txt"
+            else
+                set -- "$OUTPUT_DIR/test_testu01_${battery_lower}_${generator}"_part*.txt
+            fi
+            summarise_battery "$@"
+            echo
+            # The seeds used, one line per part, in part order.
+            grep -h '^Seeds' "$@" 2>/dev/null | sort -t ' ' -k 3n | sed 's/^/ /'
+            echo
+        done
+        echo
+        echo
+    done
+} > "$summary"
+
+echo "Summary written to $summary" >&2
+exit $run_status
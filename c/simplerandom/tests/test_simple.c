@@ -15,6 +15,8 @@ static int test_multi(void)
     SimpleRandomKISS_t      kiss;
     SimpleRandomMWC64_t     mwc64;
     SimpleRandomKISS2_t     kiss2;
+    SimpleRandomKISS64_t    kiss64;
+    uint64_t                k64;
     SimpleRandomLFSR113_t   lfsr113;
     SimpleRandomLFSR88_t    lfsr88;
     uint32_t                i;
@@ -80,6 +82,14 @@ static int test_multi(void)
     }
     printf("    KISS2       %"PRIu32"\n", k - UINT32_C(1010846401));
 
+    /* KISS64 */
+    simplerandom_kiss64_seed(&kiss64, UINT64_C(123456123456123456), UINT64_C(1234567890987654321), UINT64_C(1066149217761810), UINT64_C(362436362436362436));
+    for (i = 0; i < 1000000; i++)
+    {
+        k64 = simplerandom_kiss64_next(&kiss64);
+    }
+    printf("    KISS64      %"PRIu64"\n", k64 - UINT64_C(1923458103333650010));
+
 #endif /* defined(UINT64_C) */
 
     /* LFSR113 */
@@ -102,6 +112,1434 @@ static int test_multi(void)
     return 0;
 }
 
+/* Long enough to cover the chunked fill of the linear generators: 2 whole
+ * chunks and a partial one. */
+#define TEST_FILL_LONG      (2u * 4096u + 37u)
+
+static int test_fill(void)
+{
+    SimpleRandomCong_t      cong[2];
+    SimpleRandomSHR3_t      shr3[2];
+    SimpleRandomMWC1_t      mwc1[2];
+    SimpleRandomMWC2_t      mwc2[2];
+    SimpleRandomKISS_t      kiss[2];
+#ifdef UINT64_C
+    SimpleRandomMWC64_t     mwc64[2];
+    SimpleRandomKISS2_t     kiss2[2];
+#endif
+    SimpleRandomLFSR113_t   lfsr113[2];
+    SimpleRandomLFSR88_t    lfsr88[2];
+    uint32_t                out[1000];
+    static uint32_t         long_out[TEST_FILL_LONG];
+    size_t                  i;
+    size_t                  n;
+    bool                    ok = true;
+
+    printf("Fill tests\n");
+
+    simplerandom_cong_seed(&cong[0], UINT32_C(2051391225));
+    simplerandom_shr3_seed(&shr3[0], UINT32_C(3360276411));
+    simplerandom_mwc1_seed(&mwc1[0], UINT32_C(2374144069), UINT32_C(1046675282));
+    simplerandom_mwc2_seed(&mwc2[0], UINT32_C(12345), UINT32_C(65437));
+    simplerandom_kiss_seed(&kiss[0], UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
+#ifdef UINT64_C
+    simplerandom_mwc64_seed(&mwc64[0], UINT32_C(7654321), UINT32_C(521288629));
+    simplerandom_kiss2_seed(&kiss2[0], UINT32_C(7654321), UINT32_C(521288629), UINT32_C(123456789), UINT32_C(362436000));
+#endif
+    simplerandom_lfsr113_seed(&lfsr113[0], 0, 0, 0, 0);
+    simplerandom_lfsr88_seed(&lfsr88[0], 0, 0, 0);
+    cong[1] = cong[0];
+    shr3[1] = shr3[0];
+    mwc1[1] = mwc1[0];
+    mwc2[1] = mwc2[0];
+    kiss[1] = kiss[0];
+#ifdef UINT64_C
+    mwc64[1] = mwc64[0];
+    kiss2[1] = kiss2[0];
+#endif
+    lfsr113[1] = lfsr113[0];
+    lfsr88[1] = lfsr88[0];
+
+    /* Fill, then check against next(), and that the final states match. */
+    simplerandom_cong_fill(&cong[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_cong_next(&cong[1]));
+    /* Cong fill changes method at 32 values. Check lengths around that, and
+     * each length of the final partial step. */
+    for (n = 0; n < 70u; n++)
+    {
+        simplerandom_cong_fill(&cong[0], out, n);
+        for (i = 0; i < n; i++)
+            ok = ok && (out[i] == simplerandom_cong_next(&cong[1]));
+        ok = ok && (cong[0].cong == cong[1].cong);
+    }
+    simplerandom_shr3_fill(&shr3[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_shr3_next(&shr3[1]));
+    simplerandom_mwc1_fill(&mwc1[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_mwc1_next(&mwc1[1]));
+    simplerandom_mwc2_fill(&mwc2[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_mwc2_next(&mwc2[1]));
+    simplerandom_kiss_fill(&kiss[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_kiss_next(&kiss[1]));
+#ifdef UINT64_C
+    simplerandom_mwc64_fill(&mwc64[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_mwc64_next(&mwc64[1]));
+    simplerandom_kiss2_fill(&kiss2[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_kiss2_next(&kiss2[1]));
+#endif
+    simplerandom_lfsr113_fill(&lfsr113[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_lfsr113_next(&lfsr113[1]));
+    simplerandom_lfsr88_fill(&lfsr88[0], out, 1000u);
+    for (i = 0; i < 1000u; i++)
+        ok = ok && (out[i] == simplerandom_lfsr88_next(&lfsr88[1]));
+    /* Long fills of the generators that fill in chunks. */
+    simplerandom_shr3_fill(&shr3[0], long_out, TEST_FILL_LONG);
+    for (i = 0; i < TEST_FILL_LONG; i++)
+        ok = ok && (long_out[i] == simplerandom_shr3_next(&shr3[1]));
+#ifdef UINT64_C
+    simplerandom_mwc64_fill(&mwc64[0], long_out, TEST_FILL_LONG);
+    for (i = 0; i < TEST_FILL_LONG; i++)
+        ok = ok && (long_out[i] == simplerandom_mwc64_next(&mwc64[1]));
+    simplerandom_kiss2_fill(&kiss2[0], long_out, TEST_FILL_LONG);
+    for (i = 0; i < TEST_FILL_LONG; i++)
+        ok = ok && (long_out[i] == simplerandom_kiss2_next(&kiss2[1]));
+#endif
+    simplerandom_lfsr113_fill(&lfsr113[0], long_out, TEST_FILL_LONG);
+    for (i = 0; i < TEST_FILL_LONG; i++)
+        ok = ok && (long_out[i] == simplerandom_lfsr113_next(&lfsr113[1]));
+    simplerandom_lfsr88_fill(&lfsr88[0], long_out, TEST_FILL_LONG);
+    for (i = 0; i < TEST_FILL_LONG; i++)
+        ok = ok && (long_out[i] == simplerandom_lfsr88_next(&lfsr88[1]));
+
+    ok = ok &&
+        memcmp(&cong[0], &cong[1], sizeof(cong[0])) == 0 &&
+        memcmp(&shr3[0], &shr3[1], sizeof(shr3[0])) == 0 &&
+        memcmp(&mwc1[0], &mwc1[1], sizeof(mwc1[0])) == 0 &&
+        memcmp(&mwc2[0], &mwc2[1], sizeof(mwc2[0])) == 0 &&
+        memcmp(&kiss[0], &kiss[1], sizeof(kiss[0])) == 0 &&
+#ifdef UINT64_C
+        memcmp(&mwc64[0], &mwc64[1], sizeof(mwc64[0])) == 0 &&
+        memcmp(&kiss2[0], &kiss2[1], sizeof(kiss2[0])) == 0 &&
+#endif
+        memcmp(&lfsr113[0], &lfsr113[1], sizeof(lfsr113[0])) == 0 &&
+        memcmp(&lfsr88[0], &lfsr88[1], sizeof(lfsr88[0])) == 0;
+    if (!ok)
+    {
+        printf("    fill        FAIL\n");
+        return 1;
+    }
+    printf("    fill        OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#define TEST_FILL_MULTI_NUM     7u
+#define TEST_FILL_MULTI_MAX     (4096u + 5u)
+
+static int test_fill_multi(void)
+{
+    /* Fill lengths, including one long enough for the chunked fills. */
+    static const size_t             lengths[] = { 0, 1u, 2u, 31u, 32u, 100u, TEST_FILL_MULTI_MAX };
+    static uint32_t                 seeds[4u * TEST_FILL_MULTI_NUM];
+    static SimpleRandomCong_t       cong[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomSHR3_t       shr3[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomMWC1_t       mwc1[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomMWC2_t       mwc2[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomKISS_t       kiss[2][TEST_FILL_MULTI_NUM];
+#ifdef UINT64_C
+    static SimpleRandomMWC64_t      mwc64[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomKISS2_t      kiss2[2][TEST_FILL_MULTI_NUM];
+#endif
+    static SimpleRandomLFSR113_t    lfsr113[2][TEST_FILL_MULTI_NUM];
+    static SimpleRandomLFSR88_t     lfsr88[2][TEST_FILL_MULTI_NUM];
+    static uint32_t                 out[TEST_FILL_MULTI_NUM * TEST_FILL_MULTI_MAX];
+    static uint32_t                 ref_out[TEST_FILL_MULTI_NUM * TEST_FILL_MULTI_MAX];
+    SimpleRandomCong_t      seed_gen;
+    size_t                  num_out;
+    size_t                  i;
+    size_t                  k;
+    bool                    ok = true;
+
+    printf("Fill multi tests\n");
+
+    simplerandom_cong_seed(&seed_gen, UINT32_C(2051391225));
+    for (i = 0; i < 4u * TEST_FILL_MULTI_NUM; i++)
+        seeds[i] = simplerandom_cong_next(&seed_gen);
+    simplerandom_cong_seed_batch(cong[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_shr3_seed_batch(shr3[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_mwc1_seed_batch(mwc1[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_mwc2_seed_batch(mwc2[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_kiss_seed_batch(kiss[0], seeds, TEST_FILL_MULTI_NUM);
+#ifdef UINT64_C
+    simplerandom_mwc64_seed_batch(mwc64[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_kiss2_seed_batch(kiss2[0], seeds, TEST_FILL_MULTI_NUM);
+#endif
+    simplerandom_lfsr113_seed_batch(lfsr113[0], seeds, TEST_FILL_MULTI_NUM);
+    simplerandom_lfsr88_seed_batch(lfsr88[0], seeds, TEST_FILL_MULTI_NUM);
+    memcpy(cong[1], cong[0], sizeof(cong[0]));
+    memcpy(shr3[1], shr3[0], sizeof(shr3[0]));
+    memcpy(mwc1[1], mwc1[0], sizeof(mwc1[0]));
+    memcpy(mwc2[1], mwc2[0], sizeof(mwc2[0]));
+    memcpy(kiss[1], kiss[0], sizeof(kiss[0]));
+#ifdef UINT64_C
+    memcpy(mwc64[1], mwc64[0], sizeof(mwc64[0]));
+    memcpy(kiss2[1], kiss2[0], sizeof(kiss2[0]));
+#endif
+    memcpy(lfsr113[1], lfsr113[0], sizeof(lfsr113[0]));
+    memcpy(lfsr88[1], lfsr88[0], sizeof(lfsr88[0]));
+
+    /* Check against simplerandom_zzz_fill() for each generator, and that the
+     * final states match. TEST_FILL_MULTI_NUM isn't a multiple of the number
+     * of generators stepped together, so the remainder is covered too. */
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+    {
+        num_out = lengths[i];
+        simplerandom_cong_fill_multi(cong[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_cong_fill(&cong[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(cong[0], cong[1], sizeof(cong[0])) == 0;
+        simplerandom_shr3_fill_multi(shr3[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_shr3_fill(&shr3[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(shr3[0], shr3[1], sizeof(shr3[0])) == 0;
+        simplerandom_mwc1_fill_multi(mwc1[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_mwc1_fill(&mwc1[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(mwc1[0], mwc1[1], sizeof(mwc1[0])) == 0;
+        simplerandom_mwc2_fill_multi(mwc2[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_mwc2_fill(&mwc2[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(mwc2[0], mwc2[1], sizeof(mwc2[0])) == 0;
+        simplerandom_kiss_fill_multi(kiss[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_kiss_fill(&kiss[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(kiss[0], kiss[1], sizeof(kiss[0])) == 0;
+#ifdef UINT64_C
+        simplerandom_mwc64_fill_multi(mwc64[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_mwc64_fill(&mwc64[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(mwc64[0], mwc64[1], sizeof(mwc64[0])) == 0;
+        simplerandom_kiss2_fill_multi(kiss2[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_kiss2_fill(&kiss2[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(kiss2[0], kiss2[1], sizeof(kiss2[0])) == 0;
+#endif
+        simplerandom_lfsr113_fill_multi(lfsr113[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_lfsr113_fill(&lfsr113[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(lfsr113[0], lfsr113[1], sizeof(lfsr113[0])) == 0;
+        simplerandom_lfsr88_fill_multi(lfsr88[0], TEST_FILL_MULTI_NUM, out, num_out);
+        for (k = 0; k < TEST_FILL_MULTI_NUM; k++)
+            simplerandom_lfsr88_fill(&lfsr88[1][k], &ref_out[k * num_out], num_out);
+        ok = ok &&
+            memcmp(out, ref_out, TEST_FILL_MULTI_NUM * num_out * sizeof(out[0])) == 0 &&
+            memcmp(lfsr88[0], lfsr88[1], sizeof(lfsr88[0])) == 0;
+    }
+    if (!ok)
+    {
+        printf("    fill_multi  FAIL\n");
+        return 1;
+    }
+    printf("    fill_multi  OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+/* Checks shared by the KISS64, CMWC4096 and lagged-Fibonacci tests. SEED
+ * calls seed() on p_state with the words of seeds[], in seed_array() order.
+ *
+ * zzz_test_fill() checks that fill() is the same as next(), for each of the
+ * fill lengths, continuing on from the state at p_state.
+ *
+ * zzz_test_seed_mix() checks that seed_array() is the same as SEED, and that
+ * mix_bulk() is the same as mixing in num_seeds() words of hash output.
+ */
+#define TEST_GENERATOR_FILL_MAX     9000u
+
+#define TEST_GENERATOR_FUNCTIONS(zzz, state_t, out_t, num_seeds, SEED)     \
+static bool zzz##_test_fill(state_t * p_state, const size_t * p_lengths, size_t num_lengths) \
+{                                                                           \
+    static out_t    out[TEST_GENERATOR_FILL_MAX];                           \
+    static state_t  next_state;                                             \
+    size_t          i;                                                      \
+    size_t          j;                                                      \
+    bool            ok = true;                                              \
+                                                                            \
+    next_state = *p_state;                                                  \
+    for (j = 0; j < num_lengths; j++)                                       \
+    {                                                                       \
+        if (p_lengths[j] > TEST_GENERATOR_FILL_MAX)                         \
+            return false;                                                   \
+        simplerandom_##zzz##_fill(p_state, out, p_lengths[j]);              \
+        for (i = 0; i < p_lengths[j]; i++)                                  \
+            ok = ok && (out[i] == simplerandom_##zzz##_next(&next_state));  \
+        ok = ok && memcmp(p_state, &next_state, sizeof(next_state)) == 0;   \
+    }                                                                       \
+    return ok;                                                              \
+}                                                                           \
+                                                                            \
+static bool zzz##_test_seed_mix(void)                                       \
+{                                                                           \
+    static state_t          state[2];                                       \
+    state_t               * p_state = &state[0];                            \
+    uint32_t                seeds[num_seeds];                               \
+    uint32_t                hash_out[num_seeds];                            \
+    SimpleRandomMixHash_t   hash;                                           \
+    size_t                  j;                                              \
+    bool                    ok = true;                                      \
+                                                                            \
+    for (j = 0; j < (num_seeds); j++)                                       \
+        seeds[j] = (uint32_t)(UINT32_C(0x9E3779B9) * (j + 1u));             \
+    SEED;                                                                   \
+    ok = ok && simplerandom_##zzz##_seed_array(&state[1], seeds, (num_seeds), false) == (num_seeds); \
+    ok = ok && memcmp(&state[0], &state[1], sizeof(state[0])) == 0;         \
+                                                                            \
+    simplerandom_##zzz##_mix_bulk(&state[0], seeds, (num_seeds));           \
+    ok = ok && memcmp(&state[0], &state[1], sizeof(state[0])) != 0;         \
+    simplerandom_mix_hash_init(&hash);                                      \
+    simplerandom_mix_hash_update(&hash, seeds, (num_seeds));                \
+    simplerandom_mix_hash_final(&hash, hash_out, simplerandom_##zzz##_num_seeds(&state[1])); \
+    simplerandom_##zzz##_mix(&state[1], hash_out, simplerandom_##zzz##_num_seeds(&state[1])); \
+    ok = ok && memcmp(&state[0], &state[1], sizeof(state[0])) == 0;         \
+    return ok;                                                              \
+}
+
+#ifdef UINT64_C
+TEST_GENERATOR_FUNCTIONS(kiss64, SimpleRandomKISS64_t, uint64_t, SIMPLERANDOM_KISS64_NUM_SEEDS,
+                         simplerandom_kiss64_seed(p_state,
+                                                  ((uint64_t)seeds[1] << 32u) | seeds[0], ((uint64_t)seeds[3] << 32u) | seeds[2],
+                                                  ((uint64_t)seeds[5] << 32u) | seeds[4], ((uint64_t)seeds[7] << 32u) | seeds[6]))
+TEST_GENERATOR_FUNCTIONS(cmwc4096, SimpleRandomCMWC4096_t, uint32_t, SIMPLERANDOM_CMWC4096_NUM_SEEDS,
+                         simplerandom_cmwc4096_seed(p_state, seeds[0], seeds[1], seeds[2], seeds[3]))
+#endif
+TEST_GENERATOR_FUNCTIONS(lfib4, SimpleRandomLFIB4_t, uint32_t, SIMPLERANDOM_LFIB4_NUM_SEEDS,
+                         simplerandom_lfib4_seed(p_state, seeds[0], seeds[1], seeds[2], seeds[3]))
+TEST_GENERATOR_FUNCTIONS(swb, SimpleRandomSWB_t, uint32_t, SIMPLERANDOM_SWB_NUM_SEEDS,
+                         simplerandom_swb_seed(p_state, seeds[0], seeds[1], seeds[2], seeds[3]))
+
+#ifdef UINT64_C
+
+#define TEST_64_MAX         (2u * 2048u + 3u)
+
+static int test_64(void)
+{
+    /* Fill lengths, including ones long enough for the chunked fills. */
+    static const size_t     lengths[] = { 0, 1u, 5u, 2048u + 5u, TEST_64_MAX };
+    static uint64_t         out64[TEST_64_MAX];
+    uint32_t                seeds[4];
+    SimpleRandomCong_t      cong[2];
+    SimpleRandomSHR3_t      shr3[2];
+    SimpleRandomMWC1_t      mwc1[2];
+    SimpleRandomMWC2_t      mwc2[2];
+    SimpleRandomKISS_t      kiss[2];
+    SimpleRandomMWC64_t     mwc64[2];
+    SimpleRandomKISS2_t     kiss2[2];
+    SimpleRandomLFSR113_t   lfsr113[2];
+    SimpleRandomLFSR88_t    lfsr88[2];
+    uint32_t                first;
+    size_t                  num_out;
+    size_t                  i;
+    size_t                  j;
+    bool                    ok = true;
+
+    printf("64-bit output tests\n");
+
+    seeds[0] = UINT32_C(2247183469);
+    seeds[1] = UINT32_C(99545079);
+    seeds[2] = UINT32_C(3269400377);
+    seeds[3] = UINT32_C(3950144837);
+    simplerandom_cong_seed_batch(&cong[0], seeds, 1u);
+    cong[1] = cong[0];
+    simplerandom_shr3_seed_batch(&shr3[0], seeds, 1u);
+    shr3[1] = shr3[0];
+    simplerandom_mwc1_seed_batch(&mwc1[0], seeds, 1u);
+    mwc1[1] = mwc1[0];
+    simplerandom_mwc2_seed_batch(&mwc2[0], seeds, 1u);
+    mwc2[1] = mwc2[0];
+    simplerandom_kiss_seed_batch(&kiss[0], seeds, 1u);
+    kiss[1] = kiss[0];
+    simplerandom_mwc64_seed_batch(&mwc64[0], seeds, 1u);
+    mwc64[1] = mwc64[0];
+    simplerandom_kiss2_seed_batch(&kiss2[0], seeds, 1u);
+    kiss2[1] = kiss2[0];
+    simplerandom_lfsr113_seed_batch(&lfsr113[0], seeds, 1u);
+    lfsr113[1] = lfsr113[0];
+    simplerandom_lfsr88_seed_batch(&lfsr88[0], seeds, 1u);
+    lfsr88[1] = lfsr88[0];
+
+    /* Check fill64() and next64() against pairs of next() values, with the
+     * first value in the low word. */
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+    {
+        num_out = lengths[i];
+        simplerandom_cong_fill64(&cong[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_cong_next(&cong[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_cong_next(&cong[1]) << 32u) | first));
+        }
+        first = simplerandom_cong_next(&cong[1]);
+        ok = ok && (simplerandom_cong_next64(&cong[0]) == (((uint64_t)simplerandom_cong_next(&cong[1]) << 32u) | first));
+        ok = ok && memcmp(&cong[0], &cong[1], sizeof(cong[0])) == 0;
+        simplerandom_shr3_fill64(&shr3[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_shr3_next(&shr3[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_shr3_next(&shr3[1]) << 32u) | first));
+        }
+        first = simplerandom_shr3_next(&shr3[1]);
+        ok = ok && (simplerandom_shr3_next64(&shr3[0]) == (((uint64_t)simplerandom_shr3_next(&shr3[1]) << 32u) | first));
+        ok = ok && memcmp(&shr3[0], &shr3[1], sizeof(shr3[0])) == 0;
+        simplerandom_mwc1_fill64(&mwc1[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_mwc1_next(&mwc1[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_mwc1_next(&mwc1[1]) << 32u) | first));
+        }
+        first = simplerandom_mwc1_next(&mwc1[1]);
+        ok = ok && (simplerandom_mwc1_next64(&mwc1[0]) == (((uint64_t)simplerandom_mwc1_next(&mwc1[1]) << 32u) | first));
+        ok = ok && memcmp(&mwc1[0], &mwc1[1], sizeof(mwc1[0])) == 0;
+        simplerandom_mwc2_fill64(&mwc2[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_mwc2_next(&mwc2[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_mwc2_next(&mwc2[1]) << 32u) | first));
+        }
+        first = simplerandom_mwc2_next(&mwc2[1]);
+        ok = ok && (simplerandom_mwc2_next64(&mwc2[0]) == (((uint64_t)simplerandom_mwc2_next(&mwc2[1]) << 32u) | first));
+        ok = ok && memcmp(&mwc2[0], &mwc2[1], sizeof(mwc2[0])) == 0;
+        simplerandom_kiss_fill64(&kiss[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_kiss_next(&kiss[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_kiss_next(&kiss[1]) << 32u) | first));
+        }
+        first = simplerandom_kiss_next(&kiss[1]);
+        ok = ok && (simplerandom_kiss_next64(&kiss[0]) == (((uint64_t)simplerandom_kiss_next(&kiss[1]) << 32u) | first));
+        ok = ok && memcmp(&kiss[0], &kiss[1], sizeof(kiss[0])) == 0;
+        simplerandom_mwc64_fill64(&mwc64[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_mwc64_next(&mwc64[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_mwc64_next(&mwc64[1]) << 32u) | first));
+        }
+        first = simplerandom_mwc64_next(&mwc64[1]);
+        ok = ok && (simplerandom_mwc64_next64(&mwc64[0]) == (((uint64_t)simplerandom_mwc64_next(&mwc64[1]) << 32u) | first));
+        ok = ok && memcmp(&mwc64[0], &mwc64[1], sizeof(mwc64[0])) == 0;
+        simplerandom_kiss2_fill64(&kiss2[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_kiss2_next(&kiss2[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_kiss2_next(&kiss2[1]) << 32u) | first));
+        }
+        first = simplerandom_kiss2_next(&kiss2[1]);
+        ok = ok && (simplerandom_kiss2_next64(&kiss2[0]) == (((uint64_t)simplerandom_kiss2_next(&kiss2[1]) << 32u) | first));
+        ok = ok && memcmp(&kiss2[0], &kiss2[1], sizeof(kiss2[0])) == 0;
+        simplerandom_lfsr113_fill64(&lfsr113[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_lfsr113_next(&lfsr113[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_lfsr113_next(&lfsr113[1]) << 32u) | first));
+        }
+        first = simplerandom_lfsr113_next(&lfsr113[1]);
+        ok = ok && (simplerandom_lfsr113_next64(&lfsr113[0]) == (((uint64_t)simplerandom_lfsr113_next(&lfsr113[1]) << 32u) | first));
+        ok = ok && memcmp(&lfsr113[0], &lfsr113[1], sizeof(lfsr113[0])) == 0;
+        simplerandom_lfsr88_fill64(&lfsr88[0], out64, num_out);
+        for (j = 0; j < num_out; j++)
+        {
+            first = simplerandom_lfsr88_next(&lfsr88[1]);
+            ok = ok && (out64[j] == (((uint64_t)simplerandom_lfsr88_next(&lfsr88[1]) << 32u) | first));
+        }
+        first = simplerandom_lfsr88_next(&lfsr88[1]);
+        ok = ok && (simplerandom_lfsr88_next64(&lfsr88[0]) == (((uint64_t)simplerandom_lfsr88_next(&lfsr88[1]) << 32u) | first));
+        ok = ok && memcmp(&lfsr88[0], &lfsr88[1], sizeof(lfsr88[0])) == 0;
+    }
+    if (!ok)
+    {
+        printf("    next64/fill64 FAIL\n");
+        return 1;
+    }
+    printf("    next64/fill64 OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+/* Fill lengths from a single value up to a long fill. */
+static const size_t test_kiss64_fill_lengths[] = { 0, 1u, 2u, 999u, 1000u };
+
+static int test_kiss64(void)
+{
+    static const uintmax_t  discards[] = { 0, 1u, 2u, 63u, 64u, 999u };
+    uint32_t                seeds[SIMPLERANDOM_KISS64_NUM_SEEDS];
+    SimpleRandomKISS64_t    kiss64[2];
+    uint64_t                k64;
+    uint32_t                i;
+    size_t                  j;
+    bool                    ok = true;
+
+    printf("KISS64 tests\n");
+
+    /* Check value from Marsaglia's 2009 post, after 10^8 values from his
+     * initial state. */
+    simplerandom_kiss64_seed(&kiss64[0], UINT64_C(123456123456123456), UINT64_C(1234567890987654321), UINT64_C(1066149217761810), UINT64_C(362436362436362436));
+    for (i = 0; i < 100000000; i++)
+    {
+        k64 = simplerandom_kiss64_next(&kiss64[0]);
+    }
+    if (k64 != UINT64_C(1666297717051644203))
+    {
+        printf("    KISS64      FAIL\n");
+        return 1;
+    }
+    printf("    KISS64      OK\n");
+
+    ok = ok && kiss64_test_fill(&kiss64[0], test_kiss64_fill_lengths, sizeof(test_kiss64_fill_lengths) / sizeof(test_kiss64_fill_lengths[0]));
+
+    /* discard(n) is the same as n values of next(), and discards add up. */
+    kiss64[1] = kiss64[0];
+    for (j = 0; j < sizeof(discards) / sizeof(discards[0]); j++)
+    {
+        simplerandom_kiss64_discard(&kiss64[0], discards[j]);
+        for (i = 0; i < discards[j]; i++)
+        {
+            simplerandom_kiss64_next(&kiss64[1]);
+        }
+        ok = ok && memcmp(&kiss64[0], &kiss64[1], sizeof(kiss64[0])) == 0;
+    }
+    simplerandom_kiss64_discard(&kiss64[0], UINTMAX_C(0x123456789ABCDEF));
+    simplerandom_kiss64_discard(&kiss64[0], UINTMAX_C(0xFEDCBA987654321));
+    simplerandom_kiss64_discard(&kiss64[1], UINTMAX_C(0x123456789ABCDEF) + UINTMAX_C(0xFEDCBA987654321));
+    ok = ok && memcmp(&kiss64[0], &kiss64[1], sizeof(kiss64[0])) == 0;
+    if (!ok)
+    {
+        printf("    fill/discard FAIL\n");
+        return 1;
+    }
+    printf("    fill/discard OK\n");
+
+    /* Seeding sanitizes bad MWC and SHR3 states: zero, and the MWC modulus. */
+    simplerandom_kiss64_seed(&kiss64[0], 0, 0, 0, 0);
+    ok = ok && (kiss64[0].mwc_upper != 0 || kiss64[0].mwc_lower != 0) && kiss64[0].shr3 != 0;
+    simplerandom_kiss64_seed(&kiss64[0], UINT64_C(1) << 58u, UINT64_C(0xFFFFFFFFFFFFFFFF), 0, 0);
+    ok = ok && (kiss64[0].mwc_upper != 0 || kiss64[0].mwc_lower != 0) && kiss64[0].mwc_upper <= (UINT64_C(1) << 58u);
+    simplerandom_kiss64_seed(&kiss64[0], UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0xFFFFFFFFFFFFFFFF), 0, 0);
+    ok = ok && kiss64[0].mwc_upper <= (UINT64_C(1) << 58u);
+
+    ok = ok && kiss64_test_seed_mix();
+
+    /* seed_batch() takes each 64-bit seed low word first, as seed_array(). */
+    for (j = 0; j < SIMPLERANDOM_KISS64_NUM_SEEDS; j++)
+        seeds[j] = (uint32_t)(UINT32_C(0x9E3779B9) * (j + 1u));
+    simplerandom_kiss64_seed_array(&kiss64[0], seeds, SIMPLERANDOM_KISS64_NUM_SEEDS, false);
+    simplerandom_kiss64_seed_batch(&kiss64[1], seeds, 1u);
+    ok = ok && memcmp(&kiss64[0], &kiss64[1], sizeof(kiss64[0])) == 0;
+    if (!ok)
+    {
+        printf("    seed/mix    FAIL\n");
+        return 1;
+    }
+    printf("    seed/mix    OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+/* Fill lengths from a whole table, and across the end of the table. */
+static const size_t test_cmwc4096_fill_lengths[] = { 0, 1u, 4095u, 4096u, 4097u, 1000u, 9000u };
+
+static int test_cmwc4096(void)
+{
+    static const uint32_t           first_values[] = { UINT32_C(736549275), UINT32_C(678086136), UINT32_C(842810117) };
+    static SimpleRandomCMWC4096_t   cmwc;
+    SimpleRandomMWC1_t              mwc1;
+    SimpleRandomCong_t              cong;
+    SimpleRandomSHR3_t              shr3;
+    uint32_t                        k;
+    uint32_t                        i;
+    bool                            ok = true;
+
+    printf("CMWC4096 tests\n");
+
+    /* Check values from Marsaglia's CMWC4096 code, as run by
+     * c/marsaglia/marsaglia-rng.c. Its Q[] is filled with values of his
+     * 1999 KISS from settable(12345, 65435, 34221, 12345, ...), and it
+     * starts with c = 362436 and the first step on Q[0]. */
+    simplerandom_mwc1_seed(&mwc1, UINT32_C(12345), UINT32_C(65435));
+    simplerandom_cong_seed(&cong, UINT32_C(12345));
+    simplerandom_shr3_seed(&shr3, UINT32_C(34221));
+    for (i = 0; i < SIMPLERANDOM_CMWC4096_LAG; i++)
+    {
+        cmwc.q[i] = (simplerandom_mwc1_next(&mwc1) ^ simplerandom_cong_next(&cong)) + simplerandom_shr3_next(&shr3);
+    }
+    cmwc.c = UINT32_C(362436);
+    cmwc.index = SIMPLERANDOM_CMWC4096_LAG - 1u;
+    for (i = 0; i < sizeof(first_values) / sizeof(first_values[0]); i++)
+    {
+        ok = ok && (simplerandom_cmwc4096_next(&cmwc) == first_values[i]);
+    }
+    for ( ; i < 1000000; i++)
+    {
+        k = simplerandom_cmwc4096_next(&cmwc);
+    }
+    ok = ok && (k == UINT32_C(2065907955));
+    if (!ok)
+    {
+        printf("    CMWC4096    FAIL\n");
+        return 1;
+    }
+    printf("    CMWC4096    OK\n");
+
+    if (!cmwc4096_test_fill(&cmwc, test_cmwc4096_fill_lengths, sizeof(test_cmwc4096_fill_lengths) / sizeof(test_cmwc4096_fill_lengths[0])))
+    {
+        printf("    fill        FAIL\n");
+        return 1;
+    }
+    printf("    fill        OK\n");
+
+    /* Seeding and sanitize bring the carry and index into range. */
+    simplerandom_cmwc4096_seed(&cmwc, UINT32_C(12345), UINT32_C(65435), UINT32_C(12345), UINT32_C(34221));
+    ok = ok && cmwc.c <= 18782u && cmwc.index == 4095u;
+    cmwc.c = UINT32_C(0xFFFFFFFF);
+    cmwc.index = UINT32_C(0xFFFFFFFF);
+    simplerandom_cmwc4096_sanitize(&cmwc);
+    ok = ok && cmwc.c <= 18782u && cmwc.index < 4096u;
+
+    ok = ok && cmwc4096_test_seed_mix();
+    if (!ok)
+    {
+        printf("    seed/mix    FAIL\n");
+        return 1;
+    }
+    printf("    seed/mix    OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#endif /* defined(UINT64_C) */
+
+/* Fill lengths around the table size, where the fill method changes, and a
+ * long fill. */
+static const size_t test_lag_fill_lengths[] = { 0, 1u, 255u, 256u, 257u, 511u, 512u, 1000u, 4133u };
+
+static int test_lag(void)
+{
+    SimpleRandomLFIB4_t     lfib4;
+    SimpleRandomSWB_t       swb;
+    uint32_t                k;
+    uint32_t                i;
+    bool                    ok = true;
+
+    printf("Lagged-Fibonacci tests\n");
+
+    /* Check values from Marsaglia's 1999 test program. It seeds the table
+     * with settable(12345, 65435, 34221, 12345, ...), and SWB continues on
+     * the table after the LFIB4 values. */
+    simplerandom_lfib4_seed(&lfib4, UINT32_C(12345), UINT32_C(65435), UINT32_C(12345), UINT32_C(34221));
+    for (i = 0; i < 1000000; i++)
+    {
+        k = simplerandom_lfib4_next(&lfib4);
+    }
+    ok = ok && (k == UINT32_C(3673084687));
+    memcpy(swb.t, lfib4.t, sizeof(swb.t));
+    swb.index = lfib4.index;
+    swb.borrow = 0;
+    for (i = 0; i < 1000000; i++)
+    {
+        k = simplerandom_swb_next(&swb);
+    }
+    ok = ok && (k == UINT32_C(319777393));
+    if (!ok)
+    {
+        printf("    LFIB4/SWB   FAIL\n");
+        return 1;
+    }
+    printf("    LFIB4/SWB   OK\n");
+
+    ok = ok && lfib4_test_fill(&lfib4, test_lag_fill_lengths, sizeof(test_lag_fill_lengths) / sizeof(test_lag_fill_lengths[0]));
+    ok = ok && swb_test_fill(&swb, test_lag_fill_lengths, sizeof(test_lag_fill_lengths) / sizeof(test_lag_fill_lengths[0]));
+    if (!ok)
+    {
+        printf("    fill        FAIL\n");
+        return 1;
+    }
+    printf("    fill        OK\n");
+
+    /* Seeding sanitizes bad tables: all even for LFIB4, all zero for SWB. */
+    memset(&lfib4, 0, sizeof(lfib4));
+    simplerandom_lfib4_sanitize(&lfib4);
+    ok = ok && (lfib4.t[0] & 1u) != 0;
+    memset(&swb, 0, sizeof(swb));
+    simplerandom_swb_sanitize(&swb);
+    ok = ok && swb.t[0] != 0;
+
+    ok = ok && lfib4_test_seed_mix();
+    ok = ok && swb_test_seed_mix();
+    if (!ok)
+    {
+        printf("    seed/mix    FAIL\n");
+        return 1;
+    }
+    printf("    seed/mix    OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#define SEED_BATCH_TEST_NUM     1000u
+
+static int test_seed_batch(void)
+{
+    /* Seed values that need sanitizing or alternative seeding. */
+    static const uint32_t   special_seeds[] = {
+        0, 1u, 2u, 7u, 15u, 127u, UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFE),
+        UINT32_C(0x9068FFFF), UINT32_C(0x6F970000), UINT32_C(0x464FFFFF), UINT32_C(0x8C9FFFFE),
+        UINT32_C(0xD2EFFFFD), UINT32_C(0xB9B00000), UINT32_C(0x00010001), UINT32_C(0x00070007),
+        UINT32_C(0x007F007F), UINT32_C(0x00800080), UINT32_C(0x01000000), UINT32_C(0x7F000000),
+    };
+    /* MWC64 seed pairs (upper, lower) that are bad or need reducing. */
+    static const uint32_t   mwc64_seeds[][2] = {
+        { 0, 0 },
+        { UINT32_C(0x29A65EAC), UINT32_C(0xFFFFFFFF) },
+        { UINT32_C(0x534CBD59), UINT32_C(0xFFFFFFFE) },
+        { UINT32_C(0xD659A153), 0 },
+        { UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF) },
+        { UINT32_C(0x29A65EAD), 0 },
+    };
+    static uint32_t                 seeds[4u * SEED_BATCH_TEST_NUM];
+    static SimpleRandomCong_t       cong[SEED_BATCH_TEST_NUM];
+    static SimpleRandomSHR3_t       shr3[SEED_BATCH_TEST_NUM];
+    static SimpleRandomMWC1_t       mwc1[SEED_BATCH_TEST_NUM];
+    static SimpleRandomMWC2_t       mwc2[SEED_BATCH_TEST_NUM];
+    static SimpleRandomKISS_t       kiss[SEED_BATCH_TEST_NUM];
+#ifdef UINT64_C
+    static SimpleRandomMWC64_t      mwc64[SEED_BATCH_TEST_NUM];
+    static SimpleRandomKISS2_t      kiss2[SEED_BATCH_TEST_NUM];
+#endif
+    static SimpleRandomLFSR113_t    lfsr113[SEED_BATCH_TEST_NUM];
+    static SimpleRandomLFSR88_t     lfsr88[SEED_BATCH_TEST_NUM];
+    SimpleRandomCong_t      cong_one;
+    SimpleRandomSHR3_t      shr3_one;
+    SimpleRandomMWC1_t      mwc1_one;
+    SimpleRandomMWC2_t      mwc2_one;
+    SimpleRandomKISS_t      kiss_one;
+#ifdef UINT64_C
+    SimpleRandomMWC64_t     mwc64_one;
+    SimpleRandomKISS2_t     kiss2_one;
+#endif
+    SimpleRandomLFSR113_t   lfsr113_one;
+    SimpleRandomLFSR88_t    lfsr88_one;
+    SimpleRandomCong_t      seed_gen;
+    const uint32_t        * p;
+    size_t                  num_special = sizeof(special_seeds) / sizeof(special_seeds[0]);
+    size_t                  num_mwc64 = sizeof(mwc64_seeds) / sizeof(mwc64_seeds[0]);
+    size_t                  i;
+    bool                    ok = true;
+
+    printf("Seed batch tests\n");
+
+    /* The MWC64 pairs go at multiples of 4, so they are the MWC64 part of the
+     * KISS2 seeds too. Then the special seeds, cycled through all positions,
+     * then pseudo-random seeds. */
+    simplerandom_cong_seed(&seed_gen, UINT32_C(2051391225));
+    for (i = 0; i < 4u * SEED_BATCH_TEST_NUM; i++)
+    {
+        if (i < 4u * num_mwc64 && (i % 4u) < 2u)
+            seeds[i] = mwc64_seeds[i / 4u][i % 4u];
+        else if (i < 8u * num_special)
+            seeds[i] = special_seeds[i % num_special];
+        else
+            seeds[i] = simplerandom_cong_next(&seed_gen);
+    }
+
+    simplerandom_cong_seed_batch(cong, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_shr3_seed_batch(shr3, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_mwc1_seed_batch(mwc1, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_mwc2_seed_batch(mwc2, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_kiss_seed_batch(kiss, seeds, SEED_BATCH_TEST_NUM);
+#ifdef UINT64_C
+    simplerandom_mwc64_seed_batch(mwc64, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_kiss2_seed_batch(kiss2, seeds, SEED_BATCH_TEST_NUM);
+#endif
+    simplerandom_lfsr113_seed_batch(lfsr113, seeds, SEED_BATCH_TEST_NUM);
+    simplerandom_lfsr88_seed_batch(lfsr88, seeds, SEED_BATCH_TEST_NUM);
+
+    /* Check against the scalar seed functions. */
+    for (i = 0; i < SEED_BATCH_TEST_NUM; i++)
+    {
+        simplerandom_cong_seed(&cong_one, seeds[i]);
+        ok = ok && memcmp(&cong[i], &cong_one, sizeof(cong_one)) == 0;
+        simplerandom_shr3_seed(&shr3_one, seeds[i]);
+        ok = ok && memcmp(&shr3[i], &shr3_one, sizeof(shr3_one)) == 0;
+        p = &seeds[2u * i];
+        simplerandom_mwc1_seed(&mwc1_one, p[0], p[1]);
+        ok = ok && memcmp(&mwc1[i], &mwc1_one, sizeof(mwc1_one)) == 0;
+        simplerandom_mwc2_seed(&mwc2_one, p[0], p[1]);
+        ok = ok && memcmp(&mwc2[i], &mwc2_one, sizeof(mwc2_one)) == 0;
+#ifdef UINT64_C
+        simplerandom_mwc64_seed(&mwc64_one, p[0], p[1]);
+        ok = ok && memcmp(&mwc64[i], &mwc64_one, sizeof(mwc64_one)) == 0;
+#endif
+        p = &seeds[3u * i];
+        simplerandom_lfsr88_seed(&lfsr88_one, p[0], p[1], p[2]);
+        ok = ok && memcmp(&lfsr88[i], &lfsr88_one, sizeof(lfsr88_one)) == 0;
+        p = &seeds[4u * i];
+        simplerandom_kiss_seed(&kiss_one, p[0], p[1], p[2], p[3]);
+        ok = ok && memcmp(&kiss[i], &kiss_one, sizeof(kiss_one)) == 0;
+#ifdef UINT64_C
+        simplerandom_kiss2_seed(&kiss2_one, p[0], p[1], p[2], p[3]);
+        ok = ok && memcmp(&kiss2[i], &kiss2_one, sizeof(kiss2_one)) == 0;
+#endif
+        simplerandom_lfsr113_seed(&lfsr113_one, p[0], p[1], p[2], p[3]);
+        ok = ok && memcmp(&lfsr113[i], &lfsr113_one, sizeof(lfsr113_one)) == 0;
+        if (!ok)
+        {
+            printf("    seed_batch  FAIL at %zu\n", i);
+            return 1;
+        }
+    }
+    printf("    seed_batch  OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#define MIX_HASH_TEST_NUM       1003u
+
+static int test_mix_hash(void)
+{
+    /* Hash output for data words 0..36, which must never change. */
+    static const uint32_t   expected[5] = {
+        UINT32_C(0xB156C8A4), UINT32_C(0xF7D841B6), UINT32_C(0x3197E243), UINT32_C(0x61FC19A6), UINT32_C(0x7F75D703),
+    };
+    static const size_t     chunk_sizes[] = { 1u, 2u, 3u, 5u, 0, 7u, 64u, 13u };
+    static uint32_t         data[MIX_HASH_TEST_NUM];
+    SimpleRandomMixHash_t   hash;
+    SimpleRandomCong_t      seed_gen;
+    SimpleRandomKISS_t      kiss[2];
+#ifdef UINT64_C
+    SimpleRandomKISS2_t     kiss2[2];
+#endif
+    SimpleRandomLFSR113_t   lfsr113[2];
+    SimpleRandomLFSR88_t    lfsr88[2];
+    uint32_t                out_one[5];
+    uint32_t                out_chunks[5];
+    size_t                  num_chunk_sizes = sizeof(chunk_sizes) / sizeof(chunk_sizes[0]);
+    size_t                  i;
+    size_t                  j;
+    size_t                  chunk;
+    bool                    ok = true;
+
+    printf("Mix hash tests\n");
+
+    for (i = 0; i < 37u; i++)
+        data[i] = (uint32_t)i;
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_mix_hash_update(&hash, data, 37u);
+    simplerandom_mix_hash_final(&hash, out_one, 5u);
+    ok = ok && memcmp(out_one, expected, sizeof(expected)) == 0;
+
+    /* The result mustn't depend on how the data is split into updates. */
+    simplerandom_cong_seed(&seed_gen, UINT32_C(2051391225));
+    for (i = 0; i < MIX_HASH_TEST_NUM; i++)
+        data[i] = simplerandom_cong_next(&seed_gen);
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_mix_hash_update(&hash, data, MIX_HASH_TEST_NUM);
+    simplerandom_mix_hash_final(&hash, out_one, 5u);
+    simplerandom_mix_hash_init(&hash);
+    for (i = 0, j = 0; i < MIX_HASH_TEST_NUM; i += chunk, j++)
+    {
+        chunk = chunk_sizes[j % num_chunk_sizes];
+        if (chunk > MIX_HASH_TEST_NUM - i)
+            chunk = MIX_HASH_TEST_NUM - i;
+        simplerandom_mix_hash_update(&hash, &data[i], chunk);
+    }
+    simplerandom_mix_hash_final(&hash, out_chunks, 5u);
+    ok = ok && memcmp(out_one, out_chunks, sizeof(out_one)) == 0;
+
+    /* Any change of the data, including its length, changes the result. */
+    data[500] ^= 1u;
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_mix_hash_update(&hash, data, MIX_HASH_TEST_NUM);
+    simplerandom_mix_hash_final(&hash, out_chunks, 5u);
+    ok = ok && memcmp(out_one, out_chunks, sizeof(out_one)) != 0;
+    data[500] ^= 1u;
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_mix_hash_update(&hash, data, MIX_HASH_TEST_NUM - 1u);
+    simplerandom_mix_hash_final(&hash, out_chunks, 5u);
+    ok = ok && memcmp(out_one, out_chunks, sizeof(out_one)) != 0;
+    if (!ok)
+    {
+        printf("    mix_hash    FAIL\n");
+        return 1;
+    }
+    printf("    mix_hash    OK\n");
+
+    /* mix_bulk() is the same as mixing in num_seeds() words of hash output. */
+    simplerandom_kiss_seed(&kiss[0], UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
+#ifdef UINT64_C
+    simplerandom_kiss2_seed(&kiss2[0], UINT32_C(7654321), UINT32_C(521288629), UINT32_C(123456789), UINT32_C(362436000));
+#endif
+    simplerandom_lfsr113_seed(&lfsr113[0], 0, 0, 0, 0);
+    simplerandom_lfsr88_seed(&lfsr88[0], 0, 0, 0);
+    kiss[1] = kiss[0];
+#ifdef UINT64_C
+    kiss2[1] = kiss2[0];
+#endif
+    lfsr113[1] = lfsr113[0];
+    lfsr88[1] = lfsr88[0];
+
+    /* No data leaves the state unchanged. */
+    simplerandom_kiss_mix_bulk(&kiss[0], data, 0);
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_lfsr88_mix_hash(&lfsr88[0], &hash);
+    ok = ok &&
+        memcmp(&kiss[0], &kiss[1], sizeof(kiss[0])) == 0 &&
+        memcmp(&lfsr88[0], &lfsr88[1], sizeof(lfsr88[0])) == 0;
+
+    simplerandom_kiss_mix_bulk(&kiss[0], data, MIX_HASH_TEST_NUM);
+#ifdef UINT64_C
+    simplerandom_kiss2_mix_bulk(&kiss2[0], data, MIX_HASH_TEST_NUM);
+#endif
+    simplerandom_lfsr113_mix_bulk(&lfsr113[0], data, MIX_HASH_TEST_NUM);
+    simplerandom_lfsr88_mix_bulk(&lfsr88[0], data, MIX_HASH_TEST_NUM);
+    ok = ok && memcmp(&kiss[0], &kiss[1], sizeof(kiss[0])) != 0;
+    simplerandom_kiss_mix(&kiss[1], out_one, simplerandom_kiss_num_seeds(&kiss[1]));
+#ifdef UINT64_C
+    simplerandom_kiss2_mix(&kiss2[1], out_one, simplerandom_kiss2_num_seeds(&kiss2[1]));
+#endif
+    simplerandom_lfsr113_mix(&lfsr113[1], out_one, simplerandom_lfsr113_num_seeds(&lfsr113[1]));
+    simplerandom_lfsr88_mix(&lfsr88[1], out_one, simplerandom_lfsr88_num_seeds(&lfsr88[1]));
+    ok = ok &&
+        memcmp(&kiss[0], &kiss[1], sizeof(kiss[0])) == 0 &&
+#ifdef UINT64_C
+        memcmp(&kiss2[0], &kiss2[1], sizeof(kiss2[0])) == 0 &&
+#endif
+        memcmp(&lfsr113[0], &lfsr113[1], sizeof(lfsr113[0])) == 0 &&
+        memcmp(&lfsr88[0], &lfsr88[1], sizeof(lfsr88[0])) == 0;
+    if (!ok)
+    {
+        printf("    mix_bulk    FAIL\n");
+        return 1;
+    }
+    printf("    mix_bulk    OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#ifdef UINT64_C
+static uint32_t get_uint32_le_test(const uint8_t * p_buf)
+{
+    return (uint32_t)p_buf[0] |
+            ((uint32_t)p_buf[1] << 8u) |
+            ((uint32_t)p_buf[2] << 16u) |
+            ((uint32_t)p_buf[3] << 24u);
+}
+#endif
+
+static int test_state(void)
+{
+    SimpleRandomKISS_t      kiss;
+    SimpleRandomKISS_t      kiss_restored;
+    SimpleRandomLFSR88_t    lfsr88_array[3];
+    SimpleRandomLFSR88_t    lfsr88_restored[3];
+    const SimpleRandomLFSR88_t * p_lfsr88_mapped;
+    uint32_t                buf[(SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(lfsr88_array)) / sizeof(uint32_t)];
+    uint8_t               * p_buf = (uint8_t *)buf;
+    uintmax_t               kiss_position;
+    uintmax_t               position;
+    size_t                  num_states;
+    size_t                  i;
+#ifdef UINT64_C
+    SimpleRandomKISS64_t    kiss64_array[2];
+    SimpleRandomKISS64_t    kiss64_restored[2];
+    static SimpleRandomCMWC4096_t cmwc4096;
+    static SimpleRandomCMWC4096_t cmwc4096_restored;
+#endif
+    static SimpleRandomSWB_t swb;
+    static SimpleRandomSWB_t swb_restored;
+    /* Room for a CMWC4096 record, the largest state. */
+    static uint32_t         big_buf[SIMPLERANDOM_STATE_HEADER_SIZE / sizeof(uint32_t) + 4098u];
+    uint8_t               * p_big_buf = (uint8_t *)big_buf;
+    static const uint8_t    kiss_record[SIMPLERANDOM_STATE_HEADER_SIZE + 16u] =
+    {
+        'S', 'R', 's', 't', 2, SIMPLERANDOM_TYPE_KISS, 0, 0,
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x33, 0x22, 0x11, 0x88, 0x77, 0x66, 0x35,
+        0xCC, 0xBB, 0xAA, 0x99, 0x00, 0xFF, 0xEE, 0xDD,
+    };
+
+    printf("State encoding tests\n");
+
+    /* Single record, checked against the expected little-endian bytes. */
+    kiss.mwc_upper = UINT32_C(0x11223344);
+    kiss.mwc_lower = UINT32_C(0x35667788);
+    kiss.cong = UINT32_C(0x99AABBCC);
+    kiss.shr3 = UINT32_C(0xDDEEFF00);
+    kiss_position = (((uintmax_t)UINT32_C(0x01020304) << 16u) << 16u) | UINT32_C(0x05060708);
+    if (simplerandom_state_record_size(SIMPLERANDOM_TYPE_KISS) != sizeof(kiss_record) ||
+        simplerandom_state_encode(SIMPLERANDOM_TYPE_KISS, &kiss, kiss_position, p_buf, sizeof(kiss_record) - 1u) != 0 ||
+        simplerandom_state_encode(SIMPLERANDOM_TYPE_KISS, &kiss, kiss_position, p_buf, sizeof(kiss_record)) != sizeof(kiss_record) ||
+        memcmp(p_buf, kiss_record, sizeof(kiss_record)) != 0)
+    {
+        printf("    encode      FAIL\n");
+        return 1;
+    }
+    if (simplerandom_state_type(kiss_record, sizeof(kiss_record)) != SIMPLERANDOM_TYPE_KISS ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_KISS2, &kiss_restored, &position, kiss_record, sizeof(kiss_record)) != 0 ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_KISS, &kiss_restored, &position, kiss_record, sizeof(kiss_record) - 1u) != 0 ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_KISS, &kiss_restored, &position, kiss_record, sizeof(kiss_record)) != sizeof(kiss_record) ||
+        memcmp(&kiss, &kiss_restored, sizeof(kiss)) != 0 ||
+        position != kiss_position)
+    {
+        printf("    decode      FAIL\n");
+        return 1;
+    }
+    printf("    record      OK\n");
+
+    /* Table generators have records much bigger than the header. */
+    simplerandom_swb_seed(&swb, 1u, 2u, 3u, 4u);
+    simplerandom_swb_next(&swb);
+    if (simplerandom_state_record_size(SIMPLERANDOM_TYPE_SWB) != SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(swb) ||
+        simplerandom_state_encode(SIMPLERANDOM_TYPE_SWB, &swb, 99u, p_big_buf, sizeof(big_buf)) != SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(swb) ||
+        simplerandom_state_type(p_big_buf, sizeof(big_buf)) != SIMPLERANDOM_TYPE_SWB ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_LFIB4, &swb_restored, &position, p_big_buf, sizeof(big_buf)) != 0 ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_SWB, &swb_restored, &position, p_big_buf, SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(swb) - 1u) != 0 ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_SWB, &swb_restored, &position, p_big_buf, sizeof(big_buf)) != SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(swb) ||
+        memcmp(&swb, &swb_restored, sizeof(swb)) != 0 ||
+        position != 99u)
+    {
+        printf("    table       FAIL\n");
+        return 1;
+    }
+#ifdef UINT64_C
+    simplerandom_cmwc4096_seed(&cmwc4096, 5u, 6u, 7u, 8u);
+    simplerandom_cmwc4096_next(&cmwc4096);
+    if (simplerandom_state_record_size(SIMPLERANDOM_TYPE_CMWC4096) != SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(cmwc4096) ||
+        simplerandom_state_encode(SIMPLERANDOM_TYPE_CMWC4096, &cmwc4096, 0, p_big_buf, sizeof(big_buf)) != sizeof(big_buf) ||
+        simplerandom_state_decode(SIMPLERANDOM_TYPE_CMWC4096, &cmwc4096_restored, NULL, p_big_buf, sizeof(big_buf)) != sizeof(big_buf) ||
+        memcmp(&cmwc4096, &cmwc4096_restored, sizeof(cmwc4096)) != 0)
+    {
+        printf("    table       FAIL\n");
+        return 1;
+    }
+#endif
+    printf("    table       OK\n");
+
+    /* Array save, load and map. */
+    for (i = 0; i < 3u; i++)
+    {
+        simplerandom_lfsr88_seed(&lfsr88_array[i], (uint32_t)i, (uint32_t)i + 10u, (uint32_t)i + 20u);
+    }
+    if (simplerandom_state_array_size(SIMPLERANDOM_TYPE_LFSR88, 3u) != sizeof(buf) ||
+        simplerandom_state_save_array(SIMPLERANDOM_TYPE_LFSR88, lfsr88_array, 3u, 12345u, p_buf, sizeof(buf) - 1u) != 0 ||
+        simplerandom_state_save_array(SIMPLERANDOM_TYPE_LFSR88, lfsr88_array, 3u, 12345u, p_buf, sizeof(buf)) != sizeof(buf) ||
+        simplerandom_state_type(p_buf, sizeof(buf)) != SIMPLERANDOM_TYPE_LFSR88 ||
+        simplerandom_state_array_num_states(SIMPLERANDOM_TYPE_LFSR88, p_buf, sizeof(buf)) != 3u ||
+        simplerandom_state_array_num_states(SIMPLERANDOM_TYPE_LFSR88, p_buf, sizeof(buf) - 1u) != SIMPLERANDOM_STATE_ERROR ||
+        simplerandom_state_load_array(SIMPLERANDOM_TYPE_LFSR88, lfsr88_restored, 2u, &position, p_buf, sizeof(buf)) != SIMPLERANDOM_STATE_ERROR ||
+        simplerandom_state_load_array(SIMPLERANDOM_TYPE_LFSR88, lfsr88_restored, 3u, &position, p_buf, sizeof(buf)) != 3u ||
+        memcmp(lfsr88_array, lfsr88_restored, sizeof(lfsr88_array)) != 0 ||
+        position != 12345u)
+    {
+        printf("    array       FAIL\n");
+        return 1;
+    }
+    p_lfsr88_mapped = simplerandom_state_map_array(SIMPLERANDOM_TYPE_LFSR88, &num_states, &position, p_buf, sizeof(buf));
+    if (p_lfsr88_mapped != NULL &&
+        (num_states != 3u || position != 12345u ||
+         memcmp(lfsr88_array, p_lfsr88_mapped, sizeof(lfsr88_array)) != 0))
+    {
+        printf("    map         FAIL\n");
+        return 1;
+    }
+    printf("    array       OK\n");
+
+    /* An empty array round-trips, and is distinguished from an error. */
+    position = 0;
+    if (simplerandom_state_save_array(SIMPLERANDOM_TYPE_LFSR88, NULL, 0, 678u, p_buf, sizeof(buf)) != SIMPLERANDOM_STATE_HEADER_SIZE ||
+        simplerandom_state_array_num_states(SIMPLERANDOM_TYPE_LFSR88, p_buf, SIMPLERANDOM_STATE_HEADER_SIZE) != 0 ||
+        simplerandom_state_array_num_states(SIMPLERANDOM_TYPE_LFSR113, p_buf, SIMPLERANDOM_STATE_HEADER_SIZE) != SIMPLERANDOM_STATE_ERROR ||
+        simplerandom_state_load_array(SIMPLERANDOM_TYPE_LFSR88, NULL, 0, &position, p_buf, SIMPLERANDOM_STATE_HEADER_SIZE) != 0 ||
+        position != 678u)
+    {
+        printf("    empty       FAIL\n");
+        return 1;
+    }
+    p_lfsr88_mapped = simplerandom_state_map_array(SIMPLERANDOM_TYPE_LFSR88, &num_states, &position, p_buf, SIMPLERANDOM_STATE_HEADER_SIZE);
+    if (p_lfsr88_mapped != NULL && num_states != 0)
+    {
+        printf("    empty       FAIL\n");
+        return 1;
+    }
+    printf("    empty       OK\n");
+
+#ifdef UINT64_C
+    /* 64-bit state members are saved low half first. */
+    simplerandom_kiss64_seed(&kiss64_array[0], UINT64_C(0x0102030405060708), 2u, 3u, 4u);
+    simplerandom_kiss64_seed(&kiss64_array[1], 5u, 6u, 7u, 8u);
+    if (simplerandom_state_save_array(SIMPLERANDOM_TYPE_KISS64, kiss64_array, 2u, 0, p_big_buf, sizeof(big_buf)) != SIMPLERANDOM_STATE_HEADER_SIZE + sizeof(kiss64_array) ||
+        get_uint32_le_test(p_big_buf + SIMPLERANDOM_STATE_HEADER_SIZE) != UINT32_C(0x05060708) ||
+        get_uint32_le_test(p_big_buf + SIMPLERANDOM_STATE_HEADER_SIZE + 4u) != UINT32_C(0x01020304) ||
+        simplerandom_state_load_array(SIMPLERANDOM_TYPE_KISS64, kiss64_restored, 2u, NULL, p_big_buf, sizeof(big_buf)) != 2u ||
+        memcmp(kiss64_array, kiss64_restored, sizeof(kiss64_array)) != 0)
+    {
+        printf("    64-bit      FAIL\n");
+        return 1;
+    }
+    printf("    64-bit      OK\n");
+#endif
+
+    printf("\n");
+    return 0;
+}
+
+#define TEST_BATCH_NUM      37u
+#define TEST_BATCH_STEPS    100u
+
+static int test_batch(void)
+{
+    SimpleRandomSHR3Batch_t     shr3_batch;
+    SimpleRandomMWC2Batch_t     mwc2_batch;
+    SimpleRandomKISSBatch_t     kiss_batch;
+    SimpleRandomLFSR113Batch_t  lfsr113_batch;
+    SimpleRandomSHR3_t          shr3[TEST_BATCH_NUM];
+    SimpleRandomMWC2_t          mwc2[TEST_BATCH_NUM];
+    SimpleRandomKISS_t          kiss[TEST_BATCH_NUM];
+    SimpleRandomKISS_t          kiss_gathered[TEST_BATCH_NUM];
+    SimpleRandomLFSR113_t       lfsr113[TEST_BATCH_NUM];
+    SimpleRandomLFSR113_t       lfsr113_gathered[TEST_BATCH_NUM];
+    static uint32_t             batch_buf[4u * (TEST_BATCH_NUM + 16u)];
+    uint32_t                    out[TEST_BATCH_NUM];
+    static const size_t         indices[3] = { 36u, 0u, 17u };
+    size_t                      i;
+    size_t                      step;
+    uint32_t                    seed;
+
+    printf("Batch tests\n");
+
+    for (i = 0; i < TEST_BATCH_NUM; i++)
+    {
+        seed = UINT32_C(2654435769) * (uint32_t)(i + 1u);
+        simplerandom_shr3_seed(&shr3[i], seed);
+        simplerandom_mwc2_seed(&mwc2[i], seed, ~seed);
+        simplerandom_kiss_seed(&kiss[i], seed, ~seed, seed ^ 0x5A5A5A5Au, seed + 1u);
+        simplerandom_lfsr113_seed(&lfsr113[i], seed, seed >> 1u, seed >> 2u, seed >> 3u);
+    }
+
+    if (simplerandom_kiss_batch_buf_size(TEST_BATCH_NUM) > sizeof(batch_buf) ||
+        simplerandom_kiss_batch_init(&kiss_batch, batch_buf, simplerandom_kiss_batch_buf_size(TEST_BATCH_NUM) - 1u, TEST_BATCH_NUM) ||
+        simplerandom_kiss_batch_init(&kiss_batch, NULL, sizeof(batch_buf), TEST_BATCH_NUM))
+    {
+        printf("    init        FAIL\n");
+        return 1;
+    }
+
+    /* SHR3 */
+    if (!simplerandom_shr3_batch_init(&shr3_batch, batch_buf, sizeof(batch_buf), TEST_BATCH_NUM))
+    {
+        printf("    SHR3        FAIL\n");
+        return 1;
+    }
+    simplerandom_shr3_batch_scatter(&shr3_batch, shr3, NULL, TEST_BATCH_NUM);
+    for (step = 0; step < TEST_BATCH_STEPS; step++)
+    {
+        simplerandom_shr3_batch_next_all(&shr3_batch, out);
+        for (i = 0; i < TEST_BATCH_NUM; i++)
+        {
+            if (out[i] != simplerandom_shr3_next(&shr3[i]))
+            {
+                printf("    SHR3        FAIL\n");
+                return 1;
+            }
+        }
+    }
+    printf("    SHR3        OK\n");
+
+    /* MWC2 */
+    if (!simplerandom_mwc2_batch_init(&mwc2_batch, batch_buf, sizeof(batch_buf), TEST_BATCH_NUM))
+    {
+        printf("    MWC2        FAIL\n");
+        return 1;
+    }
+    simplerandom_mwc2_batch_scatter(&mwc2_batch, mwc2, NULL, TEST_BATCH_NUM);
+    for (step = 0; step < TEST_BATCH_STEPS; step++)
+    {
+        simplerandom_mwc2_batch_next_all(&mwc2_batch, out);
+        for (i = 0; i < TEST_BATCH_NUM; i++)
+        {
+            if (out[i] != simplerandom_mwc2_next(&mwc2[i]))
+            {
+                printf("    MWC2        FAIL\n");
+                return 1;
+            }
+        }
+    }
+    printf("    MWC2        OK\n");
+
+    /* KISS, including step_all(), and gather/scatter of a subset. */
+    if (!simplerandom_kiss_batch_init(&kiss_batch, batch_buf, sizeof(batch_buf), TEST_BATCH_NUM))
+    {
+        printf("    KISS        FAIL\n");
+        return 1;
+    }
+    simplerandom_kiss_batch_scatter(&kiss_batch, kiss, NULL, TEST_BATCH_NUM);
+    for (step = 0; step < TEST_BATCH_STEPS; step++)
+    {
+        if (step % 2u)
+        {
+            simplerandom_kiss_batch_step_all(&kiss_batch);
+            for (i = 0; i < TEST_BATCH_NUM; i++)
+            {
+                simplerandom_kiss_next(&kiss[i]);
+            }
+            continue;
+        }
+        simplerandom_kiss_batch_next_all(&kiss_batch, out);
+        for (i = 0; i < TEST_BATCH_NUM; i++)
+        {
+            if (out[i] != simplerandom_kiss_next(&kiss[i]))
+            {
+                printf("    KISS        FAIL\n");
+                return 1;
+            }
+        }
+    }
+    simplerandom_kiss_batch_gather(&kiss_batch, kiss_gathered, NULL, TEST_BATCH_NUM);
+    if (memcmp(kiss, kiss_gathered, sizeof(kiss)) != 0)
+    {
+        printf("    KISS        FAIL\n");
+        return 1;
+    }
+    simplerandom_kiss_batch_gather(&kiss_batch, kiss_gathered, indices, 3u);
+    for (i = 0; i < 3u; i++)
+    {
+        if (memcmp(&kiss_gathered[i], &kiss[indices[i]], sizeof(kiss[0])) != 0)
+        {
+            printf("    KISS        FAIL\n");
+            return 1;
+        }
+        simplerandom_kiss_seed(&kiss[indices[i]], (uint32_t)i, 0, 0, 0);
+        kiss_gathered[i] = kiss[indices[i]];
+    }
+    simplerandom_kiss_batch_scatter(&kiss_batch, kiss_gathered, indices, 3u);
+    simplerandom_kiss_batch_next_all(&kiss_batch, out);
+    for (i = 0; i < TEST_BATCH_NUM; i++)
+    {
+        if (out[i] != simplerandom_kiss_next(&kiss[i]))
+        {
+            printf("    KISS        FAIL\n");
+            return 1;
+        }
+    }
+    printf("    KISS        OK\n");
+
+    /* LFSR113 */
+    if (!simplerandom_lfsr113_batch_init(&lfsr113_batch, batch_buf, sizeof(batch_buf), TEST_BATCH_NUM))
+    {
+        printf("    LFSR113     FAIL\n");
+        return 1;
+    }
+    simplerandom_lfsr113_batch_scatter(&lfsr113_batch, lfsr113, NULL, TEST_BATCH_NUM);
+    for (step = 0; step < TEST_BATCH_STEPS; step++)
+    {
+        simplerandom_lfsr113_batch_next_all(&lfsr113_batch, out);
+        for (i = 0; i < TEST_BATCH_NUM; i++)
+        {
+            if (out[i] != simplerandom_lfsr113_next(&lfsr113[i]))
+            {
+                printf("    LFSR113     FAIL\n");
+                return 1;
+            }
+        }
+    }
+    simplerandom_lfsr113_batch_gather(&lfsr113_batch, lfsr113_gathered, NULL, TEST_BATCH_NUM);
+    if (memcmp(lfsr113, lfsr113_gathered, sizeof(lfsr113)) != 0)
+    {
+        printf("    LFSR113     FAIL\n");
+        return 1;
+    }
+    printf("    LFSR113     OK\n");
+
+    printf("\n");
+    return 0;
+}
+
+#define TEST_LANES_NUM      1000u
+#define TEST_LANES_BLOCKED  37u
+
+static int test_lanes(void)
+{
+    static const size_t     chunk_sizes[] = { 1u, 15u, 0, 16u, 3u, 100u, 32u, 17u };
+    SimpleRandomCongLanes_t cong_lanes;
+    SimpleRandomCong_t      cong;
+    SimpleRandomCong_t      cong_ref[SIMPLERANDOM_LANES];
+    SimpleRandomMWC1Lanes_t mwc1_lanes;
+    SimpleRandomMWC2Lanes_t mwc2_lanes;
+    SimpleRandomMWC2_t      mwc;
+    SimpleRandomMWC1_t      mwc1_ref[SIMPLERANDOM_LANES];
+    SimpleRandomMWC2_t      mwc2_ref[SIMPLERANDOM_LANES];
+#ifdef UINT64_C
+    SimpleRandomMWC64Lanes_t    mwc64_lanes;
+    SimpleRandomMWC64_t     mwc64;
+    SimpleRandomMWC64_t     mwc64_ref[SIMPLERANDOM_LANES];
+#endif
+    uint32_t                out[TEST_LANES_NUM];
+    size_t                  num_chunk_sizes = sizeof(chunk_sizes) / sizeof(chunk_sizes[0]);
+    size_t                  i;
+    size_t                  j;
+    size_t                  chunk;
+
+    printf("Lanes tests\n");
+
+    /* Cong. Lane j is 2^28 * j values ahead of lane 0. */
+    simplerandom_cong_seed(&cong, UINT32_C(2051391225));
+    simplerandom_cong_lanes_init(&cong_lanes, &cong);
+    for (j = 0; j < SIMPLERANDOM_LANES; j++)
+    {
+        cong_ref[j] = cong;
+        simplerandom_cong_discard(&cong_ref[j], (uintmax_t)j << 28u);
+    }
+    for (i = 0, j = 0; i < TEST_LANES_NUM; i += chunk, j++)
+    {
+        chunk = chunk_sizes[j % num_chunk_sizes];
+        if (chunk > TEST_LANES_NUM - i)
+            chunk = TEST_LANES_NUM - i;
+        simplerandom_cong_lanes_fill(&cong_lanes, &out[i], chunk);
+    }
+    for (i = 0; i < TEST_LANES_NUM; i++)
+    {
+        if (out[i] != simplerandom_cong_next(&cong_ref[i % SIMPLERANDOM_LANES]))
+        {
+            printf("    Cong        FAIL at %zu\n", i);
+            return 1;
+        }
+    }
+    printf("    Cong        OK\n");
+
+    /* MWC1 and MWC2. Lane j is 2^55 * j values ahead of lane 0. */
+    simplerandom_mwc2_seed(&mwc, UINT32_C(2374144069), UINT32_C(1046675282));
+    simplerandom_mwc1_lanes_init(&mwc1_lanes, &mwc);
+    simplerandom_mwc2_lanes_init(&mwc2_lanes, &mwc);
+    for (j = 0; j < SIMPLERANDOM_LANES; j++)
+    {
+        mwc2_ref[j] = mwc;
+        simplerandom_mwc2_discard(&mwc2_ref[j], (uintmax_t)j << 55u);
+        mwc1_ref[j] = mwc2_ref[j];
+    }
+    for (i = 0, j = 0; i < TEST_LANES_NUM; i += chunk, j++)
+    {
+        chunk = chunk_sizes[j % num_chunk_sizes];
+        if (chunk > TEST_LANES_NUM - i)
+            chunk = TEST_LANES_NUM - i;
+        simplerandom_mwc1_lanes_fill(&mwc1_lanes, &out[i], chunk);
+    }
+    for (i = 0; i < TEST_LANES_NUM; i++)
+    {
+        if (out[i] != simplerandom_mwc1_next(&mwc1_ref[i % SIMPLERANDOM_LANES]))
+        {
+            printf("    MWC1        FAIL at %zu\n", i);
+            return 1;
+        }
+    }
+    printf("    MWC1        OK\n");
+    for (i = 0, j = 0; i < TEST_LANES_NUM; i += chunk, j++)
+    {
+        chunk = chunk_sizes[(j + 3u) % num_chunk_sizes];
+        if (chunk > TEST_LANES_NUM - i)
+            chunk = TEST_LANES_NUM - i;
+        simplerandom_mwc2_lanes_fill(&mwc2_lanes, &out[i], chunk);
+    }
+    for (i = 0; i < TEST_LANES_NUM; i++)
+    {
+        if (out[i] != simplerandom_mwc2_next(&mwc2_ref[i % SIMPLERANDOM_LANES]))
+        {
+            printf("    MWC2        FAIL at %zu\n", i);
+            return 1;
+        }
+    }
+    printf("    MWC2        OK\n");
+
+#ifdef UINT64_C
+    /* MWC64. Lane j is 2^56 * j values ahead of lane 0. After the
+     * interleaved fill, half the lanes are one value ahead, which the
+     * lane-blocked fill must keep. */
+    simplerandom_mwc64_seed(&mwc64, UINT32_C(7654321), UINT32_C(521288629));
+    simplerandom_mwc64_lanes_init(&mwc64_lanes, &mwc64);
+    for (j = 0; j < SIMPLERANDOM_LANES; j++)
+    {
+        mwc64_ref[j] = mwc64;
+        simplerandom_mwc64_discard(&mwc64_ref[j], (uintmax_t)j << 56u);
+    }
+    for (i = 0, j = 0; i < TEST_LANES_NUM; i += chunk, j++)
+    {
+        chunk = chunk_sizes[(j + 5u) % num_chunk_sizes];
+        if (chunk > TEST_LANES_NUM - i)
+            chunk = TEST_LANES_NUM - i;
+        simplerandom_mwc64_lanes_fill(&mwc64_lanes, &out[i], chunk);
+    }
+    for (i = 0; i < TEST_LANES_NUM; i++)
+    {
+        if (out[i] != simplerandom_mwc64_next(&mwc64_ref[i % SIMPLERANDOM_LANES]))
+        {
+            printf("    MWC64       FAIL at %zu\n", i);
+            return 1;
+        }
+    }
+    simplerandom_mwc64_lanes_fill_blocked(&mwc64_lanes, out, TEST_LANES_BLOCKED);
+    for (i = 0; i < SIMPLERANDOM_LANES * TEST_LANES_BLOCKED; i++)
+    {
+        if (out[i] != simplerandom_mwc64_next(&mwc64_ref[i / TEST_LANES_BLOCKED]))
+        {
+            printf("    MWC64       FAIL at blocked %zu\n", i);
+            return 1;
+        }
+    }
+    simplerandom_mwc64_lanes_fill(&mwc64_lanes, out, 2u * SIMPLERANDOM_LANES);
+    for (i = 0; i < 2u * SIMPLERANDOM_LANES; i++)
+    {
+        if (out[i] != simplerandom_mwc64_next(&mwc64_ref[(i + TEST_LANES_NUM) % SIMPLERANDOM_LANES]))
+        {
+            printf("    MWC64       FAIL at %zu\n", TEST_LANES_NUM + i);
+            return 1;
+        }
+    }
+    printf("    MWC64       OK\n");
+#endif
+
+    printf("\n");
+    return 0;
+}
+
 static void print_matrix(const char * p_title, const BitColumnMatrix32_t * p_matrix)
 {
     size_t      i;
@@ -142,6 +1580,50 @@ static void calc_shr3_matrix(void)
     print_matrix("SHR3 BitColumnMatrix32_t matrix", &shr3_matrix);
 }
 
+#ifdef UINT64_C
+
+static void print_matrix64(const char * p_title, const BitColumnMatrix64_t * p_matrix)
+{
+    size_t      i;
+
+    printf("%s\n", p_title);
+    for (i = 0; i < 64u; ++i)
+    {
+        if (i && !(i % 4))
+            printf("\n");
+        if (!(i % 4))
+            printf("    ");
+        printf("UINT64_C(0x%016"PRIX64"), ", p_matrix->matrix[i]);
+    }
+    printf("\n");
+}
+
+static void calc_kiss64_shr3_matrix(void)
+{
+    BitColumnMatrix64_t     temp_matrix, matrix_a, matrix_b, matrix_c, shr3_matrix;
+
+    bitcolumnmatrix64_unity(&matrix_a);
+    bitcolumnmatrix64_shift(&temp_matrix, 13);
+    bitcolumnmatrix64_iadd(&matrix_a, &temp_matrix);
+
+    bitcolumnmatrix64_unity(&matrix_b);
+    bitcolumnmatrix64_shift(&temp_matrix, -17);
+    bitcolumnmatrix64_iadd(&matrix_b, &temp_matrix);
+
+    bitcolumnmatrix64_unity(&matrix_c);
+    bitcolumnmatrix64_shift(&temp_matrix, 43);
+    bitcolumnmatrix64_iadd(&matrix_c, &temp_matrix);
+
+    bitcolumnmatrix64_unity(&shr3_matrix);
+    bitcolumnmatrix64_imul(&shr3_matrix, &matrix_c);
+    bitcolumnmatrix64_imul(&shr3_matrix, &matrix_b);
+    bitcolumnmatrix64_imul(&shr3_matrix, &matrix_a);
+
+    print_matrix64("KISS64 SHR3 BitColumnMatrix64_t matrix", &shr3_matrix);
+}
+
+#endif /* defined(UINT64_C) */
+
 static void calc_lfsr_matrix(const char * p_title, signed shift_1, signed shift_2, unsigned low_mask, signed shift_3)
 {
     BitColumnMatrix32_t     temp_matrix, matrix_a, matrix_b, matrix_c, matrix_d, lfsr_matrix;
@@ -191,6 +1673,9 @@ int main(void)
 #if 0
     calc_shr3_matrix();
 #endif
+#if 0 && defined(UINT64_C)
+    calc_kiss64_shr3_matrix();
+#endif
 
 #if 0
     calc_lfsr113_matrices();
@@ -203,6 +1688,52 @@ int main(void)
     if (ret_val != 0)
         return ret_val;
 
+    ret_val = test_fill();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_fill_multi();
+    if (ret_val != 0)
+        return ret_val;
+
+#ifdef UINT64_C
+    ret_val = test_64();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_kiss64();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_cmwc4096();
+    if (ret_val != 0)
+        return ret_val;
+#endif
+
+    ret_val = test_lag();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_seed_batch();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_mix_hash();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_state();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_batch();
+    if (ret_val != 0)
+        return ret_val;
+
+    ret_val = test_lanes();
+    if (ret_val != 0)
+        return ret_val;
+
     return 0;
 }
 
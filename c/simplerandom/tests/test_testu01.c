@@ -2,17 +2,47 @@
 This tests the generators in this collection using L'Ecuyer's
 TestU01 RNG test suite.
 
+Usage:
+    test_testu01 [-p PART] GENERATOR BATTERY [TESTS]
+
+GENERATOR is one of: cong shr3 mwc1 mwc2 mwc64 kiss kiss2 lfsr113 lfsr88 lfib4
+    swb cmwc4096
+BATTERY is one of: SmallCrush Crush BigCrush
+TESTS optionally selects a subset of the battery's tests to run, as a
+comma-separated list of test numbers and ranges, e.g. "1-10,15,20". This
+allows a battery to be split across several processes, each running some of
+the tests. The tests are numbered as in the TestU01 summary results.
+
+PART gives each of those processes a different seed. Part 0 (the default)
+uses the generator's fixed base seeds. For other parts, the seeds are the
+mix hash of the base seeds followed by the part number, so the parts test
+different sequences rather than each repeating the start of one sequence.
+The seeds used are printed before the test results.
+
+Use run_testu01.sh to run the batteries for all generators in parallel, and
+make a summary of the results.
+
 References:
 
 [1]: http://www.iro.umontreal.ca/~simardr/testu01/tu01.html
 */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "simplerandom.h"
 
 #include "unif01.h"
 #include "bbattery.h"
 
 
+/* Number of tests in each battery, as given in the TestU01 user guide. */
+#define NUM_TESTS_SMALLCRUSH    10
+#define NUM_TESTS_CRUSH         96
+#define NUM_TESTS_BIGCRUSH      106
+
+
 SimpleRandomCong_t      cong_state;
 SimpleRandomSHR3_t      shr3_state;
 SimpleRandomMWC1_t      mwc1_state;
@@ -22,84 +52,207 @@ SimpleRandomKISS_t      kiss_state;
 SimpleRandomKISS2_t     kiss2_state;
 SimpleRandomLFSR113_t   lfsr113_state;
 SimpleRandomLFSR88_t    lfsr88_state;
+SimpleRandomLFIB4_t     lfib4_state;
+SimpleRandomSWB_t       swb_state;
+SimpleRandomCMWC4096_t  cmwc4096_state;
 
 
-unsigned int cong_function(void)
-{
-    return simplerandom_cong_next(&cong_state);
-}
+#define GENERATOR_FUNCTIONS(zzz) \
+    unsigned int zzz##_function(void) \
+    { \
+        return simplerandom_##zzz##_next(&zzz##_state); \
+    } \
+    static void zzz##_seed(const uint32_t * p_seeds, size_t num_seeds) \
+    { \
+        simplerandom_##zzz##_seed_array(&zzz##_state, p_seeds, num_seeds, false); \
+    }
 
-unsigned int shr3_function(void)
-{
-    return simplerandom_shr3_next(&shr3_state);
-}
+GENERATOR_FUNCTIONS(cong)
+GENERATOR_FUNCTIONS(shr3)
+GENERATOR_FUNCTIONS(mwc1)
+GENERATOR_FUNCTIONS(mwc2)
+GENERATOR_FUNCTIONS(mwc64)
+GENERATOR_FUNCTIONS(kiss)
+GENERATOR_FUNCTIONS(kiss2)
+GENERATOR_FUNCTIONS(lfsr113)
+GENERATOR_FUNCTIONS(lfsr88)
+GENERATOR_FUNCTIONS(lfib4)
+GENERATOR_FUNCTIONS(swb)
+GENERATOR_FUNCTIONS(cmwc4096)
 
-unsigned int mwc1_function(void)
-{
-    return simplerandom_mwc1_next(&mwc1_state);
-}
+#define MAX_SEEDS   4u
 
-unsigned int mwc2_function(void)
+typedef struct
 {
-    return simplerandom_mwc2_next(&mwc2_state);
-}
+    const char    * name;
+    unsigned int  (*function)(void);
+    void          (*seed)(const uint32_t * p_seeds, size_t num_seeds);
+    size_t          num_seeds;
+    uint32_t        base_seeds[MAX_SEEDS];
+} Generator_t;
 
-unsigned int mwc64_function(void)
+static const Generator_t generators[] =
 {
-    return simplerandom_mwc64_next(&mwc64_state);
-}
+    { "cong",       cong_function,      cong_seed,      1, { UINT32_C(2051391225) } },
+    { "shr3",       shr3_function,      shr3_seed,      1, { UINT32_C(3360276411) } },
+    { "mwc1",       mwc1_function,      mwc1_seed,      2, { UINT32_C(12345), UINT32_C(65437) } },
+    { "mwc2",       mwc2_function,      mwc2_seed,      2, { UINT32_C(12345), UINT32_C(65437) } },
+    { "mwc64",      mwc64_function,     mwc64_seed,     2, { UINT32_C(7654321), UINT32_C(521288629) } },
+    { "kiss",       kiss_function,      kiss_seed,      4, { UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837) } },
+    { "kiss2",      kiss2_function,     kiss2_seed,     4, { UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837) } },
+    { "lfsr113",    lfsr113_function,   lfsr113_seed,   4, { 0, 0, 0, 0 } },
+    { "lfsr88",     lfsr88_function,    lfsr88_seed,    3, { 0, 0, 0 } },
+    { "lfib4",      lfib4_function,     lfib4_seed,     4, { UINT32_C(12345), UINT32_C(65435), UINT32_C(12345), UINT32_C(34221) } },
+    { "swb",        swb_function,       swb_seed,       4, { UINT32_C(12345), UINT32_C(65435), UINT32_C(12345), UINT32_C(34221) } },
+    { "cmwc4096",   cmwc4096_function,  cmwc4096_seed,  4, { UINT32_C(12345), UINT32_C(65435), UINT32_C(12345), UINT32_C(34221) } },
+};
 
-unsigned int kiss_function(void)
+/* Seeds for one part of a split battery: the base seeds for part 0,
+ * otherwise the mix hash of the base seeds followed by the part number.
+ */
+static void part_seeds(const Generator_t * p_generator, uint32_t part, uint32_t * p_seeds)
 {
-    return simplerandom_kiss_next(&kiss_state);
-}
+    SimpleRandomMixHash_t   hash;
 
-unsigned int kiss2_function(void)
-{
-    return simplerandom_kiss2_next(&kiss2_state);
+    if (part == 0)
+    {
+        memcpy(p_seeds, p_generator->base_seeds, sizeof(p_generator->base_seeds));
+        return;
+    }
+    simplerandom_mix_hash_init(&hash);
+    simplerandom_mix_hash_update(&hash, p_generator->base_seeds, p_generator->num_seeds);
+    simplerandom_mix_hash_update(&hash, &part, 1u);
+    simplerandom_mix_hash_final(&hash, p_seeds, p_generator->num_seeds);
 }
 
-unsigned int lfsr113_function(void)
+/* Parse a test list such as "1-10,15,20" into the repetitions array used by
+ * the bbattery_RepeatXxx() functions. Returns 0 on error.
+ */
+static int parse_tests(int * p_rep, int num_tests, const char * p_tests)
 {
-    return simplerandom_lfsr113_next(&lfsr113_state);
-}
+    char      * p_end;
+    long        first;
+    long        last;
+    long        i;
 
-unsigned int lfsr88_function(void)
-{
-    return simplerandom_lfsr88_next(&lfsr88_state);
+    for (;;)
+    {
+        first = strtol(p_tests, &p_end, 10);
+        if (p_end == p_tests)
+            return 0;
+        last = first;
+        if (*p_end == '-')
+        {
+            p_tests = p_end + 1;
+            last = strtol(p_tests, &p_end, 10);
+            if (p_end == p_tests)
+                return 0;
+        }
+        if (first < 1 || last > num_tests || first > last)
+            return 0;
+        for (i = first; i <= last; i++)
+        {
+            p_rep[i] = 1;
+        }
+        if (*p_end == '\0')
+            return 1;
+        if (*p_end != ',')
+            return 0;
+        p_tests = p_end + 1;
+    }
 }
 
-int main (void)
+int main (int argc, char * argv[])
 {
     unif01_Gen *gen;
+    const Generator_t * p_generator = NULL;
+    const char * p_battery;
+    const char * p_program = argv[0];
+    int         rep[NUM_TESTS_BIGCRUSH + 1];
+    int         num_tests;
+    uint32_t    part = 0;
+    uint32_t    seeds[MAX_SEEDS];
+    char      * p_end;
+    size_t      i;
+
+    if (argc >= 3 && strcmp(argv[1], "-p") == 0)
+    {
+        part = (uint32_t)strtoul(argv[2], &p_end, 10);
+        if (*argv[2] == '\0' || *p_end != '\0')
+        {
+            fprintf(stderr, "%s: invalid part '%s'\n", p_program, argv[2]);
+            return 2;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc < 3 || argc > 4)
+    {
+        fprintf(stderr, "Usage: %s [-p PART] GENERATOR SmallCrush|Crush|BigCrush [TESTS]\n", p_program);
+        return 2;
+    }
+    for (i = 0; i < sizeof(generators) / sizeof(generators[0]); i++)
+    {
+        if (strcmp(argv[1], generators[i].name) == 0)
+            p_generator = &generators[i];
+    }
+    p_battery = argv[2];
+    if (strcmp(p_battery, "SmallCrush") == 0)
+        num_tests = NUM_TESTS_SMALLCRUSH;
+    else if (strcmp(p_battery, "Crush") == 0)
+        num_tests = NUM_TESTS_CRUSH;
+    else if (strcmp(p_battery, "BigCrush") == 0)
+        num_tests = NUM_TESTS_BIGCRUSH;
+    else
+        num_tests = 0;
+    if (p_generator == NULL || num_tests == 0)
+    {
+        fprintf(stderr, "%s: unknown generator or battery\n", p_program);
+        return 2;
+    }
+    memset(rep, 0, sizeof(rep));
+    if (argc == 4 && !parse_tests(rep, num_tests, argv[3]))
+    {
+        fprintf(stderr, "%s: invalid test list '%s'\n", p_program, argv[3]);
+        return 2;
+    }
+
+    /* Initialise the generator, and show the seeds used */
+    part_seeds(p_generator, part, seeds);
+    p_generator->seed(seeds, p_generator->num_seeds);
+    if (part == 0)
+        printf("Seeds:");
+    else
+        printf("Seeds (part %lu):", (unsigned long)part);
+    for (i = 0; i < p_generator->num_seeds; i++)
+    {
+        printf(" %lu", (unsigned long)seeds[i]);
+    }
+    printf("\n\n");
+    fflush(stdout);
 
-    /* Initialise all generators */
-    simplerandom_cong_seed(&cong_state, UINT32_C(2051391225));
-    simplerandom_shr3_seed(&shr3_state, UINT32_C(3360276411));
-    simplerandom_mwc1_seed(&mwc1_state, UINT32_C(12345), UINT32_C(65437));
-    simplerandom_mwc2_seed(&mwc2_state, UINT32_C(12345), UINT32_C(65437));
-    simplerandom_mwc64_seed(&mwc64_state, UINT32_C(7654321), UINT32_C(521288629));
-    simplerandom_kiss_seed(&kiss_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
-    simplerandom_kiss2_seed(&kiss2_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
-    simplerandom_lfsr113_seed(&lfsr113_state, 0, 0, 0, 0);
-    simplerandom_lfsr88_seed(&lfsr88_state, 0, 0, 0);
-
-    //gen = unif01_CreateExternGenBits ("cong", cong_function);
-    //gen = unif01_CreateExternGenBits ("shr3", shr3_function);
-    //gen = unif01_CreateExternGenBits ("mwc1", mwc1_function);
-    gen = unif01_CreateExternGenBits ("mwc2", mwc2_function);
-    //gen = unif01_CreateExternGenBits ("mwc64", mwc64_function);
-    //gen = unif01_CreateExternGenBits ("kiss", kiss_function);
-    //gen = unif01_CreateExternGenBits ("kiss2", kiss2_function);
-    //gen = unif01_CreateExternGenBits ("lfsr113", lfsr113_function);
-    //gen = unif01_CreateExternGenBits ("lfsr88", lfsr88_function);
-
-    //bbattery_SmallCrush (gen);
-    bbattery_Crush (gen);
-    //bbattery_BigCrush (gen);
+    gen = unif01_CreateExternGenBits ((char *)p_generator->name, p_generator->function);
+
+    if (argc == 4)
+    {
+        if (num_tests == NUM_TESTS_SMALLCRUSH)
+            bbattery_RepeatSmallCrush (gen, rep);
+        else if (num_tests == NUM_TESTS_CRUSH)
+            bbattery_RepeatCrush (gen, rep);
+        else
+            bbattery_RepeatBigCrush (gen, rep);
+    }
+    else
+    {
+        if (num_tests == NUM_TESTS_SMALLCRUSH)
+            bbattery_SmallCrush (gen);
+        else if (num_tests == NUM_TESTS_CRUSH)
+            bbattery_Crush (gen);
+        else
+            bbattery_BigCrush (gen);
+    }
 
     unif01_DeleteExternGenBits (gen);
 
     return 0;
 }
-
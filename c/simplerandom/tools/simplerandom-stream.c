@@ -0,0 +1,513 @@
+/*
+ * simplerandom-stream.c
+ *
+ * Write the output of a simplerandom generator to stdout, as a raw binary
+ * stream of unsigned 32-bit values in native byte order. This is intended to
+ * be piped into external statistical test programs, such as PractRand
+ * ("RNG_test stdin32") or dieharder ("-g 200").
+ *
+ * Usage:
+ *     simplerandom-stream [--streams=N] [--count=N] GENERATOR [SEED ...]
+ *
+ * GENERATOR is one of: cong shr3 mwc1 mwc2 kiss mwc64 kiss2 kiss64 lfsr113 lfsr88
+ *     cmwc4096 lfib4 swb
+ *
+ * kiss64 gives 64-bit values. Each is output as two 32-bit values, low word
+ * first, as for simplerandom_zzz_next64() of the other generators.
+ *
+ * The seeds are given in decimal, or hex with a "0x" prefix. They are used as
+ * for simplerandom_zzz_seed_array(), with any extra seeds mixed into the
+ * state. Missing seeds are 0.
+ *
+ * --streams=N outputs N independent streams interleaved, one value from each
+ * in turn. Stream k (from 0) is seeded with the given seeds followed by k, as
+ * an extra seed that is mixed into the state.
+ *
+ * --count=N stops after N values (from all streams). By default, the output
+ * continues until the reader closes the pipe.
+ *
+ * N is given in decimal, or hex with a "0x" prefix. It must be at least 1, and
+ * for --streams, at most 65536. Otherwise the usage message is printed and the
+ * exit status is 2.
+ *
+ * Values are generated with simplerandom_zzz_fill() into large page-aligned
+ * buffers. When stdout is a pipe, the buffers are passed to the pipe with
+ * vmsplice() where available, which avoids copying the data. The pipe then
+ * holds references to the buffer pages rather than copies, so a buffer must
+ * not be refilled until the reader has consumed it. Two buffers are used
+ * alternately, and each one that is spliced must be at least as big as the
+ * pipe capacity. Then once a buffer has been completely spliced into the
+ * pipe, it fills the pipe, so the reader must have consumed the previous
+ * buffer, and that buffer can safely be refilled. If that can't be ensured,
+ * write() is used instead.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#define _GNU_SOURCE
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef HAVE_VMSPLICE
+#include <sys/uio.h>
+#endif
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Size of each output buffer, in bytes. This is also the pipe size used with
+ * vmsplice(). It must be a multiple of the page size, and no more than the
+ * system's maximum pipe size (/proc/sys/fs/pipe-max-size, default 1 MiB). */
+#define STREAM_BUF_SIZE         (256u * 1024u)
+#define STREAM_BUF_VALUES       (STREAM_BUF_SIZE / sizeof(uint32_t))
+#define STREAM_NUM_BUFS         2u
+
+#define STREAM_MAX_SEEDS        16u
+#define STREAM_MAX_STREAMS      STREAM_BUF_VALUES
+
+/* Number of 64-bit values KISS64 generates at a time. */
+#define STREAM_KISS64_CHUNK     256u
+
+/* Stream state for KISS64. When a 64-bit value has been generated but only
+ * its low word output, its high word is kept to be output next. */
+#ifdef UINT64_C
+typedef struct
+{
+    SimpleRandomKISS64_t    kiss64;
+    uint32_t                high;
+    bool                    have_high;
+} StreamKISS64_t;
+#endif
+
+typedef union
+{
+    SimpleRandomCong_t      cong;
+    SimpleRandomSHR3_t      shr3;
+    SimpleRandomMWC1_t      mwc1;
+    SimpleRandomMWC2_t      mwc2;
+    SimpleRandomKISS_t      kiss;
+#ifdef UINT64_C
+    SimpleRandomMWC64_t     mwc64;
+    SimpleRandomKISS2_t     kiss2;
+    StreamKISS64_t          kiss64;
+    SimpleRandomCMWC4096_t  cmwc4096;
+#endif
+    SimpleRandomLFSR113_t   lfsr113;
+    SimpleRandomLFSR88_t    lfsr88;
+    SimpleRandomLFIB4_t     lfib4;
+    SimpleRandomSWB_t       swb;
+} StreamState_t;
+
+/* The states of the streams are stored 'state_size' bytes apart, the size of
+ * the generator's own state rather than of StreamState_t, so many streams of
+ * a small generator don't each take the space of the largest. */
+typedef struct
+{
+    const char    * p_name;
+    void          (*p_seed)(StreamState_t * p_state, const uint32_t * p_seeds, size_t num_seeds);
+    void          (*p_fill)(StreamState_t * p_state, uint32_t * p_out, size_t num_out);
+    size_t          state_size;
+} StreamGenerator_t;
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+#define STREAM_GENERATOR_FUNCTIONS(zzz, member) \
+static void zzz##_stream_seed(StreamState_t * p_state, const uint32_t * p_seeds, size_t num_seeds) \
+{ \
+    simplerandom_##zzz##_seed_array(&p_state->member, p_seeds, num_seeds, true); \
+} \
+static void zzz##_stream_fill(StreamState_t * p_state, uint32_t * p_out, size_t num_out) \
+{ \
+    simplerandom_##zzz##_fill(&p_state->member, p_out, num_out); \
+}
+
+STREAM_GENERATOR_FUNCTIONS(cong, cong)
+STREAM_GENERATOR_FUNCTIONS(shr3, shr3)
+STREAM_GENERATOR_FUNCTIONS(mwc1, mwc1)
+STREAM_GENERATOR_FUNCTIONS(mwc2, mwc2)
+STREAM_GENERATOR_FUNCTIONS(kiss, kiss)
+#ifdef UINT64_C
+STREAM_GENERATOR_FUNCTIONS(mwc64, mwc64)
+STREAM_GENERATOR_FUNCTIONS(kiss2, kiss2)
+
+static void kiss64_stream_seed(StreamState_t * p_state, const uint32_t * p_seeds, size_t num_seeds)
+{
+    simplerandom_kiss64_seed_array(&p_state->kiss64.kiss64, p_seeds, num_seeds, true);
+    p_state->kiss64.have_high = false;
+}
+
+static void kiss64_stream_fill(StreamState_t * p_state, uint32_t * p_out, size_t num_out)
+{
+    StreamKISS64_t    * p_kiss64 = &p_state->kiss64;
+    uint64_t            values[STREAM_KISS64_CHUNK];
+    uint64_t            value;
+    size_t              num_values;
+    size_t              i;
+
+    if (num_out != 0 && p_kiss64->have_high)
+    {
+        *p_out++ = p_kiss64->high;
+        num_out--;
+        p_kiss64->have_high = false;
+    }
+    while (num_out >= 2u)
+    {
+        num_values = num_out / 2u;
+        if (num_values > STREAM_KISS64_CHUNK)
+            num_values = STREAM_KISS64_CHUNK;
+        simplerandom_kiss64_fill(&p_kiss64->kiss64, values, num_values);
+        for (i = 0; i < num_values; i++)
+        {
+            p_out[2u * i] = (uint32_t)values[i];
+            p_out[2u * i + 1u] = (uint32_t)(values[i] >> 32u);
+        }
+        p_out += 2u * num_values;
+        num_out -= 2u * num_values;
+    }
+    if (num_out != 0)
+    {
+        value = simplerandom_kiss64_next(&p_kiss64->kiss64);
+        *p_out = (uint32_t)value;
+        p_kiss64->high = (uint32_t)(value >> 32u);
+        p_kiss64->have_high = true;
+    }
+}
+#endif
+#ifdef UINT64_C
+STREAM_GENERATOR_FUNCTIONS(cmwc4096, cmwc4096)
+#endif
+STREAM_GENERATOR_FUNCTIONS(lfsr113, lfsr113)
+STREAM_GENERATOR_FUNCTIONS(lfsr88, lfsr88)
+STREAM_GENERATOR_FUNCTIONS(lfib4, lfib4)
+STREAM_GENERATOR_FUNCTIONS(swb, swb)
+
+#define STREAM_GENERATOR(zzz)   { #zzz, zzz##_stream_seed, zzz##_stream_fill, sizeof(((StreamState_t *)0)->zzz) }
+
+static const StreamGenerator_t stream_generators[] =
+{
+    STREAM_GENERATOR(cong),
+    STREAM_GENERATOR(shr3),
+    STREAM_GENERATOR(mwc1),
+    STREAM_GENERATOR(mwc2),
+    STREAM_GENERATOR(kiss),
+#ifdef UINT64_C
+    STREAM_GENERATOR(mwc64),
+    STREAM_GENERATOR(kiss2),
+    STREAM_GENERATOR(kiss64),
+    STREAM_GENERATOR(cmwc4096),
+#endif
+    STREAM_GENERATOR(lfsr113),
+    STREAM_GENERATOR(lfsr88),
+    STREAM_GENERATOR(lfib4),
+    STREAM_GENERATOR(swb),
+};
+
+/* The state of stream 'k'. */
+static StreamState_t * stream_state(const StreamGenerator_t * p_gen, void * p_states, size_t k)
+{
+    return (StreamState_t *)((uint8_t *)p_states + k * p_gen->state_size);
+}
+
+static void usage(const char * p_program)
+{
+    size_t      i;
+
+    fprintf(stderr, "Usage: %s [--streams=N] [--count=N] GENERATOR [SEED ...]\n", p_program);
+    fprintf(stderr, "Generators:");
+    for (i = 0; i < sizeof(stream_generators) / sizeof(stream_generators[0]); i++)
+    {
+        fprintf(stderr, " %s", stream_generators[i].p_name);
+    }
+    fprintf(stderr, "\n");
+}
+
+/* Parse a number for an option, in decimal, or hex with a "0x" prefix. It
+ * must be from 1 to 'max'. Returns false if it isn't a valid number in range.
+ */
+static bool parse_option_number(const char * p_str, uintmax_t max, uintmax_t * p_value)
+{
+    char      * p_end;
+    uintmax_t   value;
+
+    if (*p_str < '0' || *p_str > '9')
+        return false;
+    errno = 0;
+    value = strtoumax(p_str, &p_end, 0);
+    if (errno != 0 || *p_end != '\0' || value < 1u || value > max)
+        return false;
+    *p_value = value;
+    return true;
+}
+
+/* Fill the buffer with 'num_values' values, interleaved from all the streams.
+ * 'num_values' must be a multiple of 'num_streams'.
+ */
+static void stream_fill(const StreamGenerator_t * p_gen, void * p_states, size_t num_streams,
+                        uint32_t * p_out, uint32_t * p_scratch, size_t num_values)
+{
+    size_t      per_stream;
+    size_t      i;
+    size_t      k;
+
+    if (num_streams == 1u)
+    {
+        p_gen->p_fill(stream_state(p_gen, p_states, 0), p_out, num_values);
+        return;
+    }
+    per_stream = num_values / num_streams;
+    for (k = 0; k < num_streams; k++)
+    {
+        p_gen->p_fill(stream_state(p_gen, p_states, k), p_scratch, per_stream);
+        for (i = 0; i < per_stream; i++)
+        {
+            p_out[i * num_streams + k] = p_scratch[i];
+        }
+    }
+}
+
+/* Returns false on error, or if the reader has closed the pipe. */
+static bool stream_write(int fd, const uint8_t * p_data, size_t len)
+{
+    ssize_t     result;
+
+    while (len)
+    {
+        result = write(fd, p_data, len);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        p_data += result;
+        len -= (size_t)result;
+    }
+    return true;
+}
+
+#ifdef HAVE_VMSPLICE
+
+/* Returns true if vmsplice() can be used safely for this file descriptor,
+ * with our double buffering, when each buffer spliced is 'splice_size' bytes.
+ * The pipe capacity is set to the buffer size if possible, and it must be no
+ * more than 'splice_size', rounded up to whole pages since each page of a
+ * buffer takes up a whole pipe slot.
+ */
+static bool stream_vmsplice_init(int fd, size_t splice_size)
+{
+#if defined(F_SETPIPE_SZ) && defined(F_GETPIPE_SZ)
+    struct stat     stat_buf;
+    size_t          page_size;
+    int             pipe_size;
+
+    if (fstat(fd, &stat_buf) != 0 || !S_ISFIFO(stat_buf.st_mode))
+        return false;
+    (void)fcntl(fd, F_SETPIPE_SZ, (int)STREAM_BUF_SIZE);
+    pipe_size = fcntl(fd, F_GETPIPE_SZ);
+    page_size = (size_t)sysconf(_SC_PAGESIZE);
+    return (pipe_size > 0 &&
+            (size_t)pipe_size <= (splice_size + page_size - 1u) / page_size * page_size);
+#else
+    (void)fd;
+    (void)splice_size;
+    return false;
+#endif
+}
+
+static bool stream_vmsplice(int fd, const uint8_t * p_data, size_t len)
+{
+    struct iovec    iov;
+    ssize_t         result;
+
+    while (len)
+    {
+        iov.iov_base = (void *)p_data;
+        iov.iov_len = len;
+        result = vmsplice(fd, &iov, 1u, 0);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        p_data += result;
+        len -= (size_t)result;
+    }
+    return true;
+}
+
+#endif /* defined(HAVE_VMSPLICE) */
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    const StreamGenerator_t * p_gen = NULL;
+    void                  * p_states = NULL;
+    uint32_t                seeds[STREAM_MAX_SEEDS + 1u];
+    size_t                  num_seeds = 0;
+    size_t                  num_streams = 1u;
+    uintmax_t               count = 0;
+    uintmax_t               value;
+    uintmax_t               remaining;
+    uint32_t              * p_bufs[STREAM_NUM_BUFS] = { NULL };
+    uint32_t              * p_scratch = NULL;
+    size_t                  buf_index = 0;
+    size_t                  row_values;
+    size_t                  num_values;
+    bool                    use_vmsplice = false;
+    bool                    ok = true;
+    char                  * p_end;
+    int                     status = 1;
+    int                     argi;
+    size_t                  i;
+
+    for (argi = 1; argi < argc && strncmp(argv[argi], "--", 2u) == 0; argi++)
+    {
+        if (strncmp(argv[argi], "--streams=", 10u) == 0)
+        {
+            if (!parse_option_number(argv[argi] + 10u, STREAM_MAX_STREAMS, &value))
+            {
+                usage(argv[0]);
+                return 2;
+            }
+            num_streams = (size_t)value;
+        }
+        else if (strncmp(argv[argi], "--count=", 8u) == 0)
+        {
+            if (!parse_option_number(argv[argi] + 8u, UINTMAX_MAX, &count))
+            {
+                usage(argv[0]);
+                return 2;
+            }
+        }
+        else
+            break;
+    }
+    if (argi < argc)
+    {
+        for (i = 0; i < sizeof(stream_generators) / sizeof(stream_generators[0]); i++)
+        {
+            if (strcmp(argv[argi], stream_generators[i].p_name) == 0)
+                p_gen = &stream_generators[i];
+        }
+        argi++;
+    }
+    for (; argi < argc && num_seeds < STREAM_MAX_SEEDS; argi++)
+    {
+        seeds[num_seeds++] = (uint32_t)strtoul(argv[argi], &p_end, 0);
+        if (*p_end != '\0')
+            break;
+    }
+    if (p_gen == NULL || argi < argc)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    p_states = calloc(num_streams, p_gen->state_size);
+    if (p_states == NULL)
+        goto done;
+    for (i = 0; i < num_streams; i++)
+    {
+        if (num_streams == 1u)
+        {
+            p_gen->p_seed(stream_state(p_gen, p_states, i), seeds, num_seeds);
+        }
+        else
+        {
+            seeds[num_seeds] = (uint32_t)i;
+            p_gen->p_seed(stream_state(p_gen, p_states, i), seeds, num_seeds + 1u);
+        }
+    }
+
+    for (i = 0; i < STREAM_NUM_BUFS; i++)
+    {
+        if (posix_memalign((void **)&p_bufs[i], (size_t)sysconf(_SC_PAGESIZE), STREAM_BUF_SIZE) != 0)
+        {
+            p_bufs[i] = NULL;
+            goto done;
+        }
+    }
+    if (num_streams > 1u)
+    {
+        p_scratch = malloc(STREAM_BUF_SIZE);
+        if (p_scratch == NULL)
+            goto done;
+    }
+
+    /* Each buffer holds a whole number of rows, of one value per stream. */
+    row_values = STREAM_BUF_VALUES / num_streams * num_streams;
+
+    /* Report a closed pipe as a write error (EPIPE), so we can stop quietly. */
+    signal(SIGPIPE, SIG_IGN);
+#ifdef HAVE_VMSPLICE
+    use_vmsplice = stream_vmsplice_init(STDOUT_FILENO, row_values * sizeof(uint32_t));
+#endif
+
+    remaining = count;
+    while (ok)
+    {
+        num_values = row_values;
+        if (count != 0)
+        {
+            if (remaining == 0)
+                break;
+            if (remaining < num_values)
+                num_values = (size_t)remaining;
+            remaining -= num_values;
+        }
+        /* For a count that isn't a multiple of the number of streams,
+         * generate a whole row and output only part of it. */
+        stream_fill(p_gen, p_states, num_streams, p_bufs[buf_index], p_scratch,
+                    (num_values + num_streams - 1u) / num_streams * num_streams);
+        /* Only a full buffer is sure to fill the pipe, so a short last
+         * buffer (for a count) is written instead. */
+#ifdef HAVE_VMSPLICE
+        if (use_vmsplice && num_values == row_values)
+            ok = stream_vmsplice(STDOUT_FILENO, (const uint8_t *)p_bufs[buf_index], num_values * sizeof(uint32_t));
+        else
+#endif
+            ok = stream_write(STDOUT_FILENO, (const uint8_t *)p_bufs[buf_index], num_values * sizeof(uint32_t));
+        buf_index = (buf_index + 1u) % STREAM_NUM_BUFS;
+    }
+
+    if (!ok && errno != EPIPE)
+        perror(argv[0]);
+    else
+        status = 0;
+
+done:
+    free(p_scratch);
+    for (i = 0; i < STREAM_NUM_BUFS; i++)
+    {
+        free(p_bufs[i]);
+    }
+    free(p_states);
+    return status;
+}
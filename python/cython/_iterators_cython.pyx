@@ -5,7 +5,29 @@ cdef extern from "types.h":
     ctypedef unsigned long uint64_t
     ctypedef unsigned int uint32_t
 
-from simplerandom._bitcolumnmatrix import BitColumnMatrix
+cdef extern from "simplerandom-c.h":
+    ctypedef struct SimpleRandomCong_t:
+        uint32_t cong
+    ctypedef struct SimpleRandomSHR3_t:
+        uint32_t shr3
+    ctypedef struct SimpleRandomMWC2_t:
+        uint32_t mwc_upper
+        uint32_t mwc_lower
+    ctypedef struct SimpleRandomMWC64_t:
+        uint32_t mwc_upper
+        uint32_t mwc_lower
+
+    void simplerandom_cong_discard(SimpleRandomCong_t * p_cong, uint64_t n) nogil
+    void simplerandom_shr3_discard(SimpleRandomSHR3_t * p_shr3, uint64_t n) nogil
+    void simplerandom_mwc2_discard(SimpleRandomMWC2_t * p_mwc, uint64_t n) nogil
+    void simplerandom_mwc64_discard(SimpleRandomMWC64_t * p_mwc, uint64_t n) nogil
+
+cdef extern from "bitcolumnmatrix.h":
+    ctypedef struct BitColumnMatrix32_t:
+        uint32_t matrix[32]
+
+    uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right) nogil
+    void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_matrix, uint64_t n) nogil
 
 __all__ = [
     "Cong",
@@ -178,6 +200,19 @@ cdef class Cong(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t cong = self.cong
+        with nogil:
+            for i in range(out.shape[0]):
+                cong = CONG_MULT * cong + CONG_CONST
+                out[i] = cong
+        self.cong = cong
+
     def getstate(self):
         return (self.cong, )
 
@@ -185,37 +220,37 @@ cdef class Cong(object):
         self.cong = int(state[0]) & 0xFFFFFFFFu
 
     def jumpahead(self, n):
-        # Cong.jumpahead(n) = r**n * x mod 2**32 +
-        #                      c * (1 + r + r**2 + ... + r**(n-1)) mod 2**32
-        # where r = 69069 and c = 12345.
-        #
-        # The part c * (1 + r + r**2 + ... + r**(n-1)) is a geometric series.
-        # For calculating geometric series mod 2**32, see:
-        # http://www.codechef.com/wiki/tutorial-just-simple-sum#Back_to_the_geometric_series
-        cdef uint32_t n_int
-        cdef uint32_t mult_exp
-        cdef uint32_t add_const_part
-        cdef uint32_t add_const
-
-        n_int = n % CONG_CYCLE_LEN
-        mult_exp = CONG_MULT**n_int
-        add_const_part = _geom_series_uint32(CONG_MULT, n_int)
-        add_const = add_const_part * CONG_CONST
-        self.cong = mult_exp * self.cong + add_const
+        cdef SimpleRandomCong_t rng_cong
+
+        rng_cong.cong = self.cong
+        simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+        self.cong = rng_cong.cong
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomCong_t rng_cong
+        cdef Cong rng
+
+        result = []
+        for n in ns:
+            rng_cong.cong = self.cong
+            simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+            rng = Cong.__new__(type(self))
+            rng.cong = rng_cong.cong
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return self.__class__.__name__ + "(" + repr(int(self.cong)) + ")"
 
 
 cdef uint32_t SHR3_CYCLE_LEN = 2u**32u - 1u
-_SHR3_MATRIX_COLUMNS = [
-    0x00042021, 0x00084042, 0x00108084, 0x00210108, 0x00420231, 0x00840462, 0x010808C4, 0x02101188,
-    0x04202310, 0x08404620, 0x10808C40, 0x21011880, 0x42023100, 0x84046200, 0x0808C400, 0x10118800,
-    0x20231000, 0x40462021, 0x808C4042, 0x01080084, 0x02100108, 0x04200210, 0x08400420, 0x10800840,
-    0x21001080, 0x42002100, 0x84004200, 0x08008400, 0x10010800, 0x20021000, 0x40042000, 0x80084000,
-]
-
-_SHR3_MATRIX = BitColumnMatrix(_SHR3_MATRIX_COLUMNS)
 
 cdef class SHR3(object):
     '''3-shift-register random number generator
@@ -285,6 +320,21 @@ cdef class SHR3(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t shr3 = self.shr3
+        with nogil:
+            for i in range(out.shape[0]):
+                shr3 ^= shr3 << 13u
+                shr3 ^= shr3 >> 17u
+                shr3 ^= shr3 << 5u
+                out[i] = shr3
+        self.shr3 = shr3
+
     def getstate(self):
         return (self.shr3, )
 
@@ -293,10 +343,31 @@ cdef class SHR3(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        cdef uint32_t n_shr3
-        n_shr3 = n % SHR3_CYCLE_LEN
-        shr3 = pow(_SHR3_MATRIX, n_shr3) * self.shr3
-        self.shr3 = shr3
+        cdef SimpleRandomSHR3_t rng_shr3
+
+        rng_shr3.shr3 = self.shr3
+        simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+        self.shr3 = rng_shr3.shr3
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomSHR3_t rng_shr3
+        cdef SHR3 rng
+
+        result = []
+        for n in ns:
+            rng_shr3.shr3 = self.shr3
+            simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+            rng = SHR3.__new__(type(self))
+            rng.shr3 = rng_shr3.shr3
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return self.__class__.__name__ + "(" + repr(int(self.shr3)) + ")"
@@ -308,6 +379,9 @@ cdef uint32_t _MWC_UPPER_MODULO = _MWC_UPPER_MULT * 2u**16u - 1u
 cdef uint32_t _MWC_LOWER_MODULO = _MWC_LOWER_MULT * 2u**16u - 1u
 cdef uint32_t _MWC_UPPER_CYCLE_LEN = _MWC_UPPER_MULT * 2u**16u // 2u - 1u
 cdef uint32_t _MWC_LOWER_CYCLE_LEN = _MWC_LOWER_MULT * 2u**16u // 2u - 1u
+# Combined cycle length of the upper and lower parts. A jumpahead value reduced
+# modulo this is correct for both parts.
+cdef uint64_t _MWC_CYCLE_LEN = <uint64_t>_MWC_UPPER_CYCLE_LEN * _MWC_LOWER_CYCLE_LEN
 
 cdef class MWC1(object):
     '''"Multiply-with-carry" random number generator
@@ -426,6 +500,22 @@ cdef class MWC1(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t mwc_upper = self.mwc_upper
+        cdef uint32_t mwc_lower = self.mwc_lower
+        with nogil:
+            for i in range(out.shape[0]):
+                mwc_upper = 36969u * (mwc_upper & 0xFFFFu) + (mwc_upper >> 16u)
+                mwc_lower = 18000u * (mwc_lower & 0xFFFFu) + (mwc_lower >> 16u)
+                out[i] = (mwc_upper << 16u) + mwc_lower
+        self.mwc_upper = mwc_upper
+        self.mwc_lower = mwc_lower
+
     def getstate(self):
         return (self.mwc_upper, self.mwc_lower)
 
@@ -435,13 +525,35 @@ cdef class MWC1(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        cdef uint64_t n_int
-        n_int = n % _MWC_UPPER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_upper = pow(<uint64_t>_MWC_UPPER_MULT, n_int, <uint64_t>_MWC_UPPER_MODULO) * self.mwc_upper % _MWC_UPPER_MODULO
-        n_int = n % _MWC_LOWER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_lower = pow(<uint64_t>_MWC_LOWER_MULT, n_int, <uint64_t>_MWC_LOWER_MODULO) * self.mwc_lower % _MWC_LOWER_MODULO
+        cdef SimpleRandomMWC2_t rng_mwc
+
+        rng_mwc.mwc_upper = self.mwc_upper
+        rng_mwc.mwc_lower = self.mwc_lower
+        simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+        self.mwc_upper = rng_mwc.mwc_upper
+        self.mwc_lower = rng_mwc.mwc_lower
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomMWC2_t rng_mwc
+        cdef MWC1 rng
+
+        result = []
+        for n in ns:
+            rng_mwc.mwc_upper = self.mwc_upper
+            rng_mwc.mwc_lower = self.mwc_lower
+            simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+            rng = MWC1.__new__(type(self))
+            rng.mwc_upper = rng_mwc.mwc_upper
+            rng.mwc_lower = rng_mwc.mwc_lower
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return self.__class__.__name__ + "(" + repr(int(self.mwc_upper)) + "," + repr(int(self.mwc_lower)) + ")"
@@ -552,6 +664,22 @@ cdef class MWC2(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t mwc_upper = self.mwc_upper
+        cdef uint32_t mwc_lower = self.mwc_lower
+        with nogil:
+            for i in range(out.shape[0]):
+                mwc_upper = 36969u * (mwc_upper & 0xFFFFu) + (mwc_upper >> 16u)
+                mwc_lower = 18000u * (mwc_lower & 0xFFFFu) + (mwc_lower >> 16u)
+                out[i] = (mwc_upper << 16u) + (mwc_upper >> 16u) + mwc_lower
+        self.mwc_upper = mwc_upper
+        self.mwc_lower = mwc_lower
+
     def getstate(self):
         return (self.mwc_upper, self.mwc_lower)
 
@@ -561,13 +689,35 @@ cdef class MWC2(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        cdef uint64_t n_int
-        n_int = n % _MWC_UPPER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_upper = pow(<uint64_t>_MWC_UPPER_MULT, n_int, <uint64_t>_MWC_UPPER_MODULO) * self.mwc_upper % _MWC_UPPER_MODULO
-        n_int = n % _MWC_LOWER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_lower = pow(<uint64_t>_MWC_LOWER_MULT, n_int, <uint64_t>_MWC_LOWER_MODULO) * self.mwc_lower % _MWC_LOWER_MODULO
+        cdef SimpleRandomMWC2_t rng_mwc
+
+        rng_mwc.mwc_upper = self.mwc_upper
+        rng_mwc.mwc_lower = self.mwc_lower
+        simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+        self.mwc_upper = rng_mwc.mwc_upper
+        self.mwc_lower = rng_mwc.mwc_lower
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomMWC2_t rng_mwc
+        cdef MWC2 rng
+
+        result = []
+        for n in ns:
+            rng_mwc.mwc_upper = self.mwc_upper
+            rng_mwc.mwc_lower = self.mwc_lower
+            simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+            rng = MWC2.__new__(type(self))
+            rng.mwc_upper = rng_mwc.mwc_upper
+            rng.mwc_lower = rng_mwc.mwc_lower
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return self.__class__.__name__ + "(" + repr(int(self.mwc_upper)) + "," + repr(int(self.mwc_lower)) + ")"
@@ -665,6 +815,24 @@ cdef class MWC64(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint64_t temp64
+        cdef uint32_t mwc_upper = self.mwc_upper
+        cdef uint32_t mwc_lower = self.mwc_lower
+        with nogil:
+            for i in range(out.shape[0]):
+                temp64 = <uint64_t>698769069u * mwc_lower + mwc_upper
+                mwc_lower = <uint32_t>temp64
+                mwc_upper = <uint32_t>(temp64 >> 32u)
+                out[i] = mwc_lower
+        self.mwc_upper = mwc_upper
+        self.mwc_lower = mwc_lower
+
     def getstate(self):
         return (self.mwc_upper, self.mwc_lower)
 
@@ -674,14 +842,35 @@ cdef class MWC64(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        cdef uint64_t temp64
-
-        n = n % _MWC64_CYCLE_LEN
-        temp64 = (<uint64_t>self.mwc_upper << 32u) + self.mwc_lower
-        # The following calculation needs to be done in greater than 64-bit.
-        temp64 = pow(int(_MWC64_MULT), n, int(_MWC64_MODULO)) * temp64 % _MWC64_MODULO
-        self.mwc_lower = temp64 & 0xFFFFFFFFu
-        self.mwc_upper = (temp64 >> 32u) & 0xFFFFFFFFu
+        cdef SimpleRandomMWC64_t rng_mwc
+
+        rng_mwc.mwc_upper = self.mwc_upper
+        rng_mwc.mwc_lower = self.mwc_lower
+        simplerandom_mwc64_discard(&rng_mwc, n % _MWC64_CYCLE_LEN)
+        self.mwc_upper = rng_mwc.mwc_upper
+        self.mwc_lower = rng_mwc.mwc_lower
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomMWC64_t rng_mwc
+        cdef MWC64 rng
+
+        result = []
+        for n in ns:
+            rng_mwc.mwc_upper = self.mwc_upper
+            rng_mwc.mwc_lower = self.mwc_lower
+            simplerandom_mwc64_discard(&rng_mwc, n % _MWC64_CYCLE_LEN)
+            rng = MWC64.__new__(type(self))
+            rng.mwc_upper = rng_mwc.mwc_upper
+            rng.mwc_lower = rng_mwc.mwc_lower
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return self.__class__.__name__ + "(" + repr(int(self.mwc_upper)) + "," + repr(int(self.mwc_lower)) + ")"
@@ -837,6 +1026,32 @@ cdef class KISS(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t mwc
+        cdef uint32_t mwc_upper = self.mwc_upper
+        cdef uint32_t mwc_lower = self.mwc_lower
+        cdef uint32_t cong = self.cong
+        cdef uint32_t shr3 = self.shr3
+        with nogil:
+            for i in range(out.shape[0]):
+                mwc_upper = 36969u * (mwc_upper & 0xFFFFu) + (mwc_upper >> 16u)
+                mwc_lower = 18000u * (mwc_lower & 0xFFFFu) + (mwc_lower >> 16u)
+                mwc = (mwc_upper << 16u) + (mwc_upper >> 16u) + mwc_lower
+                cong = 69069u * cong + 12345u
+                shr3 ^= shr3 << 13u
+                shr3 ^= shr3 >> 17u
+                shr3 ^= shr3 << 5u
+                out[i] = (mwc ^ cong) + shr3
+        self.mwc_upper = mwc_upper
+        self.mwc_lower = mwc_lower
+        self.cong = cong
+        self.shr3 = shr3
+
     def getstate(self):
         return ((self.mwc_upper, self.mwc_lower), (self.cong,), (self.shr3,))
 
@@ -849,31 +1064,55 @@ cdef class KISS(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        # Cong variables
-        cdef uint32_t n_int
-        cdef uint32_t mult_exp
-        cdef uint32_t add_const_part
-        cdef uint32_t add_const
-
-        # MWC2
-        n_int = n % _MWC_UPPER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_upper = pow(<uint64_t>_MWC_UPPER_MULT, n_int, <uint64_t>_MWC_UPPER_MODULO) * self.mwc_upper % _MWC_UPPER_MODULO
-        n_int = n % _MWC_LOWER_CYCLE_LEN
-        # The following calculation needs to be done in greater than 32-bit.
-        self.mwc_lower = pow(<uint64_t>_MWC_LOWER_MULT, n_int, <uint64_t>_MWC_LOWER_MODULO) * self.mwc_lower % _MWC_LOWER_MODULO
-
-        # Cong
-        n_int = n % CONG_CYCLE_LEN
-        mult_exp = CONG_MULT**n_int
-        add_const_part = _geom_series_uint32(CONG_MULT, n_int)
-        add_const = add_const_part * CONG_CONST
-        self.cong = mult_exp * self.cong + add_const
-
-        # SHR3
-        n_int = n % SHR3_CYCLE_LEN
-        shr3 = pow(_SHR3_MATRIX, n_int) * self.shr3
-        self.shr3 = shr3
+        cdef SimpleRandomMWC2_t rng_mwc
+        cdef SimpleRandomCong_t rng_cong
+        cdef SimpleRandomSHR3_t rng_shr3
+
+        rng_mwc.mwc_upper = self.mwc_upper
+        rng_mwc.mwc_lower = self.mwc_lower
+        rng_cong.cong = self.cong
+        rng_shr3.shr3 = self.shr3
+
+        simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+        simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+        simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+
+        self.mwc_upper = rng_mwc.mwc_upper
+        self.mwc_lower = rng_mwc.mwc_lower
+        self.cong = rng_cong.cong
+        self.shr3 = rng_shr3.shr3
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomMWC2_t rng_mwc
+        cdef SimpleRandomCong_t rng_cong
+        cdef SimpleRandomSHR3_t rng_shr3
+        cdef KISS rng
+
+        result = []
+        for n in ns:
+            rng_mwc.mwc_upper = self.mwc_upper
+            rng_mwc.mwc_lower = self.mwc_lower
+            rng_cong.cong = self.cong
+            rng_shr3.shr3 = self.shr3
+
+            simplerandom_mwc2_discard(&rng_mwc, n % _MWC_CYCLE_LEN)
+            simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+            simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+
+            rng = KISS.__new__(type(self))
+            rng.mwc_upper = rng_mwc.mwc_upper
+            rng.mwc_lower = rng_mwc.mwc_lower
+            rng.cong = rng_cong.cong
+            rng.shr3 = rng_shr3.shr3
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return (self.__class__.__name__ + "(" + repr(int(self.mwc_upper)) +
@@ -1032,6 +1271,32 @@ cdef class KISS2(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint64_t temp64
+        cdef uint32_t mwc_upper = self.mwc_upper
+        cdef uint32_t mwc_lower = self.mwc_lower
+        cdef uint32_t cong = self.cong
+        cdef uint32_t shr3 = self.shr3
+        with nogil:
+            for i in range(out.shape[0]):
+                temp64 = <uint64_t>698769069u * mwc_lower + mwc_upper
+                mwc_lower = <uint32_t>temp64
+                mwc_upper = <uint32_t>(temp64 >> 32u)
+                cong = 69069u * cong + 12345u
+                shr3 ^= shr3 << 13u
+                shr3 ^= shr3 >> 17u
+                shr3 ^= shr3 << 5u
+                out[i] = mwc_lower + cong + shr3
+        self.mwc_upper = mwc_upper
+        self.mwc_lower = mwc_lower
+        self.cong = cong
+        self.shr3 = shr3
+
     def getstate(self):
         return ((self.mwc_upper, self.mwc_lower), (self.cong,), (self.shr3,))
 
@@ -1044,32 +1309,55 @@ cdef class KISS2(object):
         self.sanitise()
 
     def jumpahead(self, n):
-        # Cong variables
-        cdef uint32_t n_int
-        cdef uint32_t mult_exp
-        cdef uint32_t add_const_part
-        cdef uint32_t add_const
-        cdef uint64_t temp64
-
-        # MWC64
-        n_mwc = n % _MWC64_CYCLE_LEN
-        temp64 = (<uint64_t>self.mwc_upper << 32u) + self.mwc_lower
-        # The following calculation needs to be done in greater than 64-bit.
-        temp64 = pow(int(_MWC64_MULT), n_mwc, int(_MWC64_MODULO)) * temp64 % _MWC64_MODULO
-        self.mwc_lower = temp64 & 0xFFFFFFFFu
-        self.mwc_upper = (temp64 >> 32u) & 0xFFFFFFFFu
-
-        # Cong
-        n_int = n % CONG_CYCLE_LEN
-        mult_exp = CONG_MULT**n_int
-        add_const_part = _geom_series_uint32(CONG_MULT, n_int)
-        add_const = add_const_part * CONG_CONST
-        self.cong = mult_exp * self.cong + add_const
-
-        # SHR3
-        n_int = n % SHR3_CYCLE_LEN
-        shr3 = pow(_SHR3_MATRIX, n_int) * self.shr3
-        self.shr3 = shr3
+        cdef SimpleRandomMWC64_t rng_mwc
+        cdef SimpleRandomCong_t rng_cong
+        cdef SimpleRandomSHR3_t rng_shr3
+
+        rng_mwc.mwc_upper = self.mwc_upper
+        rng_mwc.mwc_lower = self.mwc_lower
+        rng_cong.cong = self.cong
+        rng_shr3.shr3 = self.shr3
+
+        simplerandom_mwc64_discard(&rng_mwc, n % _MWC64_CYCLE_LEN)
+        simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+        simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+
+        self.mwc_upper = rng_mwc.mwc_upper
+        self.mwc_lower = rng_mwc.mwc_lower
+        self.cong = rng_cong.cong
+        self.shr3 = rng_shr3.shr3
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef SimpleRandomMWC64_t rng_mwc
+        cdef SimpleRandomCong_t rng_cong
+        cdef SimpleRandomSHR3_t rng_shr3
+        cdef KISS2 rng
+
+        result = []
+        for n in ns:
+            rng_mwc.mwc_upper = self.mwc_upper
+            rng_mwc.mwc_lower = self.mwc_lower
+            rng_cong.cong = self.cong
+            rng_shr3.shr3 = self.shr3
+
+            simplerandom_mwc64_discard(&rng_mwc, n % _MWC64_CYCLE_LEN)
+            simplerandom_cong_discard(&rng_cong, n % CONG_CYCLE_LEN)
+            simplerandom_shr3_discard(&rng_shr3, n % SHR3_CYCLE_LEN)
+
+            rng = KISS2.__new__(type(self))
+            rng.mwc_upper = rng_mwc.mwc_upper
+            rng.mwc_lower = rng_mwc.mwc_lower
+            rng.cong = rng_cong.cong
+            rng.shr3 = rng_shr3.shr3
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return (self.__class__.__name__ + "(" + repr(int(self.mwc_upper)) +
@@ -1128,6 +1416,20 @@ def lfsr_validate_one_seed(seed, uint32_t min_value_shift):
         seed ^= 0xFFFFFFFFu
     return seed
 
+cdef BitColumnMatrix32_t _bitcolumnmatrix32(columns):
+    cdef BitColumnMatrix32_t result
+    cdef Py_ssize_t i
+
+    for i in range(32):
+        result.matrix[i] = columns[i]
+    return result
+
+cdef uint32_t _lfsr_discard(const BitColumnMatrix32_t * p_matrix, uint32_t z, uint64_t n):
+    cdef BitColumnMatrix32_t lfsr_mult
+
+    bitcolumnmatrix32_pow(&lfsr_mult, p_matrix, n)
+    return bitcolumnmatrix32_mul_uint32(&lfsr_mult, z)
+
 def lfsr_state_z(uint32_t z):
     cdef uint32_t work
 
@@ -1140,7 +1442,7 @@ def lfsr_repr_z(uint32_t z):
     work = z ^ (z << 16)
     return repr(int(work))
 
-_LFSR113_1_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR113_1_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000001,
     0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082, 0x00000104,
     0x00000208, 0x00000410, 0x00000820, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400,
@@ -1148,7 +1450,7 @@ _LFSR113_1_MATRIX = BitColumnMatrix([
 ])
 _LFSR113_1_CYCLE_LEN = 2**(32 - 1) - 1
 
-_LFSR113_2_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR113_2_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
     0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
     0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
@@ -1156,7 +1458,7 @@ _LFSR113_2_MATRIX = BitColumnMatrix([
 ])
 _LFSR113_2_CYCLE_LEN = 2**(32 - 3) - 1
 
-_LFSR113_3_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR113_3_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000,
     0x00008001, 0x00010002, 0x00020004, 0x00040008, 0x00080010, 0x00100020, 0x00200040, 0x00400080,
     0x00800100, 0x01000200, 0x02000400, 0x04000000, 0x08000000, 0x10000001, 0x20000002, 0x40000004,
@@ -1164,7 +1466,7 @@ _LFSR113_3_MATRIX = BitColumnMatrix([
 ])
 _LFSR113_3_CYCLE_LEN = 2**(32 - 4) - 1
 
-_LFSR113_4_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR113_4_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000,
     0x00200000, 0x00400001, 0x00800002, 0x01000004, 0x02000009, 0x04000012, 0x08000024, 0x10000048,
     0x20000090, 0x40000120, 0x80000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800,
@@ -1279,6 +1581,33 @@ cdef class LFSR113(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t b
+        cdef uint32_t z1 = self.z1
+        cdef uint32_t z2 = self.z2
+        cdef uint32_t z3 = self.z3
+        cdef uint32_t z4 = self.z4
+        with nogil:
+            for i in range(out.shape[0]):
+                b  = ((z1 << 6) ^ z1) >> 13
+                z1 = ((z1 & 0xFFFFFFFEu) << 18) ^ b
+                b  = ((z2 << 2) ^ z2) >> 27
+                z2 = ((z2 & 0xFFFFFFF8u) << 2) ^ b
+                b  = ((z3 << 13) ^ z3) >> 21
+                z3 = ((z3 & 0xFFFFFFF0u) << 7) ^ b
+                b  = ((z4 << 3) ^ z4) >> 12
+                z4 = ((z4 & 0xFFFFFF80u) << 13) ^ b
+                out[i] = z1 ^ z2 ^ z3 ^ z4
+        self.z1 = z1
+        self.z2 = z2
+        self.z3 = z3
+        self.z4 = z4
+
     def getstate(self):
         return (lfsr_state_z(self.z1), lfsr_state_z(self.z2), lfsr_state_z(self.z3), lfsr_state_z(self.z4))
 
@@ -1286,19 +1615,30 @@ cdef class LFSR113(object):
         self.seed(state)
 
     def jumpahead(self, n):
-        n_1 = int(n) % _LFSR113_1_CYCLE_LEN
-        n_2 = int(n) % _LFSR113_2_CYCLE_LEN
-        n_3 = int(n) % _LFSR113_3_CYCLE_LEN
-        n_4 = int(n) % _LFSR113_4_CYCLE_LEN
-
-        z1 = pow(_LFSR113_1_MATRIX, n_1) * self.z1
-        self.z1 = z1
-        z2 = pow(_LFSR113_2_MATRIX, n_2) * self.z2
-        self.z2 = z2
-        z3 = pow(_LFSR113_3_MATRIX, n_3) * self.z3
-        self.z3 = z3
-        z4 = pow(_LFSR113_4_MATRIX, n_4) * self.z4
-        self.z4 = z4
+        self.z1 = _lfsr_discard(&_LFSR113_1_MATRIX, self.z1, n % _LFSR113_1_CYCLE_LEN)
+        self.z2 = _lfsr_discard(&_LFSR113_2_MATRIX, self.z2, n % _LFSR113_2_CYCLE_LEN)
+        self.z3 = _lfsr_discard(&_LFSR113_3_MATRIX, self.z3, n % _LFSR113_3_CYCLE_LEN)
+        self.z4 = _lfsr_discard(&_LFSR113_4_MATRIX, self.z4, n % _LFSR113_4_CYCLE_LEN)
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef LFSR113 rng
+
+        result = []
+        for n in ns:
+            rng = LFSR113.__new__(type(self))
+            rng.z1 = _lfsr_discard(&_LFSR113_1_MATRIX, self.z1, n % _LFSR113_1_CYCLE_LEN)
+            rng.z2 = _lfsr_discard(&_LFSR113_2_MATRIX, self.z2, n % _LFSR113_2_CYCLE_LEN)
+            rng.z3 = _lfsr_discard(&_LFSR113_3_MATRIX, self.z3, n % _LFSR113_3_CYCLE_LEN)
+            rng.z4 = _lfsr_discard(&_LFSR113_4_MATRIX, self.z4, n % _LFSR113_4_CYCLE_LEN)
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return (self.__class__.__name__ + "(" + lfsr_repr_z(self.z1) +
@@ -1307,7 +1647,7 @@ cdef class LFSR113(object):
                                         "," + lfsr_repr_z(self.z4) + ")")
 
 
-_LFSR88_1_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR88_1_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002,
     0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040, 0x02000080, 0x04000100, 0x08000200,
     0x10000400, 0x20000800, 0x40001000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010,
@@ -1315,7 +1655,7 @@ _LFSR88_1_MATRIX = BitColumnMatrix([
 ])
 _LFSR88_1_CYCLE_LEN = 2**(32 - 1) - 1
 
-_LFSR88_2_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR88_2_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
     0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
     0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
@@ -1323,7 +1663,7 @@ _LFSR88_2_MATRIX = BitColumnMatrix([
 ])
 _LFSR88_2_CYCLE_LEN = 2**(32 - 3) - 1
 
-_LFSR88_3_MATRIX = BitColumnMatrix([
+cdef BitColumnMatrix32_t _LFSR88_3_MATRIX = _bitcolumnmatrix32([
     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
     0x02000001, 0x04000002, 0x08000004, 0x10000009, 0x20000012, 0x40000024, 0x80000048, 0x00000090,
     0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
@@ -1425,6 +1765,29 @@ cdef class LFSR88(object):
     def __iter__(self):
         return self
 
+    def fill(self, uint32_t[::1] out not None):
+        '''Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy
+        uint32 array) with the next len(out) values. The GIL is released
+        while the values are generated.
+        '''
+        cdef Py_ssize_t i
+        cdef uint32_t b
+        cdef uint32_t z1 = self.z1
+        cdef uint32_t z2 = self.z2
+        cdef uint32_t z3 = self.z3
+        with nogil:
+            for i in range(out.shape[0]):
+                b  = ((z1 << 13) ^ z1) >> 19
+                z1 = ((z1 & 0xFFFFFFFEu) << 12) ^ b
+                b  = ((z2 << 2) ^ z2) >> 25
+                z2 = ((z2 & 0xFFFFFFF8u) << 4) ^ b
+                b  = ((z3 << 3) ^ z3) >> 11
+                z3 = ((z3 & 0xFFFFFFF0u) << 17) ^ b
+                out[i] = z1 ^ z2 ^ z3
+        self.z1 = z1
+        self.z2 = z2
+        self.z3 = z3
+
     def getstate(self):
         return (lfsr_state_z(self.z1), lfsr_state_z(self.z2), lfsr_state_z(self.z3))
 
@@ -1432,16 +1795,28 @@ cdef class LFSR88(object):
         self.seed(state)
 
     def jumpahead(self, n):
-        n_1 = int(n) % _LFSR88_1_CYCLE_LEN
-        n_2 = int(n) % _LFSR88_2_CYCLE_LEN
-        n_3 = int(n) % _LFSR88_3_CYCLE_LEN
-
-        z1 = pow(_LFSR88_1_MATRIX, n_1) * self.z1
-        self.z1 = z1
-        z2 = pow(_LFSR88_2_MATRIX, n_2) * self.z2
-        self.z2 = z2
-        z3 = pow(_LFSR88_3_MATRIX, n_3) * self.z3
-        self.z3 = z3
+        self.z1 = _lfsr_discard(&_LFSR88_1_MATRIX, self.z1, n % _LFSR88_1_CYCLE_LEN)
+        self.z2 = _lfsr_discard(&_LFSR88_2_MATRIX, self.z2, n % _LFSR88_2_CYCLE_LEN)
+        self.z3 = _lfsr_discard(&_LFSR88_3_MATRIX, self.z3, n % _LFSR88_3_CYCLE_LEN)
+
+    def jumpahead_many(self, ns):
+        """Return a list of copies of this generator, each jumped ahead by
+        the corresponding value in 'ns'. This generator is not changed.
+
+        This is a convenience for jumpahead(): each copy is jumped on its
+        own by the same native discard function, so the cost is one jump
+        per value in 'ns'.
+        """
+        cdef LFSR88 rng
+
+        result = []
+        for n in ns:
+            rng = LFSR88.__new__(type(self))
+            rng.z1 = _lfsr_discard(&_LFSR88_1_MATRIX, self.z1, n % _LFSR88_1_CYCLE_LEN)
+            rng.z2 = _lfsr_discard(&_LFSR88_2_MATRIX, self.z2, n % _LFSR88_2_CYCLE_LEN)
+            rng.z3 = _lfsr_discard(&_LFSR88_3_MATRIX, self.z3, n % _LFSR88_3_CYCLE_LEN)
+            result.append(rng)
+        return result
 
     def __repr__(self):
         return (self.__class__.__name__ + "(" + lfsr_repr_z(self.z1) +
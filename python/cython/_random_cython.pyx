@@ -0,0 +1,99 @@
+#cython: language_level=3
+
+"""Bulk conversion kernels for simplerandom.random.
+
+These take raw unsigned 32-bit generator outputs (as produced by the
+iterators' fill() method) and convert them to the same values that the
+scalar random(), getrandbits()-based randint() and gauss() methods would
+produce, but for a whole array at once, with the GIL released.
+"""
+
+cdef extern from "types.h":
+    ctypedef unsigned long uint64_t
+    ctypedef unsigned int uint32_t
+
+from libc.math cimport cos, sin, log, sqrt, pi
+
+cdef double TWOPI = 2.0 * pi
+
+
+def _random_from_uint32(const uint32_t[::1] raw not None, double[::1] out not None,
+                        Py_ssize_t rng_n, double rng_min, double rng_range):
+    '''Combine each 'rng_n' consecutive raw values into one float in
+    [0.0, 1.0), in the same order of floating point operations as
+    _StandardRandomTemplate.random().
+    '''
+    cdef Py_ssize_t i
+    cdef Py_ssize_t j
+    cdef Py_ssize_t k
+    cdef double accum
+    cdef double accum_range
+
+    if raw.shape[0] < out.shape[0] * rng_n:
+        raise ValueError("raw buffer is too small")
+    with nogil:
+        k = 0
+        for i in range(out.shape[0]):
+            accum = 0.0
+            accum_range = 1.0
+            for j in range(rng_n):
+                accum += (raw[k] - rng_min) * accum_range
+                accum_range *= rng_range
+                k += 1
+            out[i] = accum / accum_range
+
+def _randbelow_from_uint32(const uint32_t[::1] raw not None, long long[::1] out not None,
+                           Py_ssize_t pos, uint32_t k, uint64_t n, long long start):
+    '''Rejection sampling of getrandbits(k) < n, as done by
+    random.Random._randbelow_with_getrandbits(), for k <= 32.
+    Every raw value is consumed (accepted or rejected). Accepted values
+    (offset by 'start') are written to 'out' from index 'pos'. Returns the
+    updated 'pos'.
+    '''
+    cdef Py_ssize_t i
+    cdef uint64_t r
+    cdef uint32_t shift
+
+    shift = 32u - k
+    with nogil:
+        for i in range(raw.shape[0]):
+            if pos >= out.shape[0]:
+                break
+            if k == 0:
+                r = 0
+            else:
+                r = raw[i] >> shift
+            if r < n:
+                out[pos] = start + <long long>r
+                pos += 1
+    return pos
+
+def _gauss_from_random(const double[::1] rand not None, double[::1] out not None,
+                       double mu, double sigma):
+    '''Box-Muller transform of pairs of random() values, exactly as done by
+    random.Random.gauss(). Fills 'out' with z values alternating with their
+    paired 'gauss_next' values. If len(out) is odd, the final unused
+    'gauss_next' value is returned (unscaled), otherwise None.
+    '''
+    cdef Py_ssize_t i
+    cdef Py_ssize_t num_out
+    cdef double x2pi
+    cdef double g2rad
+    cdef double z_next = 0.0
+
+    num_out = out.shape[0]
+    if rand.shape[0] < (num_out + 1) // 2 * 2:
+        raise ValueError("random buffer is too small")
+    with nogil:
+        i = 0
+        while i < num_out:
+            x2pi = rand[i] * TWOPI
+            g2rad = sqrt(-2.0 * log(1.0 - rand[i + 1]))
+            out[i] = mu + cos(x2pi) * g2rad * sigma
+            z_next = sin(x2pi) * g2rad
+            if i + 1 < num_out:
+                out[i + 1] = mu + z_next * sigma
+            i += 2
+    if num_out % 2:
+        return z_next
+    return None
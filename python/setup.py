@@ -8,6 +8,8 @@
 USE_CYTHON = True
 
 
+import os
+import shutil
 import sys
 
 from setuptools import setup
@@ -25,19 +27,55 @@ if USE_CYTHON:
 cmdclass = { }
 ext_modules = [ ]
 
+# The bulk random() kernels must round exactly as the scalar Python code does,
+# so the compiler must not contract a*b+c into a fused multiply-add.
+if sys.platform == 'win32':
+    RANDOM_COMPILE_ARGS = [ ]
+else:
+    RANDOM_COMPILE_ARGS = [ '-ffp-contract=off' ]
+
+# The iterators' jumpahead() functions use the discard functions of the C
+# library, so those C sources are compiled into the iterators extension.
+# In a git checkout they are copied from the C library into 'clib', which
+# MANIFEST.in includes, so a source distribution builds on its own.
+SIMPLERANDOM_C_LIBRARY_DIR = '../c/simplerandom'
+SIMPLERANDOM_C_DIR = 'clib'
+SIMPLERANDOM_C_FILES = [
+    'simplerandom-discard.c',
+    'bitcolumnmatrix.c',
+    'maths.c',
+    'simplerandom.h',
+    'simplerandom-c.h',
+    'simplerandom-cpp.h',
+    'bitcolumnmatrix.h',
+    'maths.h',
+]
+SIMPLERANDOM_C_SOURCES = [
+    SIMPLERANDOM_C_DIR + '/' + filename
+    for filename in SIMPLERANDOM_C_FILES if filename.endswith('.c')
+]
+
+if os.path.isdir(SIMPLERANDOM_C_LIBRARY_DIR):
+    if not os.path.isdir(SIMPLERANDOM_C_DIR):
+        os.mkdir(SIMPLERANDOM_C_DIR)
+    for filename in SIMPLERANDOM_C_FILES:
+        shutil.copy2(os.path.join(SIMPLERANDOM_C_LIBRARY_DIR, filename), SIMPLERANDOM_C_DIR)
+
 if sys.version_info[0] == 2:
     raise Exception('Python 2.x is no longer supported')
 
 if USE_CYTHON:
     ext_modules += [
-        Extension("simplerandom.iterators._iterators_cython", [ "cython/_iterators_cython.pyx" ]),
+        Extension("simplerandom.iterators._iterators_cython", [ "cython/_iterators_cython.pyx" ] + SIMPLERANDOM_C_SOURCES, include_dirs=[ SIMPLERANDOM_C_DIR ]),
         Extension("simplerandom._bitcolumnmatrix._bitcolumnmatrix_cython", [ "cython/_bitcolumnmatrix_cython.pyx" ]),
+        Extension("simplerandom.random._random_cython", [ "cython/_random_cython.pyx" ], extra_compile_args=RANDOM_COMPILE_ARGS),
     ]
     cmdclass.update({ 'build_ext': build_ext })
 else:
     ext_modules += [
-        Extension("simplerandom.iterators._iterators_cython", [ "cython/_iterators_cython.c" ]),
+        Extension("simplerandom.iterators._iterators_cython", [ "cython/_iterators_cython.c" ] + SIMPLERANDOM_C_SOURCES, include_dirs=[ SIMPLERANDOM_C_DIR ]),
         Extension("simplerandom._bitcolumnmatrix._bitcolumnmatrix_cython", [ "cython/_bitcolumnmatrix_cython.c" ]),
+        Extension("simplerandom.random._random_cython", [ "cython/_random_cython.c" ], extra_compile_args=RANDOM_COMPILE_ARGS),
     ]
 
 setup(
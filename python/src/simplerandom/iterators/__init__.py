@@ -14,6 +14,10 @@ __all__ = [
     "KISS2",
     "LFSR113",
     "LFSR88",
+    "encode_state",
+    "decode_state",
+    "save_states",
+    "load_states",
 ]
 
 try:
@@ -23,4 +27,4 @@ except ImportError:
     from simplerandom.iterators._iterators_py import *
     _using_extension = False
 
-
+from simplerandom.iterators._state import *
@@ -1,4 +1,6 @@
 
+from copy import deepcopy
+
 from simplerandom._bitcolumnmatrix import BitColumnMatrix
 
 __all__ = [
@@ -92,6 +94,27 @@ def _geom_series_uint32(r, n):
     numerator = pow(r, n, common_factor * m) - 1
     return (numerator // common_factor * other_factors_inverse) % m
 
+def _fill(rng, out):
+    """Fill a writable buffer of unsigned 32-bit integers (e.g. a NumPy uint32
+    array) with the next len(out) values from the generator.
+    """
+    for i in range(len(out)):
+        out[i] = next(rng)
+
+def _jumpahead_many(rng, ns):
+    """Return a list of copies of the generator, each jumped ahead by the
+    corresponding value in 'ns'. The generator itself is not changed.
+
+    This is a convenience for jumpahead(), which is called once on a copy for
+    each value in 'ns'.
+    """
+    result = []
+    for n in ns:
+        rng_copy = deepcopy(rng)
+        rng_copy.jumpahead(n)
+        result.append(rng_copy)
+    return result
+
 class Cong(object):
     '''Congruential random number generator
 
@@ -158,6 +181,9 @@ class Cong(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.cong, )
 
@@ -258,6 +284,9 @@ class SHR3(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.shr3, )
 
@@ -381,6 +410,9 @@ class MWC2(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.mwc_upper, self.mwc_lower)
 
@@ -517,6 +549,9 @@ class MWC64(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.mwc_upper, self.mwc_lower)
 
@@ -613,6 +648,9 @@ class KISS(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.random_mwc.getstate(), self.random_cong.getstate(), self.random_shr3.getstate())
 
@@ -739,6 +777,9 @@ class KISS2(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (self.random_mwc.getstate(), self.random_cong.getstate(), self.random_shr3.getstate())
 
@@ -967,6 +1008,9 @@ class LFSR113(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (lfsr_state_z(self.z1), lfsr_state_z(self.z2), lfsr_state_z(self.z3), lfsr_state_z(self.z4))
 
@@ -1104,6 +1148,9 @@ class LFSR88(object):
     def __iter__(self):
         return self
 
+    fill = _fill
+    jumpahead_many = _jumpahead_many
+
     def getstate(self):
         return (lfsr_state_z(self.z1), lfsr_state_z(self.z2), lfsr_state_z(self.z3))
 
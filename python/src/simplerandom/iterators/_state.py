@@ -0,0 +1,172 @@
+"""
+Binary state encoding for the simplerandom iterators.
+
+This uses the same versioned, endian-stable format as the C implementation
+(see simplerandom-state.c), so states can be exchanged between Python and C.
+
+A single state record is a 32-byte header followed by the state words of
+one generator. A state array is a 32-byte header followed by the state words
+of all the generators. State words are little-endian unsigned 32-bit values,
+in the same order as the members of the C state structures.
+"""
+
+import struct
+import sys
+from array import array
+
+import simplerandom.iterators as sri
+
+__all__ = [
+    "encode_state",
+    "decode_state",
+    "save_states",
+    "load_states",
+]
+
+_STATE_MAGIC = b'SRst'
+_STATE_VERSION = 2
+_STATE_KIND_RECORD = 0
+_STATE_KIND_ARRAY = 1
+_STATE_HEADER_SIZE = 32
+
+# magic, version, type, kind, reserved, position, num words, reserved,
+# num states (0 for a record).
+_STATE_HEADER_FORMAT = '<4sBBBBQIIQ'
+
+# Generator type tags, as SimpleRandomType_t in the C implementation.
+# These values are stored in saved state data, so they must never change.
+_STATE_TYPES = {
+    "Cong":     (1, 1),
+    "SHR3":     (2, 1),
+    "MWC1":     (3, 2),
+    "MWC2":     (4, 2),
+    "KISS":     (5, 4),
+    "MWC64":    (6, 2),
+    "KISS2":    (7, 4),
+    "LFSR113":  (8, 4),
+    "LFSR88":   (9, 3),
+}
+# Type tags 10 to 13 are KISS64, LFIB4, SWB and CMWC4096, which are only in
+# the C implementation.
+_STATE_TYPE_NAMES = dict((type_tag, name) for (name, (type_tag, _num_words)) in _STATE_TYPES.items())
+
+_LFSR_NAMES = ("LFSR113", "LFSR88")
+
+def _word_array():
+    for typecode in ('I', 'L'):
+        words = array(typecode)
+        if words.itemsize == 4:
+            return words
+    raise RuntimeError("no 32-bit unsigned array type")
+
+def _lfsr_z(value):
+    # The LFSR getstate() values are the internal state z transformed as
+    # z ^ (z << 16). This transform is its own inverse, modulo 2**32.
+    return (value ^ (value << 16)) & 0xFFFFFFFF
+
+def _state_type(rng):
+    try:
+        return _STATE_TYPES[type(rng).__name__]
+    except KeyError:
+        raise TypeError("unsupported generator type '%s'" % type(rng).__name__)
+
+def _state_words(rng):
+    """State words of the generator, in the order of the C state structure."""
+    state = rng.getstate()
+    name = type(rng).__name__
+    if name in ("KISS", "KISS2"):
+        words = state[0] + state[1] + state[2]
+    elif name in _LFSR_NAMES:
+        words = tuple(_lfsr_z(value) for value in state)
+    else:
+        words = state
+    return words
+
+def _setstate_words(rng, words):
+    name = type(rng).__name__
+    if name in ("KISS", "KISS2"):
+        rng.setstate(((words[0], words[1]), (words[2], ), (words[3], )))
+    elif name in _LFSR_NAMES:
+        rng.setstate(tuple(_lfsr_z(value) for value in words))
+    else:
+        rng.setstate(tuple(words))
+
+def _check_header(data, kind):
+    if len(data) < _STATE_HEADER_SIZE:
+        raise ValueError("state data is too short")
+    (magic, version, type_tag, data_kind, _reserved1, position, num_words, _reserved2, num_states) = struct.unpack_from(_STATE_HEADER_FORMAT, data)
+    if magic != _STATE_MAGIC or data_kind != kind:
+        raise ValueError("not simplerandom state data")
+    if version != _STATE_VERSION:
+        raise ValueError("unsupported state format version %d" % version)
+    name = _STATE_TYPE_NAMES.get(type_tag)
+    if name is None or _STATE_TYPES[name][1] != num_words:
+        raise ValueError("unknown generator type %d" % type_tag)
+    return (getattr(sri, name), num_words, position, num_states)
+
+def encode_state(rng, position=0):
+    """Encode the state of one generator as a record: a 32-byte header
+    followed by the generator's state words.
+    'position' is an arbitrary unsigned 64-bit stream position stored with
+    the state, e.g. the number of values generated so far.
+    """
+    (type_tag, num_words) = _state_type(rng)
+    return struct.pack(_STATE_HEADER_FORMAT + '%dI' % num_words, _STATE_MAGIC, _STATE_VERSION, type_tag,
+                       _STATE_KIND_RECORD, 0, position, num_words, 0, 0, *_state_words(rng))
+
+def decode_state(data):
+    """Decode a state record made by encode_state().
+    Returns a tuple (rng, position).
+    """
+    (rng_class, num_words, position, num_states) = _check_header(data, _STATE_KIND_RECORD)
+    if num_states != 0:
+        raise ValueError("not simplerandom state data")
+    if len(data) < _STATE_HEADER_SIZE + num_words * 4:
+        raise ValueError("state data is too short")
+    words = struct.unpack_from('<%dI' % num_words, data, _STATE_HEADER_SIZE)
+    rng = rng_class()
+    _setstate_words(rng, words)
+    return (rng, position)
+
+def save_states(rngs, position=0):
+    """Save the states of a sequence of generators, all of the same type, as
+    a state array. 'position' is an arbitrary unsigned 64-bit stream position
+    stored with the states.
+    On a little-endian host, the state words following the 32-byte header can
+    be used directly as an array of the C state structures.
+    """
+    rngs = list(rngs)
+    if not rngs:
+        raise ValueError("no generators to save")
+    rng_type = type(rngs[0])
+    (type_tag, num_words) = _state_type(rngs[0])
+    words = _word_array()
+    for rng in rngs:
+        if type(rng) is not rng_type:
+            raise TypeError("all generators must be of the same type")
+        words.extend(_state_words(rng))
+    if sys.byteorder != 'little':
+        words.byteswap()
+    header = struct.pack(_STATE_HEADER_FORMAT, _STATE_MAGIC, _STATE_VERSION, type_tag,
+                         _STATE_KIND_ARRAY, 0, position, num_words, 0, len(rngs))
+    return header + words.tobytes()
+
+def load_states(data):
+    """Load a state array made by save_states() (or by the C function
+    simplerandom_state_save_array()).
+    Returns a tuple (rngs, position), where 'rngs' is a list of generators.
+    """
+    (rng_class, num_words, position, num_states) = _check_header(data, _STATE_KIND_ARRAY)
+    data_len = num_states * num_words * 4
+    if len(data) < _STATE_HEADER_SIZE + data_len:
+        raise ValueError("state data is too short")
+    words = _word_array()
+    words.frombytes(memoryview(data)[_STATE_HEADER_SIZE:_STATE_HEADER_SIZE + data_len])
+    if sys.byteorder != 'little':
+        words.byteswap()
+    rngs = []
+    for i in range(0, data_len // 4, num_words):
+        rng = rng_class()
+        _setstate_words(rng, words[i:i + num_words])
+        rngs.append(rng)
+    return (rngs, position)
@@ -4,6 +4,7 @@ Simple random
 Unit Tests
 """
 
+import array
 import random
 import unittest
 
@@ -105,6 +106,14 @@ class CongTest(unittest.TestCase):
         """Test that __iter__ member function is present"""
         iter_object = iter(self.rng)
 
+    def test_fill(self):
+        rng2 = self.RNG_CLASS()
+        rng2.setstate(self.rng.getstate())
+        out = array.array('I', bytes(4 * 1000))
+        self.rng.fill(out)
+        self.assertEqual(list(out), [ next(rng2) for _i in range(1000) ])
+        self.assertEqual(self.rng.getstate(), rng2.getstate())
+
     def test_init(self):
         rng1 = self.RNG_CLASS(self.rng_seeds)
         rng2 = self.RNG_CLASS(*self.rng_seeds)
@@ -152,6 +161,42 @@ class CongTest(unittest.TestCase):
             jumpahead_rng.jumpahead(i)
             self.assertEqual(next(self.rng), next(jumpahead_rng))
 
+    def test_jumpahead_many(self):
+        next(self.rng)
+        rng_state = self.rng.getstate()
+        ns = [ 0, 1, 12345, -1, self.RNG_CYCLE_LEN + 3, random.randrange(2**128) ]
+        rngs = self.rng.jumpahead_many(ns)
+        # See that state hasn't changed
+        self.assertEqual(rng_state, self.rng.getstate())
+        self.assertEqual(len(rngs), len(ns))
+        jumpahead_rng = self.RNG_CLASS()
+        for (n, rng) in zip(ns, rngs):
+            self.assertIs(type(rng), self.RNG_CLASS)
+            jumpahead_rng.setstate(rng_state)
+            jumpahead_rng.jumpahead(n)
+            self.assertEqual(rng.getstate(), jumpahead_rng.getstate())
+            self.assertEqual(next(rng), next(jumpahead_rng))
+
+    def test_encode_state(self):
+        next(self.rng)
+        data = sri.encode_state(self.rng, 2**40 + 5)
+        self.assertEqual(len(data), 32 + 4 * self.RNG_SEEDS)
+        (rng2, position) = sri.decode_state(data)
+        self.assertEqual(position, 2**40 + 5)
+        self.assertIs(type(rng2), self.RNG_CLASS)
+        self.assertEqual(self.rng.getstate(), rng2.getstate())
+        self.assertEqual(next(self.rng), next(rng2))
+
+    def test_save_states(self):
+        rngs = [ self.RNG_CLASS(*[ random.randrange(self.RNG_RANGE) for _j in range(self.RNG_SEEDS) ]) for _i in range(100) ]
+        data = sri.save_states(rngs, 12345)
+        (rngs2, position) = sri.load_states(data)
+        self.assertEqual(position, 12345)
+        self.assertEqual(len(rngs2), len(rngs))
+        for (rng, rng2) in zip(rngs, rngs2):
+            self.assertEqual(rng.getstate(), rng2.getstate())
+            self.assertEqual(next(rng), next(rng2))
+
 class SHR3Test(CongTest):
     RNG_CLASS = sri.SHR3
     RNG_CYCLE_LEN = 2**32 - 1
@@ -235,6 +280,38 @@ class LFSR88Test(KISS2Test):
     MIX_MILLION_RESULT = 284026550
 
 
+class StateEncodingTest(unittest.TestCase):
+    # The same record as in the C implementation's test_simple.c
+    KISS_RECORD = bytes([
+        0x53, 0x52, 0x73, 0x74, 2, 5, 0, 0,
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x33, 0x22, 0x11, 0x88, 0x77, 0x66, 0x35,
+        0xCC, 0xBB, 0xAA, 0x99, 0x00, 0xFF, 0xEE, 0xDD,
+    ])
+
+    def test_kiss_record(self):
+        rng = sri.KISS(0x11223344, 0x35667788, 0x99AABBCC, 0xDDEEFF00)
+        self.assertEqual(sri.encode_state(rng, 0x0102030405060708), self.KISS_RECORD)
+        (rng2, position) = sri.decode_state(self.KISS_RECORD)
+        self.assertEqual(position, 0x0102030405060708)
+        self.assertEqual(rng.getstate(), rng2.getstate())
+
+    def test_invalid(self):
+        with self.assertRaises(ValueError):
+            sri.decode_state(self.KISS_RECORD[:-1])
+        with self.assertRaises(ValueError):
+            sri.load_states(self.KISS_RECORD)
+        with self.assertRaises(TypeError):
+            sri.save_states([ sri.KISS(), sri.KISS2() ])
+
+    def test_empty_array(self):
+        data = sri.save_states([ sri.KISS() ], 7)
+        data = data[:24] + bytes(8)
+        self.assertEqual(sri.load_states(data), ([ ], 7))
+
+
 def runtests():
     unittest.main()
 
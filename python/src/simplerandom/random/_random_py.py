@@ -8,6 +8,22 @@ from math import log
 
 import simplerandom.iterators as sri
 
+try:
+    from simplerandom.random._random_cython import _random_from_uint32, _randbelow_from_uint32, _gauss_from_random
+except ImportError:
+    _random_from_uint32 = None
+
+# Number of output values to generate per pass in the *_array() methods.
+# This bounds the size of the temporary raw uint32 buffer.
+_ARRAY_CHUNK_SIZE = 65536
+
+def _import_numpy():
+    try:
+        import numpy
+    except ImportError:
+        raise ImportError("NumPy is required for the *_array() methods")
+    return numpy
+
 class _StandardRandomTemplate(random.Random):
     BPF = random.BPF
     RECIP_BPF = random.RECIP_BPF
@@ -91,6 +107,87 @@ class _StandardRandomTemplate(random.Random):
             accum_range *= self.RNG_RANGE
         return accum / accum_range
 
+    def _bpf_rng_n(self, bpf):
+        """Number of generator outputs used per float, for a given bpf"""
+        if not bpf:
+            return self._rng_n
+        bpf = min(bpf, self.BPF)
+        return int((bpf + self.RNG_RANGE_BITS - 1) / self.RNG_RANGE_BITS)
+
+    def random_array(self, n, bpf=None):
+        """Return a NumPy float64 array of 'n' values, identical to the
+        values that would be returned by 'n' calls of random() with the
+        given bpf (default is this instance's bpf setting).
+        The bulk of the work is done with the GIL released.
+        """
+        np = _import_numpy()
+        rng_n = self._bpf_rng_n(bpf)
+        out = np.empty(n, dtype=np.float64)
+        for start in range(0, n, _ARRAY_CHUNK_SIZE):
+            out_chunk = out[start:start + _ARRAY_CHUNK_SIZE]
+            raw = np.empty(len(out_chunk) * rng_n, dtype=np.uint32)
+            self.rng_iterator.fill(raw)
+            if _random_from_uint32 is not None:
+                _random_from_uint32(raw, out_chunk, rng_n, float(self.RNG_MIN), float(self.RNG_RANGE))
+            else:
+                # Same floating point operations, in the same order, as random().
+                raw = raw.reshape(-1, rng_n)
+                accum = np.zeros(len(out_chunk), dtype=np.float64)
+                accum_range = 1.0
+                for j in range(rng_n):
+                    accum += (raw[:, j] - float(self.RNG_MIN)) * accum_range
+                    accum_range *= self.RNG_RANGE
+                out_chunk[:] = accum / accum_range
+        return out
+
+    def uniform_array(self, a, b, n):
+        """Return a NumPy float64 array of 'n' values, identical to the
+        values that would be returned by 'n' calls of uniform(a, b).
+        """
+        return a + (b - a) * self.random_array(n)
+
+    def randint_array(self, a, b, n):
+        """Return a NumPy int64 array of 'n' values, identical to the
+        values that would be returned by 'n' calls of randint(a, b).
+        """
+        np = _import_numpy()
+        width = b + 1 - a
+        if width <= 0:
+            raise ValueError("empty range for randint_array() (%d, %d)" % (a, b))
+        k = width.bit_length()
+        if k > self.RNG_BITS or _random_from_uint32 is None:
+            return np.array([ self.randint(a, b) for _i in range(n) ], dtype=np.int64)
+        out = np.empty(n, dtype=np.int64)
+        pos = 0
+        while pos < n:
+            # Every raw value is consumed, either accepted or rejected, so the
+            # generator advances exactly as for repeated randint() calls.
+            raw = np.empty(min(n - pos, _ARRAY_CHUNK_SIZE), dtype=np.uint32)
+            self.rng_iterator.fill(raw)
+            pos = _randbelow_from_uint32(raw, out, pos, k, width, a)
+        return out
+
+    def gauss_array(self, mu, sigma, n):
+        """Return a NumPy float64 array of 'n' values, identical to the
+        values that would be returned by 'n' calls of gauss(mu, sigma).
+        """
+        np = _import_numpy()
+        out = np.empty(n, dtype=np.float64)
+        start = 0
+        if n and self.gauss_next is not None:
+            out[0] = mu + self.gauss_next * sigma
+            self.gauss_next = None
+            start = 1
+        if _random_from_uint32 is None:
+            for i in range(start, n):
+                out[i] = self.gauss(mu, sigma)
+            return out
+        for chunk_start in range(start, n, _ARRAY_CHUNK_SIZE):
+            out_chunk = out[chunk_start:chunk_start + _ARRAY_CHUNK_SIZE]
+            rand = self.random_array((len(out_chunk) + 1) // 2 * 2)
+            self.gauss_next = _gauss_from_random(rand, out_chunk, mu, sigma)
+        return out
+
     def jumpahead(self, n):
         """Jump the random number generator ahead 'n' values of the
         random() function.
@@ -0,0 +1,81 @@
+"""
+Simple random
+
+Unit Tests
+"""
+
+import random
+import unittest
+
+import simplerandom.random as srr
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+@unittest.skipIf(numpy is None, "NumPy is not available")
+class CongArrayTest(unittest.TestCase):
+    """Check that the bulk array methods give exactly the same values as
+    the equivalent sequence of scalar method calls."""
+    RNG_CLASS = srr.Cong
+    NUM = 1001
+
+    def setUp(self):
+        seed = random.randrange(1 << 32)
+        self.rng = self.RNG_CLASS(seed)
+        self.rng_ref = self.RNG_CLASS(seed)
+
+    def assertSameState(self):
+        self.assertEqual(self.rng.getstate(), self.rng_ref.getstate())
+
+    def test_random_array(self):
+        for bpf in (20, 32, 53):
+            result = self.rng.random_array(self.NUM, bpf=bpf)
+            self.rng_ref.bpf = bpf
+            expected = [ self.rng_ref.random() for _i in range(self.NUM) ]
+            self.assertEqual(list(result), expected)
+            self.assertSameState()
+
+    def test_uniform_array(self):
+        result = self.rng.uniform_array(-2.5, 7.0, self.NUM)
+        expected = [ self.rng_ref.uniform(-2.5, 7.0) for _i in range(self.NUM) ]
+        self.assertEqual(list(result), expected)
+        self.assertSameState()
+
+    def test_randint_array(self):
+        for (a, b) in ((3, 17), (-1000, 1000), (0, 2**32 - 1), (5, 5)):
+            result = self.rng.randint_array(a, b, self.NUM)
+            expected = [ self.rng_ref.randint(a, b) for _i in range(self.NUM) ]
+            self.assertEqual(list(result), expected)
+            self.assertSameState()
+
+    def test_gauss_array(self):
+        # Odd length, so that 'gauss_next' is carried over between calls.
+        for _i in range(3):
+            result = self.rng.gauss_array(1.0, 2.0, self.NUM)
+            expected = [ self.rng_ref.gauss(1.0, 2.0) for _i in range(self.NUM) ]
+            self.assertEqual(list(result), expected)
+            self.assertEqual(self.rng.gauss_next, self.rng_ref.gauss_next)
+            self.assertSameState()
+
+class SHR3ArrayTest(CongArrayTest):
+    RNG_CLASS = srr.SHR3
+
+class MWC64ArrayTest(CongArrayTest):
+    RNG_CLASS = srr.MWC64
+
+class KISS2ArrayTest(CongArrayTest):
+    RNG_CLASS = srr.KISS2
+
+class LFSR113ArrayTest(CongArrayTest):
+    RNG_CLASS = srr.LFSR113
+
+
+def runtests():
+    unittest.main()
+
+
+if __name__ == '__main__':
+    runtests()
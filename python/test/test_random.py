@@ -0,0 +1,7 @@
+#!/usr/bin/env python
+
+import unittest
+
+import simplerandom.random.test
+
+unittest.main(module=simplerandom.random.test)
@@ -1,165 +1,367 @@
-
-#include <stdint.h>
-#include <iostream>
-#include <algorithm>
-#include <map>
-#include <set>
-
-using namespace std;
-
-#define RECORD_STATE_INTERVAL 2048
-
-typedef uint32_t (*p_rng_func_t)(uint32_t);
-
-typedef std::map<uint32_t, uint64_t>            cycles_map_t;
-typedef std::map<uint64_t, std::set<uint32_t> > lengths_map_t;
-typedef std::set<uint32_t>                      values_set_t;    
-
-class FindCycles
-{
-private:
-    cycles_map_t                            _cycles;    // Key is cycle's min value; value is length
-    lengths_map_t                           _lengths;   // Key is length; value is set of cycle's min values
-    values_set_t                            _values;
-    p_rng_func_t                            _p_rng_func;
-    uint64_t                                _func_range;
-
-    uint64_t _find_cycle_with_seed(uint32_t start_value);
-
-public:
-    FindCycles(p_rng_func_t p_rng_func, uint64_t func_range);
-    void find_cycles();
-};
-
-FindCycles::FindCycles(p_rng_func_t p_rng_func, uint64_t func_range)
-{
-    _p_rng_func = p_rng_func;
-    _func_range = func_range;
-}
-
-void FindCycles::find_cycles()
-{
-    cycles_map_t::iterator cycles_iter;
-    lengths_map_t::iterator lengths_iter;
-    uint64_t j;
-
-    for (j = 0; j < _func_range; j++)
-    {
-        _find_cycle_with_seed(j);
-    }
-    cout << "\n";
-
-#if 0
-    for (cycles_iter = _cycles.begin(); cycles_iter != _cycles.end(); cycles_iter++)
-    {
-        cout << "Cycle min " << (*cycles_iter).first << ", length " << (*cycles_iter).second;
-        cout << "\n";
-    }
-    cout << "\n";
-#endif
-
-    for (lengths_iter = _lengths.begin(); lengths_iter != _lengths.end(); lengths_iter++)
-    {
-        cout << "Length " << (*lengths_iter).first << ", " << (*lengths_iter).second.size() << " cycles";
-        cout << "\n";
-    }
-    cout << "\n";
-
-}
-
-uint64_t FindCycles::_find_cycle_with_seed(uint32_t start_value)
-{
-    values_set_t local_values;
-    values_set_t::iterator iter;
-    uint32_t value = start_value;
-    uint32_t length = 0;
-    uint64_t return_length = 0;
-    uint32_t record_state_counter = 0;
-    uint32_t min_value = start_value;
-
-    while (1)
-    {
-        value = _p_rng_func(value);
-        if (value == start_value)
-        {
-            return_length = ((uint64_t)length) + 1;
-
-            cout << "Cycle min " << min_value << ", length " << return_length;
-            cout << "\n";
-            _cycles[min_value] = return_length;
-
-            for (iter = local_values.begin(); iter != local_values.end(); iter++)
-            {
-                _values.insert(*iter);
-            }
-
-            _lengths[return_length].insert(min_value);
-
-            break;
-        }
-        if (value < min_value)
-        {
-            break;
-        }
-#if 0
-        if (_values.find(value) != _values.end())
-        {
-            break;
-        }
-        record_state_counter++;
-        if (record_state_counter >= RECORD_STATE_INTERVAL)
-        {
-            local_values.insert(value);
-            record_state_counter = 0;
-        }
-#else
-        if ((value % RECORD_STATE_INTERVAL) == 0)
-        {
-            if (_values.find(value) != _values.end())
-            {
-                break;
-            }
-            else
-            {
-                local_values.insert(value);
-            }
-        }
-#endif
-
-        length++;
-    }
-
-    return return_length;
-}
-
-uint32_t shr3(uint32_t val)
-{
-    val ^= val << 17u;
-    val ^= val >> 13u;
-    val ^= val << 5u;
-    return val;
-}
-
-uint32_t shr3_2(uint32_t val)
-{
-    val ^= val << 13u;
-    val ^= val >> 17u;
-    val ^= val << 5u;
-    return val;
-}
-
-uint32_t mwc_upper(uint32_t val)
-{
-    return 36969*(val&65535)+(val>>16);
-}
-
-uint32_t mwc_lower(uint32_t val)
-{
-    return 18000*(val&65535)+(val>>16);
-}
-
-int main()
-{
-    FindCycles fc(mwc_lower, 1uLL << 32);
-    fc.find_cycles();
-}
+/*
+ * find_cycles.cpp
+ *
+ * Find the cycles of the component step functions of the simplerandom
+ * generators, and of some of their combined states, and report a histogram
+ * of the cycle lengths. See find_cycles.h for the algorithms.
+ *
+ * Build:
+ *     g++ -O2 -std=c++11 -pthread find_cycles.cpp -o find_cycles
+ *
+ * Usage:
+ *     find_cycles [OPTIONS] [FUNCTION [NUM_THREADS]]
+ *
+ * FUNCTION is one of:
+ *     shr3, shr3_2, cong, mwc_upper, mwc_lower (default)
+ *         32-bit state, searched exhaustively unless --sample is given.
+ *     mwc_test
+ *         A small MWC over 16 bits, to quickly check the tool itself.
+ *     mwc64, kiss, kiss2
+ *         64-bit or combined state, which can only be sampled.
+ * NUM_THREADS defaults to the number of CPUs.
+ *
+ * Options (for sampling):
+ *     --sample[=NUM_WALKS]    Sample cycles from random start states (16)
+ *     --dp-bits=N             Distinguished points are 1 in 2^N states (20)
+ *     --max-steps=N           Maximum steps per walk (2^32)
+ *     --brent-steps=N         Brent's algorithm steps per walk (2^(N+4))
+ *     --seed=N                Seed for the random start states (1)
+ * Numbers are in decimal, or hex with a "0x" prefix.
+ *
+ * Run time: a walk that doesn't reach a cycle takes the full --max-steps
+ * steps. The cycles of mwc64, kiss and kiss2 are far longer than 2^32, so
+ * with the defaults every walk does, and a run is 16 x 2^32 steps. At about
+ * 4 ns per step, that is about 5 minutes of CPU time, divided between the
+ * threads. Progress is reported to stderr every 10 seconds. For a quick run,
+ * use a smaller --max-steps or fewer walks.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include "find_cycles.h"
+
+using namespace std;
+
+uint32_t shr3(uint32_t val)
+{
+    val ^= val << 17u;
+    val ^= val >> 13u;
+    val ^= val << 5u;
+    return val;
+}
+
+uint32_t shr3_2(uint32_t val)
+{
+    val ^= val << 13u;
+    val ^= val >> 17u;
+    val ^= val << 5u;
+    return val;
+}
+
+uint32_t cong(uint32_t val)
+{
+    return 69069u*val+12345u;
+}
+
+uint32_t mwc_upper(uint32_t val)
+{
+    return 36969*(val&65535)+(val>>16);
+}
+
+uint32_t mwc_lower(uint32_t val)
+{
+    return 18000*(val&65535)+(val>>16);
+}
+
+/* A small MWC over 16-bit values, for testing. */
+uint32_t mwc_test(uint32_t val)
+{
+    return 200*(val&255)+(val>>8);
+}
+
+uint64_t mwc64(uint64_t val)
+{
+    return UINT64_C(698769069)*(val&0xFFFFFFFFu)+(val>>32);
+}
+
+/*********
+ * KISS combined state
+ ********/
+
+struct KISSState
+{
+    uint32_t    mwc_upper;
+    uint32_t    mwc_lower;
+    uint32_t    cong;
+    uint32_t    shr3;
+};
+
+bool operator==(const KISSState & a, const KISSState & b)
+{
+    return a.mwc_upper == b.mwc_upper && a.mwc_lower == b.mwc_lower && a.cong == b.cong && a.shr3 == b.shr3;
+}
+
+bool operator<(const KISSState & a, const KISSState & b)
+{
+    if (a.mwc_upper != b.mwc_upper) return a.mwc_upper < b.mwc_upper;
+    if (a.mwc_lower != b.mwc_lower) return a.mwc_lower < b.mwc_lower;
+    if (a.cong != b.cong) return a.cong < b.cong;
+    return a.shr3 < b.shr3;
+}
+
+ostream & operator<<(ostream & os, const KISSState & x)
+{
+    return os << "(" << x.mwc_upper << ", " << x.mwc_lower << ", " << x.cong << ", " << x.shr3 << ")";
+}
+
+template <>
+struct CycleStateHash<KISSState>
+{
+    size_t operator()(const KISSState & x) const
+    {
+        return (size_t)cycle_hash_mix((((uint64_t)x.mwc_upper << 32u) | x.mwc_lower) ^
+                                      cycle_hash_mix(((uint64_t)x.cong << 32u) | x.shr3));
+    }
+};
+
+KISSState kiss(KISSState val)
+{
+    val.mwc_upper = mwc_upper(val.mwc_upper);
+    val.mwc_lower = mwc_lower(val.mwc_lower);
+    val.cong = cong(val.cong);
+    val.shr3 = shr3_2(val.shr3);
+    return val;
+}
+
+/*********
+ * KISS2 combined state
+ ********/
+
+struct KISS2State
+{
+    uint64_t    mwc64;
+    uint32_t    cong;
+    uint32_t    shr3;
+};
+
+bool operator==(const KISS2State & a, const KISS2State & b)
+{
+    return a.mwc64 == b.mwc64 && a.cong == b.cong && a.shr3 == b.shr3;
+}
+
+bool operator<(const KISS2State & a, const KISS2State & b)
+{
+    if (a.mwc64 != b.mwc64) return a.mwc64 < b.mwc64;
+    if (a.cong != b.cong) return a.cong < b.cong;
+    return a.shr3 < b.shr3;
+}
+
+ostream & operator<<(ostream & os, const KISS2State & x)
+{
+    return os << "(" << x.mwc64 << ", " << x.cong << ", " << x.shr3 << ")";
+}
+
+template <>
+struct CycleStateHash<KISS2State>
+{
+    size_t operator()(const KISS2State & x) const
+    {
+        return (size_t)cycle_hash_mix(x.mwc64 ^ cycle_hash_mix(((uint64_t)x.cong << 32u) | x.shr3));
+    }
+};
+
+KISS2State kiss2(KISS2State val)
+{
+    val.mwc64 = mwc64(val.mwc64);
+    val.cong = cong(val.cong);
+    val.shr3 = shr3_2(val.shr3);
+    return val;
+}
+
+/*********
+ * Random start states
+ ********/
+
+template <typename State>
+State random_state(std::mt19937_64 & rng)
+{
+    return (State)rng();
+}
+
+template <>
+KISSState random_state<KISSState>(std::mt19937_64 & rng)
+{
+    uint64_t r1 = rng();
+    uint64_t r2 = rng();
+    KISSState x = { (uint32_t)(r1 >> 32u), (uint32_t)r1, (uint32_t)(r2 >> 32u), (uint32_t)r2 };
+    return x;
+}
+
+template <>
+KISS2State random_state<KISS2State>(std::mt19937_64 & rng)
+{
+    uint64_t r1 = rng();
+    uint64_t r2 = rng();
+    KISS2State x = { r1, (uint32_t)(r2 >> 32u), (uint32_t)r2 };
+    return x;
+}
+
+/*********
+ * Main
+ ********/
+
+template <typename State, State (*Step)(State)>
+void find_cycles_exhaustive(uint64_t range, unsigned num_threads)
+{
+    FindCycles<State, State (*)(State)> fc(Step, range, num_threads);
+    fc.find_cycles();
+}
+
+template <typename State, State (*Step)(State)>
+void find_cycles_sample(const SampleCyclesParams & params)
+{
+    SampleCycles<State, State (*)(State)> sc(Step, random_state<State>, params);
+    sc.sample_cycles();
+}
+
+struct function_t
+{
+    const char    * name;
+    void         (* p_exhaustive)(uint64_t range, unsigned num_threads);
+    void         (* p_sample)(const SampleCyclesParams & params);
+    uint64_t        range;      // Range of exhaustive search
+};
+
+static const function_t functions[] =
+{
+    { "shr3",       find_cycles_exhaustive<uint32_t, shr3>,         find_cycles_sample<uint32_t, shr3>,         1uLL << 32 },
+    { "shr3_2",     find_cycles_exhaustive<uint32_t, shr3_2>,       find_cycles_sample<uint32_t, shr3_2>,       1uLL << 32 },
+    { "cong",       find_cycles_exhaustive<uint32_t, cong>,         find_cycles_sample<uint32_t, cong>,         1uLL << 32 },
+    { "mwc_upper",  find_cycles_exhaustive<uint32_t, mwc_upper>,    find_cycles_sample<uint32_t, mwc_upper>,    1uLL << 32 },
+    { "mwc_lower",  find_cycles_exhaustive<uint32_t, mwc_lower>,    find_cycles_sample<uint32_t, mwc_lower>,    1uLL << 32 },
+    { "mwc_test",   find_cycles_exhaustive<uint32_t, mwc_test>,     find_cycles_sample<uint32_t, mwc_test>,     1uLL << 16 },
+    { "mwc64",      NULL,                                           find_cycles_sample<uint64_t, mwc64>,        0 },
+    { "kiss",       NULL,                                           find_cycles_sample<KISSState, kiss>,        0 },
+    { "kiss2",      NULL,                                           find_cycles_sample<KISS2State, kiss2>,      0 },
+};
+
+/* Parse a number for an option, in decimal, or hex with a "0x" prefix.
+ * Returns false if it isn't a valid number.
+ */
+static bool parse_number(const char * p_str, uint64_t & value)
+{
+    char              * p_end;
+    unsigned long long  result;
+
+    if (*p_str < '0' || *p_str > '9')
+    {
+        return false;
+    }
+    errno = 0;
+    result = strtoull(p_str, &p_end, 0);
+    if (errno != 0 || *p_end != '\0')
+    {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+static void usage(const char * p_program)
+{
+    cerr << "Usage: " << p_program << " [--sample[=NUM_WALKS]] [--dp-bits=N] [--max-steps=N] [--brent-steps=N] [--seed=N]\n";
+    cerr << "       [shr3|shr3_2|cong|mwc_upper|mwc_lower|mwc_test|mwc64|kiss|kiss2 [NUM_THREADS]]\n";
+    cerr << "Sampling mwc64, kiss or kiss2 with the default --max-steps (2^32) takes about\n";
+    cerr << "16 x 2^32 steps for the default 16 walks: several minutes of CPU time.\n";
+}
+
+int main(int argc, char * argv[])
+{
+    const function_t * p_function = &functions[4];
+    SampleCyclesParams params;
+    unsigned num_threads = std::thread::hardware_concurrency();
+    bool sample = false;
+    bool ok = true;
+    uint64_t value;
+    int arg_index;
+    int num_positional = 0;
+
+    for (arg_index = 1; arg_index < argc; arg_index++)
+    {
+        const char * p_arg = argv[arg_index];
+
+        if (strcmp(p_arg, "--sample") == 0)
+        {
+            sample = true;
+        }
+        else if (strncmp(p_arg, "--sample=", 9) == 0)
+        {
+            sample = true;
+            ok = parse_number(p_arg + 9, params.num_walks) && params.num_walks >= 1u;
+        }
+        else if (strncmp(p_arg, "--dp-bits=", 10) == 0)
+        {
+            ok = parse_number(p_arg + 10, value) && value <= 40u;
+            params.dp_bits = (unsigned)value;
+        }
+        else if (strncmp(p_arg, "--max-steps=", 12) == 0)
+        {
+            ok = parse_number(p_arg + 12, params.max_steps) && params.max_steps >= 1u;
+        }
+        else if (strncmp(p_arg, "--brent-steps=", 14) == 0)
+        {
+            ok = parse_number(p_arg + 14, params.brent_steps);
+        }
+        else if (strncmp(p_arg, "--seed=", 7) == 0)
+        {
+            ok = parse_number(p_arg + 7, params.seed);
+        }
+        else if (p_arg[0] == '-' || num_positional >= 2)
+        {
+            usage(argv[0]);
+            return 2;
+        }
+        else if (num_positional++ == 0)
+        {
+            p_function = NULL;
+            for (size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); i++)
+            {
+                if (strcmp(p_arg, functions[i].name) == 0)
+                {
+                    p_function = &functions[i];
+                }
+            }
+        }
+        else
+        {
+            ok = parse_number(p_arg, value) && value >= 1u && value <= 65536u;
+            num_threads = (unsigned)value;
+        }
+        if (!ok)
+        {
+            break;
+        }
+    }
+    if (!ok || p_function == NULL)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if (num_threads == 0)
+    {
+        num_threads = 1;
+    }
+
+    if (sample || p_function->p_exhaustive == NULL)
+    {
+        params.num_threads = num_threads;
+        p_function->p_sample(params);
+    }
+    else
+    {
+        p_function->p_exhaustive(p_function->range, num_threads);
+    }
+}
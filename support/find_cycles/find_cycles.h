@@ -0,0 +1,717 @@
+/*
+ * find_cycles.h
+ *
+ * Engines to analyse the cycle structure of a step function, templated on
+ * the state type and the step function (any callable 'State step(State)').
+ *
+ * FindCycles<State, Step>
+ *     Exhaustively finds every cycle, for an unsigned integer state type
+ *     whose values can all be enumerated (up to 2^32 values, using a 512 MB
+ *     bitmap of visited values).
+ *
+ * SampleCycles<State, Step, Hash>
+ *     Finds the cycles reached from a sample of random start states, for any
+ *     state type, such as a 64-bit MWC or the combined KISS components. Short
+ *     cycles are found with Brent's algorithm. Long cycles are found by
+ *     parallel distinguished-point walks: each walk records the "distinguished
+ *     points" (states whose hash has 'dp_bits' low zero bits) that it passes,
+ *     and the distance between them, and stops when it reaches a
+ *     distinguished point that is already recorded, by itself or another
+ *     walk. The recorded distinguished points form a much smaller function
+ *     graph, whose cycles give the exact lengths of the cycles of the step
+ *     function. A cycle can only be found if it is no longer than a walk's
+ *     'max_steps', but walks from different starts share the work of walking
+ *     a cycle.
+ *
+ * SampleCycles reports its progress to stderr every
+ * SAMPLE_PROGRESS_INTERVAL_S seconds, since a walk that doesn't reach a cycle
+ * takes all of 'max_steps' steps, which can take minutes.
+ *
+ * State types other than integers need operator==, operator< (to identify a
+ * cycle by its minimum state), operator<< and a specialisation of
+ * CycleStateHash.
+ */
+
+#ifndef FIND_CYCLES_H
+#define FIND_CYCLES_H
+
+#include <stdint.h>
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* Number of start values that a thread takes at a time in FindCycles. */
+#define START_VALUES_CHUNK  65536u
+
+/* SampleCycles walks count their steps for the progress report in blocks of
+ * this many steps, and the progress is reported at this interval. */
+#define SAMPLE_PROGRESS_STEPS       (UINT64_C(1) << 24)
+#define SAMPLE_PROGRESS_INTERVAL_S  10
+
+/* 64-bit hash finaliser (from MurmurHash3), so that the low bits of the hash
+ * of any state are usable to choose distinguished points.
+ */
+inline uint64_t cycle_hash_mix(uint64_t h)
+{
+    h ^= h >> 33u;
+    h *= UINT64_C(0xFF51AFD7ED558CCD);
+    h ^= h >> 33u;
+    h *= UINT64_C(0xC4CEB9FE1A85EC53);
+    h ^= h >> 33u;
+    return h;
+}
+
+template <typename State>
+struct CycleStateHash
+{
+    size_t operator()(const State & x) const
+    {
+        return (size_t)cycle_hash_mix((uint64_t)std::hash<State>()(x));
+    }
+};
+
+typedef std::map<uint64_t, uint64_t>    lengths_map_t;  // Key is length; value is number of cycles
+
+/* Print the number of cycles of each length, and a histogram of cycle lengths
+ * in power-of-2 bins.
+ */
+inline void print_cycle_lengths(const lengths_map_t & lengths)
+{
+    lengths_map_t::const_iterator lengths_iter;
+
+    for (lengths_iter = lengths.begin(); lengths_iter != lengths.end(); lengths_iter++)
+    {
+        std::cout << "Length " << (*lengths_iter).first << ", " << (*lengths_iter).second << " cycles";
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+
+    std::cout << "Length range                               Cycles          Values\n";
+    for (unsigned bin = 0; bin <= 64u; bin++)
+    {
+        uint64_t bin_min = (bin == 0) ? 0 : (UINT64_C(1) << (bin - 1u));
+        uint64_t bin_max = (bin == 64u) ? UINT64_MAX : (UINT64_C(1) << bin) - 1u;
+        uint64_t bin_cycles = 0;
+        uint64_t bin_values = 0;
+
+        for (lengths_iter = lengths.lower_bound(bin_min); lengths_iter != lengths.end() && (*lengths_iter).first <= bin_max; lengths_iter++)
+        {
+            bin_cycles += (*lengths_iter).second;
+            bin_values += (*lengths_iter).first * (*lengths_iter).second;
+        }
+        if (bin_cycles)
+        {
+            std::cout.width(20);
+            std::cout << bin_min << " - ";
+            std::cout.width(20);
+            std::cout << std::left << bin_max << std::right;
+            std::cout.width(10);
+            std::cout << bin_cycles;
+            std::cout.width(16);
+            std::cout << bin_values << "\n";
+        }
+    }
+    std::cout << "\n";
+}
+
+/*********
+ * Brent's algorithm
+ ********/
+
+/* Find the cycle reached from 'start', using Brent's cycle detection
+ * algorithm. Returns false if no cycle is detected within about 'max_steps'
+ * steps. Otherwise, returns the length of the tail leading into the cycle,
+ * the length of the cycle, and the minimum state in the cycle (which takes
+ * another walk around the cycle).
+ */
+template <typename State, typename Step>
+bool brent_find_cycle(Step step, const State & start, uint64_t max_steps,
+                      uint64_t & tail_length, uint64_t & cycle_length, State & cycle_min)
+{
+    State       tortoise = start;
+    State       hare = step(start);
+    uint64_t    power = 1;
+    uint64_t    lambda = 1;
+    uint64_t    steps = 1;
+    uint64_t    i;
+
+    /* Find the cycle length. */
+    while (!(tortoise == hare))
+    {
+        if (steps >= max_steps)
+        {
+            return false;
+        }
+        if (power == lambda)
+        {
+            tortoise = hare;
+            power *= 2u;
+            lambda = 0;
+        }
+        hare = step(hare);
+        lambda++;
+        steps++;
+    }
+
+    /* Find the tail length, with the hare 'lambda' steps ahead. */
+    tortoise = start;
+    hare = start;
+    for (i = 0; i < lambda; i++)
+    {
+        hare = step(hare);
+    }
+    tail_length = 0;
+    while (!(tortoise == hare))
+    {
+        tortoise = step(tortoise);
+        hare = step(hare);
+        tail_length++;
+    }
+    cycle_length = lambda;
+
+    cycle_min = tortoise;
+    for (i = 0; i < lambda; i++)
+    {
+        hare = step(hare);
+        if (hare < cycle_min)
+        {
+            cycle_min = hare;
+        }
+    }
+    return true;
+}
+
+/*********
+ * Exhaustive search
+ ********/
+
+/* Each cycle is found by walking it from its minimum value. A walk from a
+ * start value stops as soon as it reaches a smaller value, because then the
+ * start value isn't the minimum of its cycle (or it is on a "tail" leading
+ * into a cycle, as for the MWC functions' values outside their state space).
+ * If the walk returns to the start value, a cycle has been found.
+ *
+ * The start values are shared out between threads in chunks, in increasing
+ * order. When a thread finds a cycle, it walks the cycle again to mark all its
+ * values in a bitmap of visited values (using atomic updates). Other threads
+ * then skip those start values rather than walking from them.
+ *
+ * This assumes that every walk either returns to its start value or reaches
+ * a smaller value. That is true for permutations, such as SHR3, and for the
+ * MWC functions. As a safeguard, a walk that is longer than the function's
+ * range is abandoned and reported.
+ */
+template <typename State, typename Step>
+class FindCycles
+{
+private:
+    struct cycle_t
+    {
+        State       min_value;
+        uint64_t    length;
+    };
+    typedef std::vector<cycle_t>            cycles_t;
+
+    Step                                    _step;
+    uint64_t                                _func_range;
+    unsigned                                _num_threads;
+    std::vector< std::atomic<uint64_t> >    _visited;
+    std::atomic<uint64_t>                   _next_start_value;
+    std::vector<cycles_t>                   _thread_cycles;
+    std::atomic<uint64_t>                   _num_abandoned;
+
+    bool _is_visited(State value) const
+    {
+        return (_visited[(uint64_t)value / 64u].load(std::memory_order_relaxed) >> ((uint64_t)value % 64u)) & 1u;
+    }
+
+    void _mark_visited(State value)
+    {
+        _visited[(uint64_t)value / 64u].fetch_or(UINT64_C(1) << ((uint64_t)value % 64u), std::memory_order_relaxed);
+    }
+
+    void _mark_cycle(State start_value)
+    {
+        State value = start_value;
+
+        do
+        {
+            _mark_visited(value);
+            value = _step(value);
+        } while (value != start_value);
+    }
+
+    /* Returns the length of the cycle if 'start_value' is the minimum value of
+     * its cycle, otherwise 0.
+     */
+    uint64_t _find_cycle_with_seed(State start_value)
+    {
+        State value = start_value;
+        uint64_t length = 0;
+
+        while (1)
+        {
+            value = _step(value);
+            length++;
+            if (value == start_value)
+            {
+                return length;
+            }
+            if (value < start_value)
+            {
+                return 0;
+            }
+            if (length > _func_range)
+            {
+                _num_abandoned++;
+                return 0;
+            }
+        }
+    }
+
+    void _thread_main(unsigned thread_index)
+    {
+        cycles_t & cycles = _thread_cycles[thread_index];
+        uint64_t first;
+        uint64_t last;
+        uint64_t j;
+        uint64_t length;
+        cycle_t cycle;
+
+        while (1)
+        {
+            first = _next_start_value.fetch_add(START_VALUES_CHUNK);
+            if (first >= _func_range)
+            {
+                break;
+            }
+            last = std::min<uint64_t>(first + START_VALUES_CHUNK, _func_range);
+            for (j = first; j < last; j++)
+            {
+                if (_is_visited((State)j))
+                {
+                    continue;
+                }
+                length = _find_cycle_with_seed((State)j);
+                if (length != 0)
+                {
+                    cycle.min_value = (State)j;
+                    cycle.length = length;
+                    cycles.push_back(cycle);
+                    _mark_cycle((State)j);
+                }
+            }
+        }
+    }
+
+public:
+    FindCycles(Step step, uint64_t func_range, unsigned num_threads)
+        : _step(step),
+          _func_range(func_range),
+          _num_threads(num_threads),
+          _visited((func_range + 63u) / 64u),
+          _next_start_value(0),
+          _thread_cycles(num_threads),
+          _num_abandoned(0)
+    {
+        for (size_t i = 0; i < _visited.size(); i++)
+        {
+            _visited[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void find_cycles()
+    {
+        std::vector<std::thread> threads;
+        cycles_t cycles;
+        lengths_map_t lengths;
+        uint64_t total_values = 0;
+        unsigned i;
+
+        for (i = 0; i < _num_threads; i++)
+        {
+            threads.push_back(std::thread(&FindCycles::_thread_main, this, i));
+        }
+        for (i = 0; i < _num_threads; i++)
+        {
+            threads[i].join();
+            cycles.insert(cycles.end(), _thread_cycles[i].begin(), _thread_cycles[i].end());
+        }
+        std::sort(cycles.begin(), cycles.end(),
+                  [](const cycle_t & a, const cycle_t & b) { return a.min_value < b.min_value; });
+
+        for (i = 0; i < cycles.size(); i++)
+        {
+            if (i < 100u)
+            {
+                std::cout << "Cycle min " << (uint64_t)cycles[i].min_value << ", length " << cycles[i].length << "\n";
+            }
+            lengths[cycles[i].length]++;
+            total_values += cycles[i].length;
+        }
+        if (cycles.size() > 100u)
+        {
+            std::cout << "(" << cycles.size() - 100u << " more cycles not listed)\n";
+        }
+        std::cout << "\n";
+
+        print_cycle_lengths(lengths);
+        std::cout << cycles.size() << " cycles, containing " << total_values << " of " << _func_range << " values\n";
+        if (_num_abandoned)
+        {
+            std::cout << _num_abandoned << " walks abandoned (neither returned to their start value nor reached a smaller value)\n";
+        }
+    }
+};
+
+/*********
+ * Sampling, with Brent's algorithm and distinguished points
+ ********/
+
+struct SampleCyclesParams
+{
+    uint64_t    num_walks;      // Number of random start states
+    unsigned    dp_bits;        // Distinguished points are 1 in 2^dp_bits states
+    uint64_t    max_steps;      // Maximum length of each distinguished-point walk
+    uint64_t    brent_steps;    // Brent's algorithm steps before a distinguished-point walk; 0 for 2^(dp_bits+4)
+    uint64_t    seed;           // Seed for the random start states
+    unsigned    num_threads;
+
+    SampleCyclesParams()
+        : num_walks(16),
+          dp_bits(20),
+          max_steps(UINT64_C(1) << 32),
+          brent_steps(0),
+          seed(1),
+          num_threads(1)
+    {
+    }
+};
+
+template <typename State, typename Step, typename Hash = CycleStateHash<State> >
+class SampleCycles
+{
+public:
+    typedef State (*p_random_state_func_t)(std::mt19937_64 & rng);
+
+private:
+    struct dp_node_t
+    {
+        State       next;           // The next distinguished point...
+        uint64_t    distance;       // ...and the number of steps to it
+        bool        has_next;
+
+        dp_node_t() : next(), distance(0), has_next(false) {}
+    };
+    typedef std::unordered_map<State, dp_node_t, Hash>  dp_nodes_t;
+
+    struct walk_t
+    {
+        State       start;
+        bool        short_cycle;    // Cycle found by Brent's algorithm
+        State       cycle_min;      // For a short cycle
+        uint64_t    cycle_length;   // For a short cycle
+        bool        has_dp;
+        State       first_dp;       // First distinguished point reached
+
+        walk_t() : start(), short_cycle(false), cycle_min(), cycle_length(0), has_dp(false), first_dp() {}
+    };
+
+    struct dp_cycle_t
+    {
+        State       min_dp;         // Minimum distinguished point in the cycle
+        uint64_t    length;
+        uint64_t    num_dps;
+        uint64_t    num_walks;
+    };
+
+    Step                    _step;
+    p_random_state_func_t   _p_random_state;
+    SampleCyclesParams      _params;
+    uint64_t                _dp_mask;
+    Hash                    _hash;
+    dp_nodes_t              _dps;
+    std::mutex              _dps_mutex;
+    std::vector<walk_t>     _walks;
+    std::atomic<uint64_t>   _next_walk;
+    std::atomic<uint64_t>   _num_walks_done;
+    std::atomic<uint64_t>   _steps_done;        // In blocks of SAMPLE_PROGRESS_STEPS
+
+    bool _is_dp(const State & x) const
+    {
+        return (_hash(x) & _dp_mask) == 0;
+    }
+
+    void _walk(walk_t & walk)
+    {
+        State       x = walk.start;
+        State       prev_dp;
+        bool        has_prev_dp = false;
+        bool        is_new_dp;
+        uint64_t    distance = 0;
+        uint64_t    steps;
+        uint64_t    tail_length;
+
+        if (brent_find_cycle(_step, walk.start, _params.brent_steps, tail_length, walk.cycle_length, walk.cycle_min))
+        {
+            walk.short_cycle = true;
+            return;
+        }
+
+        for (steps = 0; steps < _params.max_steps; steps++)
+        {
+            if ((steps & (SAMPLE_PROGRESS_STEPS - 1u)) == SAMPLE_PROGRESS_STEPS - 1u)
+            {
+                _steps_done.fetch_add(SAMPLE_PROGRESS_STEPS, std::memory_order_relaxed);
+            }
+            x = _step(x);
+            distance++;
+            if (_is_dp(x))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_dps_mutex);
+
+                    if (has_prev_dp)
+                    {
+                        dp_node_t & prev = _dps[prev_dp];
+                        prev.next = x;
+                        prev.distance = distance;
+                        prev.has_next = true;
+                    }
+                    else
+                    {
+                        walk.has_dp = true;
+                        walk.first_dp = x;
+                    }
+                    is_new_dp = _dps.insert(std::make_pair(x, dp_node_t())).second;
+                }
+                if (!is_new_dp)
+                {
+                    /* Joined a path that is already recorded. */
+                    return;
+                }
+                prev_dp = x;
+                has_prev_dp = true;
+                distance = 0;
+            }
+        }
+    }
+
+    void _thread_main()
+    {
+        std::mt19937_64 rng;
+        uint64_t i;
+
+        while ((i = _next_walk.fetch_add(1)) < _walks.size())
+        {
+            /* Start states depend only on the seed and walk index, not on the
+             * number of threads.
+             */
+            rng.seed(_params.seed ^ cycle_hash_mix(i + 1u));
+            _walks[i].start = _p_random_state(rng);
+            _walk(_walks[i]);
+            _num_walks_done++;
+        }
+    }
+
+    /* Wait for the walks to finish, reporting progress to stderr. */
+    void _wait_for_walks()
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point next_report = start + std::chrono::seconds(SAMPLE_PROGRESS_INTERVAL_S);
+        std::chrono::steady_clock::time_point now;
+
+        while (_num_walks_done.load() < _walks.size())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            now = std::chrono::steady_clock::now();
+            if (now >= next_report)
+            {
+                std::cerr << std::chrono::duration_cast<std::chrono::seconds>(now - start).count() << " s: ";
+                std::cerr << _num_walks_done.load() << " of " << _walks.size() << " walks done, about ";
+                std::cerr << _steps_done.load(std::memory_order_relaxed) << " steps of at most ";
+                std::cerr << _walks.size() << " x " << _params.max_steps << std::endl;
+                next_report += std::chrono::seconds(SAMPLE_PROGRESS_INTERVAL_S);
+            }
+        }
+    }
+
+    /* Follow the distinguished points from 'start', to find which cycle (if
+     * any) they lead to. The result for each distinguished point is an index
+     * into 'dp_cycles', or -1 if the path ends without reaching a cycle.
+     */
+    void _resolve_dp(const State & start, std::unordered_map<State, int64_t, Hash> & results,
+                     std::vector<dp_cycle_t> & dp_cycles)
+    {
+        const int64_t IN_PROGRESS = -2;
+        std::vector<State> path;
+        State x = start;
+        int64_t result;
+        typename std::unordered_map<State, int64_t, Hash>::iterator results_iter;
+
+        while (1)
+        {
+            results_iter = results.find(x);
+            if (results_iter != results.end())
+            {
+                if ((*results_iter).second == IN_PROGRESS)
+                {
+                    /* A new cycle, starting from x. */
+                    dp_cycle_t dp_cycle;
+                    State y = x;
+
+                    dp_cycle.min_dp = x;
+                    dp_cycle.length = 0;
+                    dp_cycle.num_dps = 0;
+                    dp_cycle.num_walks = 0;
+                    do
+                    {
+                        const dp_node_t & node = _dps[y];
+
+                        dp_cycle.length += node.distance;
+                        dp_cycle.num_dps++;
+                        if (y < dp_cycle.min_dp)
+                        {
+                            dp_cycle.min_dp = y;
+                        }
+                        y = node.next;
+                    } while (!(y == x));
+                    dp_cycles.push_back(dp_cycle);
+                    result = (int64_t)dp_cycles.size() - 1;
+                }
+                else
+                {
+                    result = (*results_iter).second;
+                }
+                break;
+            }
+            results[x] = IN_PROGRESS;
+            path.push_back(x);
+            const dp_node_t & node = _dps[x];
+            if (!node.has_next)
+            {
+                result = -1;
+                break;
+            }
+            x = node.next;
+        }
+        for (size_t i = 0; i < path.size(); i++)
+        {
+            results[path[i]] = result;
+        }
+    }
+
+public:
+    SampleCycles(Step step, p_random_state_func_t p_random_state, const SampleCyclesParams & params)
+        : _step(step),
+          _p_random_state(p_random_state),
+          _params(params),
+          _dp_mask((UINT64_C(1) << params.dp_bits) - 1u),
+          _walks(params.num_walks),
+          _next_walk(0),
+          _num_walks_done(0),
+          _steps_done(0)
+    {
+        if (_params.brent_steps == 0)
+        {
+            _params.brent_steps = UINT64_C(1) << (params.dp_bits + 4u);
+        }
+        if (_params.num_threads == 0)
+        {
+            _params.num_threads = 1;
+        }
+    }
+
+    void sample_cycles()
+    {
+        std::vector<std::thread> threads;
+        std::unordered_map<State, int64_t, Hash> results;
+        std::vector<dp_cycle_t> dp_cycles;
+        std::map<State, walk_t> short_cycles;           // Key is cycle min
+        std::map<State, uint64_t> short_cycle_walks;    // Key is cycle min; value is number of walks
+        lengths_map_t lengths;
+        uint64_t num_open = 0;
+        uint64_t num_walks = _walks.size();
+        typename dp_nodes_t::iterator dps_iter;
+        unsigned i;
+        size_t j;
+
+        for (i = 0; i < _params.num_threads; i++)
+        {
+            threads.push_back(std::thread(&SampleCycles::_thread_main, this));
+        }
+        _wait_for_walks();
+        for (i = 0; i < _params.num_threads; i++)
+        {
+            threads[i].join();
+        }
+
+        for (dps_iter = _dps.begin(); dps_iter != _dps.end(); dps_iter++)
+        {
+            if (results.find((*dps_iter).first) == results.end())
+            {
+                _resolve_dp((*dps_iter).first, results, dp_cycles);
+            }
+        }
+
+        for (j = 0; j < _walks.size(); j++)
+        {
+            const walk_t & walk = _walks[j];
+
+            if (walk.short_cycle)
+            {
+                if (short_cycle_walks[walk.cycle_min]++ == 0)
+                {
+                    short_cycles[walk.cycle_min] = walk;
+                }
+            }
+            else if (walk.has_dp && results[walk.first_dp] >= 0)
+            {
+                dp_cycles[results[walk.first_dp]].num_walks++;
+            }
+            else
+            {
+                num_open++;
+            }
+        }
+
+        std::cout << "Short cycles (Brent's algorithm, up to " << _params.brent_steps << " steps):\n";
+        for (typename std::map<State, walk_t>::iterator iter = short_cycles.begin(); iter != short_cycles.end(); iter++)
+        {
+            std::cout << "Cycle min " << (*iter).first << ", length " << (*iter).second.cycle_length;
+            std::cout << ", reached by " << short_cycle_walks[(*iter).first] << " of " << num_walks << " walks\n";
+            lengths[(*iter).second.cycle_length]++;
+        }
+        std::cout << "\n";
+
+        std::sort(dp_cycles.begin(), dp_cycles.end(),
+                  [](const dp_cycle_t & a, const dp_cycle_t & b) { return a.min_dp < b.min_dp; });
+        std::cout << "Long cycles (distinguished points, 1 in 2^" << _params.dp_bits << " states):\n";
+        for (j = 0; j < dp_cycles.size(); j++)
+        {
+            std::cout << "Cycle min distinguished point " << dp_cycles[j].min_dp << ", length " << dp_cycles[j].length;
+            std::cout << " (" << dp_cycles[j].num_dps << " distinguished points)";
+            std::cout << ", reached by " << dp_cycles[j].num_walks << " of " << num_walks << " walks\n";
+            lengths[dp_cycles[j].length]++;
+        }
+        std::cout << "\n";
+
+        print_cycle_lengths(lengths);
+        std::cout << short_cycles.size() + dp_cycles.size() << " cycles found from " << num_walks << " walks, ";
+        std::cout << _dps.size() << " distinguished points recorded\n";
+        if (num_open)
+        {
+            std::cout << num_open << " walks didn't reach a cycle within " << _params.max_steps << " steps\n";
+        }
+    }
+};
+
+#endif /* !defined(FIND_CYCLES_H) */
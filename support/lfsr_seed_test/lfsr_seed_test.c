@@ -1,20 +1,48 @@
+/*
+ * lfsr_seed_test.c
+ *
+ * Evaluate the seed adjustment functions for the LFSR generators' seeding.
+ *
+ * For each aligned group of MIN_VALUE_SHIFT_COUNT adjusted seed values (which
+ * differ only in their low bits), find the seeds that map to them (with the
+ * inverse adjustment function), and the minimum distance between those seeds.
+ * Groups with a small minimum distance (less than CLOSE_DISTANCE), or a new
+ * smallest minimum distance, are printed.
+ *
+ * All the seed adjustment variants are swept in one run (or just those given
+ * on the command line, by their ADJUST_SHIFT value), each one using all CPUs:
+ * the 2^32 adjusted seed values are split into chunks, which are shared out
+ * between threads. Each thread reduces a chunk to its records (small or new
+ * minimum distances), which are then merged in order, giving the same output
+ * as a sequential search.
+ *
+ * The inverse adjustment functions are linear (over GF(2)), so the inverse of
+ * a block of BLOCK_VALUES consecutive aligned values is one function call,
+ * XORed with a table of the inverse of the low bits, in a vectorisable loop.
+ *
+ * Usage:
+ *     lfsr_seed_test [-t NUM_THREADS] [ADJUST_SHIFT...]
+ */
 
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 
 #define MIN_VALUE_SHIFT             3
 
-#define ADJUST_SHIFT                4
-
 #define MIN_VALUE_SHIFT_COUNT       (1 << MIN_VALUE_SHIFT)
 #define MIN_VALUE_LOW_BITS_MASK     (MIN_VALUE_SHIFT_COUNT - 1)
 #define MIN_VALUE_HIGH_BITS_MASK    (0xFFFFFFFF ^ MIN_VALUE_LOW_BITS_MASK)
 
-#define PASTER(x,y)                 x ## y
-#define EVALUATOR(x,y)              PASTER(x,y)
+#define CLOSE_DISTANCE              0x100
 
-#define ADJUST_SEED                 EVALUATOR(adjust_seed_, ADJUST_SHIFT)
-#define INVERSE_ADJUST_SEED         EVALUATOR(inverse_adjust_seed_, ADJUST_SHIFT)
+/* Values whose inverse is computed from one call and a table */
+#define BLOCK_VALUES                512u
+/* Values in each chunk shared out between threads */
+#define CHUNK_VALUES                (1uL << 23)
+#define NUM_CHUNKS                  ((1uLL << 32) / CHUNK_VALUES)
 
 uint32_t distance_uint32(uint32_t a, uint32_t b)
 {
@@ -151,71 +179,297 @@ uint32_t inverse_adjust_seed_24(uint32_t seed)
     return seed ^ (seed << 24);
 }
 
-int main()
+typedef struct
+{
+    unsigned        shift;
+    uint32_t     (* p_adjust)(uint32_t seed);
+    uint32_t     (* p_inverse_adjust)(uint32_t seed);
+} AdjustVariant_t;
+
+static const AdjustVariant_t adjust_variants[] =
+{
+    { 1,    adjust_seed_1,  inverse_adjust_seed_1 },
+    { 3,    adjust_seed_3,  inverse_adjust_seed_3 },
+    { 4,    adjust_seed_4,  inverse_adjust_seed_4 },
+    { 7,    adjust_seed_7,  inverse_adjust_seed_7 },
+    { 8,    adjust_seed_8,  inverse_adjust_seed_8 },
+    { 16,   adjust_seed_16, inverse_adjust_seed_16 },
+    { 24,   adjust_seed_24, inverse_adjust_seed_24 },
+};
+
+#define NUM_ADJUST_VARIANTS         (sizeof(adjust_variants) / sizeof(adjust_variants[0]))
+
+/* A group of seeds, with a small or new minimum distance */
+typedef struct
+{
+    uint32_t        seed_out;       /* First adjusted seed value of the group */
+    uint32_t        min_distance;
+    uint32_t        seeds[MIN_VALUE_SHIFT_COUNT];
+} SeedGroup_t;
+
+typedef struct
+{
+    uint32_t        min_distance;
+    uint64_t        num_close;
+    size_t          num_records;
+    size_t          records_size;
+    SeedGroup_t   * p_records;
+} ChunkResult_t;
+
+typedef struct
+{
+    const AdjustVariant_t * p_variant;
+    uint32_t                inverse_low[BLOCK_VALUES];
+    ChunkResult_t           chunks[NUM_CHUNKS];
+    unsigned                next_chunk;
+    pthread_mutex_t         mutex;
+} Sweep_t;
+
+/* Sort the seeds of a group, and return the minimum distance between them
+ * (treating them as points on a circle).
+ */
+static uint32_t group_min_distance(const uint32_t * p_vals, uint32_t * p_seeds)
 {
-    uint32_t    seeds[MIN_VALUE_SHIFT_COUNT * 2];
-    uint32_t    num_seeds;
-    uint32_t    local_min_distance;
     uint32_t    min_distance;
     uint32_t    distance;
     uint32_t    val;
-    uint32_t    i, j;
     int         seeds_idx;
     int         seeds_idx2;
-    
+
+    for (seeds_idx = 0; seeds_idx < MIN_VALUE_SHIFT_COUNT; seeds_idx++)
+    {
+        // Insert val into array, sorted
+        val = p_vals[seeds_idx];
+        for (seeds_idx2 = seeds_idx - 1; seeds_idx2 >= 0 && p_seeds[seeds_idx2] > val; seeds_idx2--)
+            p_seeds[seeds_idx2 + 1] = p_seeds[seeds_idx2];
+        p_seeds[seeds_idx2 + 1] = val;
+    }
+
     min_distance = 0xFFFFFFFF;
-    i = MIN_VALUE_SHIFT_COUNT;
-    do
+    for (seeds_idx = 0; seeds_idx < MIN_VALUE_SHIFT_COUNT; seeds_idx++)
+    {
+        distance = distance_uint32(p_seeds[seeds_idx], p_seeds[(seeds_idx + 1) % MIN_VALUE_SHIFT_COUNT]);
+        if (distance < min_distance)
+            min_distance = distance;
+    }
+    return min_distance;
+}
+
+static void add_record(ChunkResult_t * p_chunk, uint32_t seed_out, uint32_t min_distance, const uint32_t * p_seeds)
+{
+    SeedGroup_t   * p_record;
+    int             seeds_idx;
+
+    if (p_chunk->num_records >= p_chunk->records_size)
+    {
+        p_chunk->records_size = p_chunk->records_size ? p_chunk->records_size * 2 : 16;
+        p_chunk->p_records = realloc(p_chunk->p_records, p_chunk->records_size * sizeof(SeedGroup_t));
+        if (p_chunk->p_records == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    p_record = &p_chunk->p_records[p_chunk->num_records++];
+    p_record->seed_out = seed_out;
+    p_record->min_distance = min_distance;
+    for (seeds_idx = 0; seeds_idx < MIN_VALUE_SHIFT_COUNT; seeds_idx++)
+        p_record->seeds[seeds_idx] = p_seeds[seeds_idx];
+}
+
+static void process_chunk(Sweep_t * p_sweep, unsigned chunk_idx)
+{
+    ChunkResult_t     * p_chunk = &p_sweep->chunks[chunk_idx];
+    uint32_t         (* p_inverse_adjust)(uint32_t seed) = p_sweep->p_variant->p_inverse_adjust;
+    const uint32_t    * p_inverse_low = p_sweep->inverse_low;
+    uint32_t            vals[BLOCK_VALUES];
+    uint32_t            seeds[MIN_VALUE_SHIFT_COUNT];
+    uint32_t            block_first;
+    uint32_t            base;
+    uint32_t            local_min_distance;
+    uint32_t            i;
+    unsigned            j;
+
+    p_chunk->min_distance = 0xFFFFFFFF;
+    for (i = 0; i < CHUNK_VALUES; i += BLOCK_VALUES)
+    {
+        block_first = chunk_idx * CHUNK_VALUES + i;
+        base = p_inverse_adjust(block_first);
+        for (j = 0; j < BLOCK_VALUES; j++)
+            vals[j] = base ^ p_inverse_low[j];
+
+        for (j = 0; j < BLOCK_VALUES; j += MIN_VALUE_SHIFT_COUNT)
+        {
+            // The group of adjusted seed values from 0 is skipped.
+            if (block_first + j == 0)
+                continue;
+
+            local_min_distance = group_min_distance(&vals[j], seeds);
+            if (local_min_distance < CLOSE_DISTANCE)
+                p_chunk->num_close++;
+            if ((local_min_distance < CLOSE_DISTANCE) ||
+                (local_min_distance < p_chunk->min_distance))
+            {
+                add_record(p_chunk, block_first + j, local_min_distance, seeds);
+            }
+            if (local_min_distance < p_chunk->min_distance)
+                p_chunk->min_distance = local_min_distance;
+        }
+    }
+}
+
+static void * sweep_thread(void * p_arg)
+{
+    Sweep_t   * p_sweep = p_arg;
+    unsigned    chunk_idx;
+
+    while (1)
+    {
+        pthread_mutex_lock(&p_sweep->mutex);
+        chunk_idx = p_sweep->next_chunk++;
+        pthread_mutex_unlock(&p_sweep->mutex);
+        if (chunk_idx >= NUM_CHUNKS)
+            break;
+        process_chunk(p_sweep, chunk_idx);
+    }
+    return NULL;
+}
+
+/* Sweep all adjusted seed values for one adjustment variant, and print the
+ * results. Returns the minimum distance, and the number of groups with a
+ * small minimum distance in '*p_num_close'.
+ */
+static uint32_t sweep_variant(Sweep_t * p_sweep, const AdjustVariant_t * p_variant, unsigned num_threads, uint64_t * p_num_close)
+{
+    pthread_t     * p_threads;
+    ChunkResult_t * p_chunk;
+    SeedGroup_t   * p_record;
+    uint32_t        min_distance;
+    uint64_t        num_close;
+    unsigned        chunk_idx;
+    unsigned        t;
+    size_t          r;
+    int             seeds_idx;
+
+    p_sweep->p_variant = p_variant;
+    p_sweep->next_chunk = 0;
+    for (r = 0; r < BLOCK_VALUES; r++)
+        p_sweep->inverse_low[r] = p_variant->p_inverse_adjust((uint32_t)r);
+    for (chunk_idx = 0; chunk_idx < NUM_CHUNKS; chunk_idx++)
     {
-        //for (seeds_idx = 0; seeds_idx < MIN_VALUE_SHIFT_COUNT; seeds_idx++)
-        //{
-        //    seeds[seeds_idx] = 0xFFFFFFFF;
-        //}
-        num_seeds = 0;
-
-        j = i;
-        do
+        p_sweep->chunks[chunk_idx].num_close = 0;
+        p_sweep->chunks[chunk_idx].num_records = 0;
+    }
+
+    p_threads = malloc(num_threads * sizeof(pthread_t));
+    if (p_threads == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (t = 0; t < num_threads; t++)
+    {
+        if (pthread_create(&p_threads[t], NULL, sweep_thread, p_sweep) != 0)
         {
-            val = INVERSE_ADJUST_SEED(j);
+            fprintf(stderr, "Couldn't create thread\n");
+            exit(1);
+        }
+    }
+    for (t = 0; t < num_threads; t++)
+        pthread_join(p_threads[t], NULL);
+    free(p_threads);
 
-            // Insert val into array, sorted
-            for (seeds_idx = 0;
-                (seeds_idx < num_seeds) && val > seeds[seeds_idx];
-                seeds_idx++)
+    // Merge the chunks' records in order.
+    printf("ADJUST_SHIFT %u\n", p_variant->shift);
+    min_distance = 0xFFFFFFFF;
+    num_close = 0;
+    for (chunk_idx = 0; chunk_idx < NUM_CHUNKS; chunk_idx++)
+    {
+        p_chunk = &p_sweep->chunks[chunk_idx];
+        num_close += p_chunk->num_close;
+        for (r = 0; r < p_chunk->num_records; r++)
+        {
+            p_record = &p_chunk->p_records[r];
+            if ((p_record->min_distance < CLOSE_DISTANCE) ||
+                (p_record->min_distance < min_distance))
             {
-                // Looking for appropriate spot
+                printf("min dist %08X; seed out %08X; seeds", p_record->min_distance, p_record->seed_out);
+                for (seeds_idx = 0; seeds_idx < MIN_VALUE_SHIFT_COUNT; seeds_idx++)
+                    printf(" %08X", p_record->seeds[seeds_idx]);
+                printf("\n");
             }
-            for (seeds_idx2 = num_seeds - 1; seeds_idx2 >= seeds_idx; seeds_idx2--)
-                seeds[seeds_idx2 + 1] = seeds[seeds_idx2];
-            seeds[seeds_idx] = val;
-            num_seeds++;
-
-            val = INVERSE_ADJUST_SEED(j ^ 0x80000000);
-            if (ADJUST_SEED(val) < MIN_VALUE_SHIFT_COUNT)
-            j++;
-        } while ((j & MIN_VALUE_LOW_BITS_MASK) != 0);
-
-        local_min_distance = 0xFFFFFFFF;
-        for (seeds_idx = 0; seeds_idx < num_seeds; seeds_idx++)
+            if (p_record->min_distance < min_distance)
+                min_distance = p_record->min_distance;
+        }
+    }
+    printf("\n");
+    fflush(stdout);
+
+    *p_num_close = num_close;
+    return min_distance;
+}
+
+int main(int argc, char * argv[])
+{
+    static Sweep_t  sweep;
+    const AdjustVariant_t * p_selected[NUM_ADJUST_VARIANTS];
+    uint32_t        min_distances[NUM_ADJUST_VARIANTS];
+    uint64_t        nums_close[NUM_ADJUST_VARIANTS];
+    unsigned        num_selected = 0;
+    long            num_threads;
+    unsigned long   shift;
+    unsigned        v;
+    int             option;
+    int             arg_idx;
+
+    num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    while ((option = getopt(argc, argv, "t:")) != -1)
+    {
+        switch (option)
         {
-            distance = distance_uint32(seeds[seeds_idx], seeds[(seeds_idx + 1) % num_seeds]);
-            if (distance < local_min_distance)
-                local_min_distance = distance;
+        case 't':
+            num_threads = strtol(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-t NUM_THREADS] [ADJUST_SHIFT...]\n", argv[0]);
+            return 2;
         }
+    }
+    if (num_threads < 1)
+        num_threads = 1;
 
-        if ((local_min_distance < 0x100) ||
-            (local_min_distance < min_distance))
+    for (arg_idx = optind; arg_idx < argc; arg_idx++)
+    {
+        shift = strtoul(argv[arg_idx], NULL, 10);
+        for (v = 0; v < NUM_ADJUST_VARIANTS; v++)
         {
-            printf("min dist %08X; seed out %08X; seeds", local_min_distance, i);
-            for (seeds_idx = 0; seeds_idx < num_seeds; seeds_idx++)
-                printf(" %08X", seeds[seeds_idx]);
-            printf("\n");
+            if (adjust_variants[v].shift == shift)
+                break;
         }
-        
-        if (local_min_distance < min_distance)
+        if (v >= NUM_ADJUST_VARIANTS || num_selected >= NUM_ADJUST_VARIANTS)
         {
-            min_distance = local_min_distance;
+            fprintf(stderr, "Unknown or repeated ADJUST_SHIFT %s\n", argv[arg_idx]);
+            return 2;
         }
-        i += MIN_VALUE_SHIFT_COUNT;
-    } while (i != 0);
+        p_selected[num_selected++] = &adjust_variants[v];
+    }
+    if (num_selected == 0)
+    {
+        for (v = 0; v < NUM_ADJUST_VARIANTS; v++)
+            p_selected[num_selected++] = &adjust_variants[v];
+    }
+
+    pthread_mutex_init(&sweep.mutex, NULL);
+    for (v = 0; v < num_selected; v++)
+    {
+        min_distances[v] = sweep_variant(&sweep, p_selected[v], (unsigned)num_threads, &nums_close[v]);
+    }
+
+    printf("Summary\n");
+    printf("ADJUST_SHIFT  min dist  groups with min dist < %X\n", CLOSE_DISTANCE);
+    for (v = 0; v < num_selected; v++)
+    {
+        printf("%12u  %08X  %llu\n", p_selected[v]->shift, min_distances[v], (unsigned long long)nums_close[v]);
+    }
+    return 0;
 }